@@ -118,47 +118,32 @@ static sint8 nm_i2c_write_special(uint8 *wb1, uint16 sz1, uint8 *wb2, uint16 sz2
 struct spi_module master;
 struct spi_slave_inst slave_inst;
 
+/*
+*	@fn		spi_rw
+*	@brief	Transfer a buffer over SPI with the WINC selected
+*	@details	The buffer is moved by the SERCOM buffer functions instead of byte by byte,
+*			with dedicated paths for write only (pu8Miso == NULL) and read only (pu8Mosi == NULL) transfers.
+*			Read only transfers send 0x00 as dummy bytes, like the byte wise transfer did.
+*	@return	M2M_SUCCESS in case of success and M2M_ERR_BUS_FAIL in case of failure
+*/
 static sint8 spi_rw(uint8* pu8Mosi, uint8* pu8Miso, uint16 u16Sz)
 {
-	uint8 u8Dummy = 0;
-	uint8 u8SkipMosi = 0, u8SkipMiso = 0;
-	uint16_t txd_data = 0;
-	uint16_t rxd_data = 0;
+	enum status_code status;
 
 	if(((pu8Miso == NULL) && (pu8Mosi == NULL)) ||(u16Sz == 0)) {
 		return M2M_ERR_INVALID_ARG;
 	}
 
-	if (pu8Mosi == NULL) {
-		pu8Mosi = &u8Dummy;
-		u8SkipMosi = 1;
-	}
-	if(pu8Miso == NULL) {
-		pu8Miso = &u8Dummy;
-		u8SkipMiso = 1;
-	}
-
 	spi_select_slave(&master, &slave_inst, true);
 
-	while (u16Sz) {
-		txd_data = *pu8Mosi;
-		while (!spi_is_ready_to_write(&master))
-			;
-		while(spi_write(&master, txd_data) != STATUS_OK)
-			;
-
-		/* Read SPI master data register. */
-		while (!spi_is_ready_to_read(&master))
-			;
-		while (spi_read(&master, &rxd_data) != STATUS_OK)
-			;
-		*pu8Miso = rxd_data;
-			
-		u16Sz--;
-		if (!u8SkipMiso)
-			pu8Miso++;
-		if (!u8SkipMosi)
-			pu8Mosi++;
+	if (pu8Miso == NULL) {
+		/* Write only: received bytes are flushed by the driver. */
+		status = spi_write_buffer_wait(&master, pu8Mosi, u16Sz);
+	} else if (pu8Mosi == NULL) {
+		/* Read only: clock the bytes in with dummy bytes. */
+		status = spi_read_buffer_wait(&master, pu8Miso, u16Sz, 0);
+	} else {
+		status = spi_transceive_buffer_wait(&master, pu8Mosi, pu8Miso, u16Sz);
 	}
 
 	while (!spi_is_write_complete(&master))
@@ -166,6 +151,10 @@ static sint8 spi_rw(uint8* pu8Mosi, uint8* pu8Miso, uint16 u16Sz)
 
 	spi_select_slave(&master, &slave_inst, false);
 
+	if (status != STATUS_OK) {
+		return M2M_ERR_BUS_FAIL;
+	}
+
 	return M2M_SUCCESS;
 }
 #endif
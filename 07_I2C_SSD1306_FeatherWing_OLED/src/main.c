@@ -59,6 +59,12 @@
 static               bool  display_is_on; // state of the OLED display
 static struct Framebuffer *framebuffer  ; // pointer to a framebuffer for the featherWing_OLED
 
+// memory of the framebuffer, in .bss instead of on the heap
+static struct Framebuffer          framebuffer_instance;
+static struct Framebuffer_SSD1306  framebuffer_ssd1306;
+static framebuffer_ssd1306_tile_t  framebuffer_tiles      [FRAMEBUFFER_SSD1306_TILES            ( ADAFRUIT_FEATHERWING_OLED_WIDTH, ADAFRUIT_FEATHERWING_OLED_HEIGHT )] COMPILER_WORD_ALIGNED;
+static framebuffer_ssd1306_dirty_t framebuffer_tiles_dirty[FRAMEBUFFER_SSD1306_TILES_DIRTY_WORDS( ADAFRUIT_FEATHERWING_OLED_WIDTH, ADAFRUIT_FEATHERWING_OLED_HEIGHT )];
+
 // ====================================================
 // some constants for drawing things on the OLED                       
 // ====================================================
@@ -134,7 +140,7 @@ static void oled_button_c_on_pressed ( void )
          framebuffer->clear( framebuffer );                        // reset all pixels to 0x00
  
          draw_rect            ( framebuffer, WHITE, X_MIN, Y_MIN, X_MAX, Y_MAX );
-         draw_line_testpattern( framebuffer, WHITE, X_MID, Y_MID, X_MIN+2, Y_MIN+2, X_MAX-2, Y_MAX-2 );
+         draw_line_testpattern( framebuffer, WHITE, X_MID, Y_MID, X_MIN+2, Y_MIN+2, X_MAX-2, Y_MAX-2, featherWing_OLED_present );
  
          featherWing_OLED_update( framebuffer );        // send it over to the screen
 }
@@ -146,21 +152,21 @@ static void oled_button_c_on_released ( void )
 
 static void on_reset ( enum Resetscreen_Content rsc ) 
 {
-        uint8_t string_width;
+        uint16_t string_width;
         uint8_t x_pos = 0;
 
         switch( rsc ){
                 case FONT_08PX: {
-                        font_08px_draw_string( framebuffer, "Hello World!", WHITE, x_pos, 1, FONT_BACKGROUND_OPAQUE, &string_width);
-                        font_06px_draw_string( framebuffer, "-73db 192.168.1.1 Drechsler-EXT", WHITE, x_pos,  25, FONT_BACKGROUND_OPAQUE, &string_width);
+                        font_draw_string( framebuffer, &font_08px, "Hello World!", WHITE, x_pos, 1, FONT_BACKGROUND_OPAQUE, &string_width);
+                        font_draw_string( framebuffer, &font_06px, "-73db 192.168.1.1 Drechsler-EXT", WHITE, x_pos,  25, FONT_BACKGROUND_OPAQUE, &string_width);
                         break;
                 }
                 default: {
-                        font_06px_draw_string( framebuffer, "Hello World!", WHITE, x_pos, 1, FONT_BACKGROUND_OPAQUE, &string_width);
-                        font_06px_draw_string( framebuffer, "abcdefghijklmnopqrstuvwxyz", WHITE, x_pos,   7, FONT_BACKGROUND_OPAQUE, &string_width);
-                        font_06px_draw_string( framebuffer, "ABCDEFGHIJKLMNOPQRSTUVWXYZ", WHITE, x_pos,  13, FONT_BACKGROUND_OPAQUE, &string_width);
-                        font_06px_draw_string( framebuffer, "abcdefghijklmnopqrstuvwxyz", WHITE, x_pos,  19, FONT_BACKGROUND_OPAQUE, &string_width);
-                        font_06px_draw_string( framebuffer, "ABCDEFGHIJKLMNOPQRSTUVWXYZ", WHITE, x_pos,  25, FONT_BACKGROUND_OPAQUE, &string_width);
+                        font_draw_string( framebuffer, &font_06px, "Hello World!", WHITE, x_pos, 1, FONT_BACKGROUND_OPAQUE, &string_width);
+                        font_draw_string( framebuffer, &font_06px, "abcdefghijklmnopqrstuvwxyz", WHITE, x_pos,   7, FONT_BACKGROUND_OPAQUE, &string_width);
+                        font_draw_string( framebuffer, &font_06px, "ABCDEFGHIJKLMNOPQRSTUVWXYZ", WHITE, x_pos,  13, FONT_BACKGROUND_OPAQUE, &string_width);
+                        font_draw_string( framebuffer, &font_06px, "abcdefghijklmnopqrstuvwxyz", WHITE, x_pos,  19, FONT_BACKGROUND_OPAQUE, &string_width);
+                        font_draw_string( framebuffer, &font_06px, "ABCDEFGHIJKLMNOPQRSTUVWXYZ", WHITE, x_pos,  25, FONT_BACKGROUND_OPAQUE, &string_width);
                         break;
                 }
         }
@@ -269,11 +275,17 @@ int main ( void )
                 }
         }
 
-        // --------------------
-        // Framebuffer creation
-        // --------------------
+        // --------------------------
+        // Framebuffer initialization
+        // --------------------------
         
-        framebuffer = framebuffer_SSD1306_create( ADAFRUIT_FEATHERWING_OLED_WIDTH, ADAFRUIT_FEATHERWING_OLED_HEIGHT );
+        status = framebuffer_SSD1306_init_static( &framebuffer_instance, &framebuffer_ssd1306, framebuffer_tiles, framebuffer_tiles_dirty, NULL, ADAFRUIT_FEATHERWING_OLED_WIDTH, ADAFRUIT_FEATHERWING_OLED_HEIGHT );
+        if( status != STATUS_OK ) {
+                printf( "main: initializing framebuffer error %d"STRING_EOL, status );
+                while( true ){ // stop processing
+                }
+        }
+        framebuffer = &framebuffer_instance;
 
         // -----------------
         // application logic
@@ -101,24 +101,24 @@ enum Resetscreen_Content {
 
 static void on_reset ( enum Resetscreen_Content rsc )
 {
-        uint8_t string_width;
+        uint16_t string_width;
         uint8_t x_pos = 0;
 
         switch( rsc ){
                 case FONT_08PX: {
-                        font_08px_draw_string( framebuffer, "Hello World!", WHITE, x_pos, 1, FONT_BACKGROUND_OPAQUE, &string_width);
-                        font_06px_draw_string( framebuffer, "-73db 192.168.1.1 Drechsler-EXT", WHITE, x_pos,  Y_MAX-6, FONT_BACKGROUND_OPAQUE, &string_width);
+                        font_draw_string( framebuffer, &font_08px, "Hello World!", WHITE, x_pos, 1, FONT_BACKGROUND_OPAQUE, &string_width);
+                        font_draw_string( framebuffer, &font_06px, "-73db 192.168.1.1 Drechsler-EXT", WHITE, x_pos,  Y_MAX-6, FONT_BACKGROUND_OPAQUE, &string_width);
                         break;
                 }
                 default: {
-                        font_08px_draw_string( framebuffer, "Hello World!"                   , WHITE, x_pos, Y_MIN     , FONT_BACKGROUND_OPAQUE, &string_width);
-                        font_06px_draw_string( framebuffer, "abcdefghijklmnopqrstuvwxyz"     , WHITE, x_pos, Y_MIN +  9, FONT_BACKGROUND_OPAQUE, &string_width);
-                        font_06px_draw_string( framebuffer, "ABCDEFGHIJKLMNOPQRSTUVWXYZ"     , WHITE, x_pos, Y_MIN + 16, FONT_BACKGROUND_OPAQUE, &string_width);
-                        font_06px_draw_string( framebuffer, "0123456789 @!\"$\\/"           , WHITE, x_pos, Y_MIN + 23, FONT_BACKGROUND_OPAQUE, &string_width);
-                        font_08px_draw_string( framebuffer, "abcdefghijklmnopq"              , WHITE, x_pos, Y_MIN + 30, FONT_BACKGROUND_OPAQUE, &string_width);
-                        font_08px_draw_string( framebuffer, "ABCDEFGHIJKLMNOP"               , WHITE, x_pos, Y_MIN + 39, FONT_BACKGROUND_OPAQUE, &string_width);
-                        font_08px_draw_string( framebuffer, "0123456789 @!\"$\\/"           , WHITE, x_pos, Y_MIN + 48, FONT_BACKGROUND_OPAQUE, &string_width);
-                        font_06px_draw_string( framebuffer, "-73db 192.168.1.1 Drechsler-EXT", WHITE, x_pos, Y_MAX -  6, FONT_BACKGROUND_OPAQUE, &string_width);
+                        font_draw_string( framebuffer, &font_08px, "Hello World!"                   , WHITE, x_pos, Y_MIN     , FONT_BACKGROUND_OPAQUE, &string_width);
+                        font_draw_string( framebuffer, &font_06px, "abcdefghijklmnopqrstuvwxyz"     , WHITE, x_pos, Y_MIN +  9, FONT_BACKGROUND_OPAQUE, &string_width);
+                        font_draw_string( framebuffer, &font_06px, "ABCDEFGHIJKLMNOPQRSTUVWXYZ"     , WHITE, x_pos, Y_MIN + 16, FONT_BACKGROUND_OPAQUE, &string_width);
+                        font_draw_string( framebuffer, &font_06px, "0123456789 @!\"$\\/"           , WHITE, x_pos, Y_MIN + 23, FONT_BACKGROUND_OPAQUE, &string_width);
+                        font_draw_string( framebuffer, &font_08px, "abcdefghijklmnopq"              , WHITE, x_pos, Y_MIN + 30, FONT_BACKGROUND_OPAQUE, &string_width);
+                        font_draw_string( framebuffer, &font_08px, "ABCDEFGHIJKLMNOP"               , WHITE, x_pos, Y_MIN + 39, FONT_BACKGROUND_OPAQUE, &string_width);
+                        font_draw_string( framebuffer, &font_08px, "0123456789 @!\"$\\/"           , WHITE, x_pos, Y_MIN + 48, FONT_BACKGROUND_OPAQUE, &string_width);
+                        font_draw_string( framebuffer, &font_06px, "-73db 192.168.1.1 Drechsler-EXT", WHITE, x_pos, Y_MAX -  6, FONT_BACKGROUND_OPAQUE, &string_width);
                         break;
                 }
         }
@@ -33,6 +33,7 @@
 #include "Adafruit_FeatherWing_OLED.h"
 #include "Com_Driver_i2c_master.h"      // FeatherWing_OLED uses I2C to communicate with the MCU
 #include "SSD1306.h"                    // FeatherWing_OLED uses an SSD1306 OLED controller IC
+#include "Frame_Scheduler.h"            // FeatherWing_OLED paces its frames
 
 /** 
  * FeatherWingOLED's SSD1306 global configuration data structure instance
@@ -49,6 +50,22 @@ static struct SSD1306 featherWing_oled = {
         .flip_vertical      = true
 };
 
+/**
+ * State of the asynchronous updates of the FeatherWing_OLED.
+ */
+static struct SSD1306_Update_Async featherWing_oled_update_async = {
+        .busy               = false,
+        .status             = STATUS_OK
+};
+
+/**
+ * Frame scheduler of the FeatherWing_OLED, not pacing until initialized.
+ */
+static struct Frame_Scheduler featherWing_oled_frame_scheduler = {
+        .ssd1306            = &featherWing_oled,
+        .stats              = { .flush_ticks_min = UINT32_MAX }
+};
+
 /************************************************************************/
 /* local functions                                                      */
 /************************************************************************/
@@ -243,3 +260,56 @@ enum status_code featherWing_OLED_update_all(
         return ssd1306_display_update_all( &featherWing_oled, framebuffer );
 }
 
+/**
+ * \brief Start updating the tiles that have been changed since the last OLED update and return at once.
+ *
+ * This function forwards the call to the ssd1306_display_update_async() function
+ * of the DIT SSD1306 library.
+ */
+enum status_code featherWing_OLED_update_async(
+  struct Framebuffer  *const framebuffer        //< framebuffer to write to the FeatherWing_OLED
+, SSD1306_Update_Done *const on_done            //< called with the status of the update, when it is done (may be NULL)
+, void                *const user_data          //< user data to pass to on_done
+){
+        return ssd1306_display_update_async( &featherWing_oled, framebuffer, &featherWing_oled_update_async, on_done, user_data );
+}
+
+/**
+ * \brief Check if an asynchronous OLED update is still in flight.
+ */
+bool featherWing_OLED_update_async_busy( void )
+{
+        return ssd1306_display_update_async_busy( &featherWing_oled_update_async );
+}
+
+/**
+ * \brief Initialize the frame scheduler of the OLED.
+ *
+ * This function forwards the call to the frame_scheduler_init() function.
+ */
+void featherWing_OLED_init_frame_scheduler(
+  Frame_Scheduler_Clock *const clock            //< tick counter (NULL: no pacing, no times)
+, uint32_t               const ticks_per_second //< frequency of the tick counter
+, uint16_t               const fps              //< target frame rate (0: no pacing)
+){
+        frame_scheduler_init( &featherWing_oled_frame_scheduler, &featherWing_oled, clock, ticks_per_second, fps );
+}
+
+/**
+ * \brief Present the framebuffer, it's sent to the OLED if a frame is due.
+ *
+ * This function forwards the call to the frame_scheduler_present() function.
+ */
+enum status_code featherWing_OLED_present(
+  struct Framebuffer *const framebuffer        //< framebuffer to present on the FeatherWing_OLED
+){
+        return frame_scheduler_present( &featherWing_oled_frame_scheduler, framebuffer );
+}
+
+/**
+ * \brief Get the statistics of the frame scheduler of the OLED.
+ */
+struct Frame_Scheduler_Stats const *featherWing_OLED_frame_stats( void )
+{
+        return &featherWing_oled_frame_scheduler.stats;
+}
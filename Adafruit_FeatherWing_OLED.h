@@ -33,14 +33,13 @@
 #define ADAFRUIT_FEATHERWING_OLED_H_
 
 #include "Framebuffer.h"                                // Generic Framebuffer declaration
+#include "SSD1306.h"                                    // SSD1306_Update_Done
+#include "Frame_Scheduler.h"                            // Frame_Scheduler_Clock, Frame_Scheduler_Stats
 
 #define ADAFRUIT_FEATHERWING_OLED_I2C_ADDRESS   0x3C    //< fixed value for the FeatherWing_OLED
 #define ADAFRUIT_FEATHERWING_OLED_WIDTH         128     //< fixed value for the FeatherWing_OLED
 #define ADAFRUIT_FEATHERWING_OLED_HEIGHT        32      //< fixed value for the FeatherWing_OLED
 
-//* number of dirty tiles to update tile by tile, before it is more efficient to update the whole display 
-#define ADAFRUIT_FEATHERWING_OLED_TILES_DIRTY_THRESHOLD  147 
-
 // ATSAMD21G18 pins the buttons are connected to
 #define BUTTON_A_PIN            PIN_PA07A_EIC_EXTINT7   // A (SW2) is on PA07, using external interrupt controller line 7
 #define BUTTON_A_PIN_MUX        MUX_PA07A_EIC_EXTINT7
@@ -88,7 +87,8 @@ struct FeatherWing_OLED_Buttons_Event_Handlers featherWing_oled_buttons_event_ha
  * - \ref bytes             = 512 (4 pages a 128 columns)
  * - \ref bits_per_tile     =   8
  * - \ref tiles*            = is the pointer to a NEW allocated pixel buffer (512 bytes)
- * - \ref tiles_dirty*      = is the pointer the index of dirty tiles (64 bytes)
+ * - \ref tiles_dirty*      = is the pointer the index of dirty tiles (16 words, 64 bytes)
+ * - \ref tiles_dirty_words =  16
  * - \ref tiles_dirty_count =   0
  *
  * \note Initial state of the display is off
@@ -143,9 +143,8 @@ enum status_code featherWing_OLED_on(
  * Update the tiles of the OLED with the tiles of the framebuffer,
  * depending on there dirty state in the framebuffer.
  *
- * If the number of tiles dirty is bigger than the 
- * ADAFRUIT_FEATHERWING_OLED_TILES_DIRTY_THRESHOLD
- * this implementation calls \ref featherWing_OLED_update_all().
+ * The update is planned by \ref ssd1306_display_update() to send 
+ * the dirty tiles with the least bus traffic.
  *
  * \return Status of operation.
  * \retval STATUS_OK                    If update was successfully
@@ -185,4 +184,58 @@ enum status_code featherWing_OLED_update_all(
   struct Framebuffer *const framebuffer //< framebuffer to write to the FeatherWing_OLED
 );
 
+/**
+ * Start updating the tiles of the OLED with the dirty tiles of the framebuffer
+ * and return at once, see \ref ssd1306_display_update_async().
+ *
+ * The framebuffer can be drawn to while the update is in flight.
+ * Don't use the I2C bus otherwise, before \ref on_done is called.
+ *
+ * \return Status of operation.
+ * \retval STATUS_OK                    If the update was started, \ref on_done will be called when it is done
+ * \retval STATUS_NO_CHANGE             If there are no dirty tiles, \ref on_done won't be called
+ * \retval STATUS_BUSY                  If an update is still in flight
+ * \retval STATUS_ERR_UNSUPPORTED_DEV   If the I2C driver is not built with I2C_MASTER_CALLBACK_MODE
+ */
+enum status_code featherWing_OLED_update_async(
+  struct Framebuffer  *const framebuffer        //< framebuffer to write to the FeatherWing_OLED
+, SSD1306_Update_Done *const on_done            //< called with the status of the update, when it is done (may be NULL)
+, void                *const user_data          //< user data to pass to on_done
+);
+
+/**
+ * Check if an asynchronous OLED update is still in flight.
+ */
+bool featherWing_OLED_update_async_busy( void );
+
+/**
+ * Initialize the frame scheduler of the OLED to pace \ref featherWing_OLED_present() to \ref fps frames per second,
+ * see \ref frame_scheduler_init().
+ *
+ * Until then every present is sent at once.
+ */
+void featherWing_OLED_init_frame_scheduler(
+  Frame_Scheduler_Clock *const clock            //< tick counter, e.g. of a TC or the RTC (NULL: no pacing, no times)
+, uint32_t               const ticks_per_second //< frequency of the tick counter
+, uint16_t               const fps              //< target frame rate (0: no pacing)
+);
+
+/**
+ * Present the framebuffer on the OLED: the dirty tiles are sent, if a frame is due,
+ * see \ref frame_scheduler_present().
+ *
+ * \return Status of operation.
+ * \retval STATUS_OK                    If the frame was sent
+ * \retval STATUS_NO_CHANGE             If no frame is due yet, what's drawn goes out with the next one
+ * \retval any                          Status of \ref featherWing_OLED_update()
+ */
+enum status_code featherWing_OLED_present(
+  struct Framebuffer *const framebuffer //< framebuffer to present on the FeatherWing_OLED
+);
+
+/**
+ * Get the statistics of the frames presented on the OLED: frames flushed and dropped, bus traffic and flush times.
+ */
+struct Frame_Scheduler_Stats const *featherWing_OLED_frame_stats( void );
+
 #endif /* _ADAFRUIT_FEATHERWING_OLED_H_ */
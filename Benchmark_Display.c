@@ -0,0 +1,410 @@
+/**     \file   Benchmark_Display.c
+
+        \brief  Implementation of a benchmark for the display stack: drawing speed and bus traffic of typical workloads
+ 
+        \license 
+                MIT: The MIT License (https://opensource.org/licenses/MIT)
+                .
+                Permission is hereby granted, free of charge, to any person obtaining a copy of this software 
+                and associated documentation files (the "Software"), to deal in the Software without restriction, 
+                including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+                and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, 
+                subject to the following conditions:
+                .
+                The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+                .
+                THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+                INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. 
+                IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+                WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR 
+                THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ 
+        \copyright
+                DIT: 2026; Drechsler Information Technologies; www.drechsler-it.de
+ 
+        \authors
+                jrgdre: Joerg Drechsler; DIT
+ 
+        \versions
+                1.0.0: 2026-10-17 jrgdre initial release
+
+ */
+#include <stdio.h>                      // printf
+#include <string.h>                     // memset
+#include "Benchmark_Display.h"          // benchmark interface
+#include "Com_Driver_Recorder.h"        // bus traffic recorder
+#include "Draw.h"                       // drawing primitives
+#include "Draw_Fill_TestPattern.h"      // fill test pattern
+#include "Draw_Line_TestPattern.h"      // line test pattern
+#include "Font.h"                       // general font declarations
+#include "Font_06px.h"                  // 6px font
+#include "Font_08px.h"                  // 8px font
+#include "Font_Text_Field.h"            // text field
+#include "Framebuffer_SSD1306.h"        // SSD1306 framebuffer
+
+// ===========================================================================
+//  private
+// ===========================================================================
+
+/**
+ * \brief State of a benchmark run
+ *
+ * The framebuffer functions are replaced by counting ones, that call the original implementation.
+ */
+struct Benchmark_Display {
+        struct SSD1306                   ssd1306   ; //< controller the updates are planned for
+        struct Com_Driver_Recorder       recorder  ; //< records the traffic of the updates
+        struct Framebuffer              *fb        ; //< framebuffer drawn to
+        struct Framebuffer               fb_org    ; //< original framebuffer functions
+        Benchmark_Display_Clock         *clock     ; //< micro second counter (NULL: none)
+        struct Benchmark_Display_Result *result    ; //< result of the running workload
+        uint32_t                         time_start; //< clock at the start of the running workload
+};
+
+static struct Benchmark_Display benchmark; //< state of the running benchmark, the counting functions only get the framebuffer
+
+static enum status_code counting_set_pixel (
+  struct Framebuffer *fb, uint32_t x, uint32_t y, uint32_t pixel_value
+){
+        benchmark.result->pixels++;
+        return benchmark.fb_org.set_pixel( fb, x, y, pixel_value );
+};
+
+static enum status_code counting_fill_hspan (
+  struct Framebuffer *fb, uint32_t x, uint32_t y, uint32_t width, uint32_t pixel_value
+){
+        benchmark.result->pixels += width;
+        return benchmark.fb_org.fill_hspan( fb, x, y, width, pixel_value );
+};
+
+static enum status_code counting_fill_vspan (
+  struct Framebuffer *fb, uint32_t x, uint32_t y, uint32_t height, uint32_t pixel_value
+){
+        benchmark.result->pixels += height;
+        return benchmark.fb_org.fill_vspan( fb, x, y, height, pixel_value );
+};
+
+static enum status_code counting_fill_rect (
+  struct Framebuffer *fb, uint32_t x, uint32_t y, uint32_t width, uint32_t height, uint32_t pixel_value
+){
+        benchmark.result->pixels += width * height;
+        return benchmark.fb_org.fill_rect( fb, x, y, width, height, pixel_value );
+};
+
+static enum status_code counting_blit (
+  struct Framebuffer *fb, uint32_t x, uint32_t y, uint32_t width, uint32_t height, 
+  uint8_t const *bitmap, uint32_t stride, uint32_t pixel_value, bool opaque
+){
+        benchmark.result->pixels += width * height;
+        return benchmark.fb_org.blit( fb, x, y, width, height, bitmap, stride, pixel_value, opaque );
+};
+
+static enum status_code counting_blit_columns (
+  struct Framebuffer *fb, uint32_t x, uint32_t y, uint32_t width, uint32_t height, 
+  uint8_t const *columns, uint32_t pixel_value, bool opaque
+){
+        benchmark.result->pixels += width * height;
+        return benchmark.fb_org.blit_columns( fb, x, y, width, height, columns, pixel_value, opaque );
+};
+
+static enum status_code counting_copy_rect (
+  struct Framebuffer *fb, uint32_t x_src, uint32_t y_src, uint32_t width, uint32_t height, uint32_t x_dst, uint32_t y_dst
+){
+        benchmark.result->pixels += width * height;
+        return benchmark.fb_org.copy_rect( fb, x_src, y_src, width, height, x_dst, y_dst );
+};
+
+/**
+ * \brief Start a workload: reset the recorder and take the start time
+ */
+static void workload_begin (
+  struct Benchmark_Display_Result *const result         //< result of the workload to start
+, char                      const *const name           //< name of the workload
+){
+        memset( result, 0x00, sizeof( *result ) );
+        result->name     = name;
+        benchmark.result = result;
+        
+        com_driver_recorder_reset( &benchmark.recorder );
+        benchmark.time_start = benchmark.clock ? benchmark.clock() : 0;
+};
+
+/**
+ * \brief End a workload: take the time and the bus traffic
+ */
+static void workload_end (
+  void
+){
+        struct Benchmark_Display_Result *result = benchmark.result;
+        
+        result->time_us      = benchmark.clock ? benchmark.clock() - benchmark.time_start : 0;
+        result->transactions = benchmark.recorder.transactions;
+        result->bytes        = benchmark.recorder.bytes;
+        result->stops        = benchmark.recorder.stops;
+};
+
+/**
+ * \brief Update the display and count the frame
+ */
+static enum status_code workload_update (
+  void
+){
+        benchmark.result->frames++;
+        return ssd1306_display_update( &benchmark.ssd1306, benchmark.fb );
+};
+
+/**
+ * \brief Update the display after a line of the line test pattern was drawn
+ */
+static enum status_code workload_line_present (
+  struct Framebuffer *framebuffer       //< framebuffer the line was drawn to
+){
+        UNUSED( framebuffer );
+        
+        benchmark.result->primitives++;
+        return workload_update();
+};
+
+/**
+ * \brief Fill the screen with lines of text, then redraw it with one line changed, like a status screen
+ */
+static enum status_code workload_text (
+  struct Font const *const font //< font to use
+){
+        static char const *const lines[] = {
+                "Hello World!"              ,
+                "abcdefghijklmnopqrstuvwxyz",
+                "ABCDEFGHIJKLMNOPQRSTUVWXYZ",
+                "0123456789 @!$/\\"         ,
+                "-73db 192.168.1.1 DIT"     ,
+        };
+        static uint8_t const lines_count = sizeof( lines ) / sizeof( lines[0] );
+        
+        enum status_code status      = STATUS_OK;
+        uint8_t    const font_height = font->height;
+        uint16_t         string_width;
+        
+        for( uint_fast8_t frame = 0; ( status == STATUS_OK ) && ( frame < 8 ); frame++ ){
+                for( uint_fast16_t y = 0; ( status == STATUS_OK ) && ( y + font_height <= benchmark.fb->height ); y += font_height ){
+                        char const *string = lines[ ( ( y / font_height ) + ( y == 0 ? frame : 0 ) ) % lines_count ]; // first line changes every frame
+                        
+                        benchmark.result->primitives++;
+                        status = font_draw_string( benchmark.fb, font, string, 1, 0, y, FONT_BACKGROUND_OPAQUE, &string_width );
+                }
+                if( status == STATUS_OK ){
+                        status = workload_update();
+                }
+        }
+        
+        return status;
+};
+
+/**
+ * \brief Update a status line text field with a changing RSSI readout, an update per change
+ */
+static enum status_code workload_text_field (
+  void
+){
+        static char status_line[] = "-60db 192.168.1.1 DIT";
+        
+        enum status_code       status = STATUS_OK;
+        struct Font_Text_Field field;
+        
+        font_text_field_init( &field, benchmark.fb, &font_06px, 1, 0, benchmark.fb->height - font_06px.height );
+        
+        for( uint_fast8_t rssi = 60; ( status == STATUS_OK ) && ( rssi < 92 ); rssi++ ){
+                status_line[1] = '0' + ( rssi / 10 );
+                status_line[2] = '0' + ( rssi % 10 );
+                
+                benchmark.result->primitives++;
+                status = font_text_field_update( &field, status_line );
+                if( status == STATUS_OK ){
+                        status = workload_update();
+                }
+        }
+        
+        return status;
+};
+
+/**
+ * \brief Scroll a line chart to the left by a pixel per sample and draw the new sample, an update per sample
+ */
+static enum status_code workload_chart (
+  void
+){
+        enum status_code status = STATUS_OK;
+        uint16_t   const x_max  = benchmark.fb->width  - 1;
+        uint16_t   const y_max  = benchmark.fb->height - 1;
+        uint16_t         y_prev = y_max;
+        
+        for( uint_fast16_t sample = 0; ( status == STATUS_OK ) && ( sample < 64 ); sample++ ){
+                uint16_t y = ( sample * 5 ) % ( y_max << 1 );  // triangle wave over the height of the chart
+                
+                y = y > y_max ? ( y_max << 1 ) - y : y;
+                
+                benchmark.result->primitives++;
+                status = framebuffer_scroll_rect( benchmark.fb, 0, 0, x_max + 1, y_max + 1, -1, 0, 0 );
+                if( status == STATUS_OK ){
+                        status = draw_line( benchmark.fb, 1, x_max - 1, y_prev, x_max, y );
+                }
+                if( status == STATUS_OK ){
+                        status = workload_update();
+                }
+                y_prev = y;
+        }
+        
+        return status;
+};
+
+// ===========================================================================
+//  public
+// ===========================================================================
+
+/**
+ * \asserts results != NULL
+ */
+enum status_code benchmark_display_run (
+  enum SSD1306_Geometry            const  geometry      //< geometry of the display to benchmark
+, Benchmark_Display_Clock               *const clock         //< micro second counter (NULL: don't measure time)
+, struct Benchmark_Display_Result       *const results       //< [out] results of the workloads
+,                         uint8_t        const results_max   //< size of results
+){
+        Assert( results != NULL );
+        
+        enum status_code status = STATUS_OK;
+        
+        if( results_max < BENCHMARK_DISPLAY_WORKLOADS ){
+                return STATUS_ERR_INVALID_ARG;
+        }
+        
+        memset( &benchmark, 0x00, sizeof( benchmark ) );
+        benchmark.clock            = clock;
+        benchmark.ssd1306.geometry = geometry;
+        com_driver_recorder_init( &benchmark.ssd1306.com_driver, &benchmark.recorder ); // a sink, no bus attached
+        
+        benchmark.fb = framebuffer_SSD1306_create( SSD1306_COLUMNS, geometry );
+        if( benchmark.fb == NULL ){
+                return STATUS_ERR_NO_MEMORY;
+        }
+        
+        benchmark.fb_org           = *benchmark.fb;
+        benchmark.fb->set_pixel    = counting_set_pixel   ;
+        benchmark.fb->fill_hspan   = counting_fill_hspan  ;
+        benchmark.fb->fill_vspan   = counting_fill_vspan  ;
+        benchmark.fb->fill_rect    = counting_fill_rect   ;
+        benchmark.fb->blit         = counting_blit        ;
+        benchmark.fb->blit_columns = counting_blit_columns;
+        benchmark.fb->copy_rect    = counting_copy_rect   ;
+        
+        uint16_t x_max = benchmark.fb->width  - 1;
+        uint16_t y_max = benchmark.fb->height - 1;
+        
+        benchmark.fb->clear( benchmark.fb );
+        ssd1306_display_update( &benchmark.ssd1306, benchmark.fb ); // start with a display in sync
+        
+        workload_begin( &results[0], "line test pattern" );
+        status = draw_line_testpattern( benchmark.fb, 1, x_max >> 1, y_max >> 1, 0, 0, x_max, y_max, workload_line_present );
+        workload_end();
+        if( status != STATUS_OK ){
+                goto done;
+        }
+        
+        benchmark.fb->clear( benchmark.fb );
+        ssd1306_display_update( &benchmark.ssd1306, benchmark.fb );
+        
+        workload_begin( &results[1], "fill test pattern" );
+        results[1].primitives = 2;
+        status = draw_fill_testpattern( benchmark.fb, 1, 0, 0 );
+        if( status == STATUS_OK ){
+                status = draw_fill( benchmark.fb, 0, 1, 14, 7 );
+        }
+        if( status == STATUS_OK ){
+                status = workload_update();
+        }
+        workload_end();
+        if( status != STATUS_OK ){
+                goto done;
+        }
+        
+        workload_begin( &results[2], "text 6px" );
+        status = workload_text( &font_06px );
+        workload_end();
+        if( status != STATUS_OK ){
+                goto done;
+        }
+        
+        workload_begin( &results[3], "text 8px" );
+        status = workload_text( &font_08px );
+        workload_end();
+        if( status != STATUS_OK ){
+                goto done;
+        }
+        
+        workload_begin( &results[4], "full clear" );
+        results[4].primitives = 1;
+        results[4].pixels     = benchmark.fb->width * benchmark.fb->height;
+        status = benchmark.fb->clear( benchmark.fb );
+        if( status == STATUS_OK ){
+                status = workload_update();
+        }
+        workload_end();
+        if( status != STATUS_OK ){
+                goto done;
+        }
+        
+        workload_begin( &results[5], "text field" );
+        status = workload_text_field();
+        workload_end();
+        if( status != STATUS_OK ){
+                goto done;
+        }
+        
+        benchmark.fb->clear( benchmark.fb );
+        ssd1306_display_update( &benchmark.ssd1306, benchmark.fb );
+        
+        workload_begin( &results[6], "chart scroll" );
+        status = workload_chart();
+        workload_end();
+        
+done:
+        benchmark.fb->destroy( benchmark.fb );
+        benchmark.fb = NULL;
+        return status;
+};
+
+/**
+ * \asserts result != NULL
+ */
+void benchmark_display_report (
+  struct Benchmark_Display_Result const *const result   //< result to print
+){
+        Assert( result != NULL );
+        
+        uint32_t frames = result->frames > 0 ? result->frames : 1;
+        
+        printf( "%-18s frames %5lu  bytes/frame %5lu  tx/frame %4lu"
+              , result->name
+              , (unsigned long)result->frames
+              , (unsigned long)( ( result->bytes + result->transactions ) / frames ) // payload and address bytes on the wire
+              , (unsigned long)( result->transactions / frames )
+        );
+        
+        if( result->time_us > 0 ){
+                printf( "  pixels/s %8lu  primitives/s %7lu"
+                      , (unsigned long)( ( (uint64_t)result->pixels     * 1000000 ) / result->time_us )
+                      , (unsigned long)( ( (uint64_t)result->primitives * 1000000 ) / result->time_us )
+                );
+        }
+        
+        struct Com_Driver_Recorder recorded = {
+                .transactions = result->transactions,
+                .bytes        = result->bytes,
+                .stops        = result->stops,
+        };
+        
+        printf( "  I2C us/frame 100k %6lu  400k %6lu  1M %6lu\r\n"
+              , (unsigned long)( com_driver_recorder_i2c_time_us( &recorded,  100000 ) / frames )
+              , (unsigned long)( com_driver_recorder_i2c_time_us( &recorded,  400000 ) / frames )
+              , (unsigned long)( com_driver_recorder_i2c_time_us( &recorded, 1000000 ) / frames )
+        );
+};
@@ -0,0 +1,98 @@
+/**     \file   Benchmark_Display.h
+
+        \brief  Declarations of a benchmark for the display stack: drawing speed and bus traffic of typical workloads
+
+        \note   The benchmark only depends on the portable part of the display stack (framebuffer, drawing, fonts, SSD1306 driver)
+                and talks to a \ref Com_Driver_Recorder instead of a bus, so it runs on the target as well as on a host.
+                On the target \ref clock is a free running micro second counter (e.g. a TC or the RTC), on a host
+                it can be build with an asf.h providing enum status_code, Assert() and the stdint/stdbool types.
+ 
+        \license 
+                MIT: The MIT License (https://opensource.org/licenses/MIT)
+                .
+                Permission is hereby granted, free of charge, to any person obtaining a copy of this software 
+                and associated documentation files (the "Software"), to deal in the Software without restriction, 
+                including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+                and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, 
+                subject to the following conditions:
+                .
+                The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+                .
+                THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+                INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. 
+                IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+                WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR 
+                THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ 
+        \copyright
+                DIT: 2026; Drechsler Information Technologies; www.drechsler-it.de
+ 
+        \authors
+                jrgdre: Joerg Drechsler; DIT
+ 
+        \versions
+                1.0.0: 2026-10-17 jrgdre initial release
+
+ */
+#ifndef BENCHMARK_DISPLAY_H
+#define BENCHMARK_DISPLAY_H
+
+#include <asf.h>
+#include "SSD1306.h"
+
+typedef uint32_t Benchmark_Display_Clock( void ); //< get a free running micro second counter
+
+/**
+ * \brief Result of a benchmark workload
+ *
+ * \ref time_us covers drawing and planning the updates. Sending is recorded only, 
+ * its time on a real bus is modeled from the bus traffic (see \ref benchmark_display_report()).
+ */
+struct Benchmark_Display_Result {
+        char const *name        ; //< name of the workload
+        uint32_t    primitives  ; //< number of drawing primitives (lines, fills, strings, ...) drawn
+        uint32_t    pixels      ; //< number of pixels written through the framebuffer interface
+        uint32_t    frames      ; //< number of display updates
+        uint32_t    time_us     ; //< time spent drawing and updating (0: no clock)
+        uint32_t    transactions; //< bus transactions of all updates
+        uint32_t    bytes       ; //< payload bytes of all updates
+        uint32_t    stops       ; //< explicit STOP conditions of all updates
+};
+
+#define BENCHMARK_DISPLAY_WORKLOADS                     7       //< number of workloads run by \ref benchmark_display_run()
+
+/**
+ * \brief Run all benchmark workloads on a display of \ref geometry.
+ *
+ * Workloads:
+ * - line test pattern: the line sweep of \ref draw_line_testpattern(), updating the display after every line
+ * - fill test pattern: \ref draw_fill_testpattern() filled by \ref draw_fill(), one update
+ * - text 6px:          a screen full of 6px text, redrawn with one changed line, an update per redraw
+ * - text 8px:          the same with the 8px font
+ * - full clear:        clearing the framebuffer and sending it
+ * - text field:        a status line text field with a changing RSSI readout, an update per change
+ * - chart scroll:      a full screen line chart scrolled left by a pixel per sample, an update per sample
+ *
+ * \return Status of operation.
+ * \retval STATUS_OK                    If all workloads were run
+ * \retval STATUS_ERR_INVALID_ARG       If \ref results_max is less than \ref BENCHMARK_DISPLAY_WORKLOADS
+ * \retval STATUS_ERR_NO_MEMORY         If the framebuffer could not be created
+ */
+enum status_code benchmark_display_run (
+  enum SSD1306_Geometry            const  geometry      //< geometry of the display to benchmark
+, Benchmark_Display_Clock               *const clock         //< micro second counter (NULL: don't measure time)
+, struct Benchmark_Display_Result       *const results       //< [out] results of the workloads
+,                         uint8_t        const results_max   //< size of results
+);
+
+/**
+ * \brief Print a benchmark result with printf().
+ *
+ * Prints pixels/s and primitives/s (if there is a time), bus bytes per frame 
+ * and the modeled I2C bus time at 100 kHz, 400 kHz and 1 MHz.
+ */
+void benchmark_display_report (
+  struct Benchmark_Display_Result const *const result   //< result to print
+);
+
+#endif // BENCHMARK_DISPLAY_H
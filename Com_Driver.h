@@ -38,19 +38,36 @@ typedef             bool  Get_Send_Stop( void *const com_module );
 typedef             void  Set_Send_Stop( void *const com_module, bool const new_state );
 typedef             void  Send_Stop    ( void *const com_module );
 typedef enum status_code  Write_Wait   ( void *const com_module, uint16_t const address, uint8_t *const byte_array, uint16_t const cnt_bytes );
+typedef             void  Write_Done   ( void *const user_data, enum status_code const status );
+typedef enum status_code  Write_Async  ( void *const com_module, uint16_t const address, uint8_t *const byte_array, uint16_t const cnt_bytes, Write_Done *const on_done, void *const user_data );
+typedef             void  Set_Data_Command( void *const com_module, bool const data );
 
 /**
  * \brief Generic communication driver interface
  *
  * The struct allows to "overload" the generic Com_Driver functions
  * with specific functions.
+ *
+ * write_async is optional. If a driver supports it, it starts the write and returns at once.
+ * The byte_array has to stay valid until on_done is called with the status of the write,
+ * usually from interrupt context. on_done may start the next write.
+ *
+ * set_data_command is optional. Buses with a data/command line (e.g. 4-wire SPI) use it to select,
+ * if the following writes carry data or commands. Without it, the device expects a control byte 
+ * in front of every write instead (e.g. I2C).
+ *
+ * bus identifies the peripheral the writes go out on. Devices sharing a bus have the same bus,
+ * even if their com_module differs (e.g. SPI devices with their own chip select on one SERCOM).
  */
 struct Com_Driver {
-        void          *com_module   ; //< specific com channel hardware module reference
-        Get_Send_Stop *get_send_stop;
-        Set_Send_Stop *set_send_stop;
-        Send_Stop     *send_stop    ;
-        Write_Wait    *write_wait   ;
+        void             *com_module      ; //< specific com channel hardware module reference
+        void             *bus             ; //< peripheral the writes go out on, shared by the devices on it
+        Get_Send_Stop    *get_send_stop   ;
+        Set_Send_Stop    *set_send_stop   ;
+        Send_Stop        *send_stop       ;
+        Write_Wait       *write_wait      ;
+        Write_Async      *write_async     ; //< NULL, if the driver can't write asynchronously
+        Set_Data_Command *set_data_command; //< NULL, if the bus has no data/command line
 };
 
 #endif // COM_DRIVER_H
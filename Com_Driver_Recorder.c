@@ -0,0 +1,305 @@
+/** \file  Com_Driver_Recorder.c
+
+    \brief General Purpose Communication Driver implementation that records the traffic sent over it
+ 
+    \license 
+           MIT:        The MIT License (https://opensource.org/licenses/MIT)
+           .
+           Permission is hereby granted, free of charge, to any person obtaining a copy of this software 
+           and associated documentation files (the "Software"), to deal in the Software without restriction, 
+           including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+           and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, 
+           subject to the following conditions:
+           .
+           The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+           .
+           THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+           INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. 
+           IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+           WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR 
+           THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ 
+    \copyright
+           DIT: 2026; Drechsler Information Technologies; www.drechsler-it.de
+ 
+    \authors
+           jrgdre: Joerg Drechsler; DIT
+ 
+    \versions
+           1.0.0: 2026-10-17 initial release
+
+ */
+#include "Com_Driver_Recorder.h"
+
+// =================
+// private functions
+// =================
+
+/**
+ * Get the current state of the recorder's send_stop property
+ *
+ * \asserts com_module != NULL
+ */
+static bool com_driver_recorder_get_send_stop (
+  void *const com_module        //< com_module to get the state for
+){
+        Assert(com_module != NULL);
+        
+        struct Com_Driver_Recorder *recorder = (struct Com_Driver_Recorder*) com_module;
+        
+        if( recorder->downstream != NULL ){
+                return recorder->downstream->get_send_stop( recorder->downstream->com_module );
+        }
+        
+        return recorder->send_stop;
+};
+
+/**
+ * Set a new state for the recorder's send_stop property
+ *
+ * \asserts com_module != NULL
+ */
+static void com_driver_recorder_set_send_stop ( 
+  void *const com_module        //< com_module to set the state for
+, bool  const new_state         //< new state to set
+){
+        Assert(com_module != NULL);
+        
+        struct Com_Driver_Recorder *recorder = (struct Com_Driver_Recorder*) com_module;
+        
+        recorder->send_stop = new_state;
+        
+        if( recorder->downstream != NULL ){
+                recorder->downstream->set_send_stop( recorder->downstream->com_module, new_state );
+        }
+};
+
+/**
+ * Count a STOP condition and forward it
+ *
+ * \asserts com_module != NULL
+ */
+static void com_driver_recorder_send_stop ( 
+  void *const com_module        //< com_module to send stop signal with
+){
+        Assert(com_module != NULL);
+        
+        struct Com_Driver_Recorder *recorder = (struct Com_Driver_Recorder*) com_module;
+        
+        recorder->stops++;
+        
+        if( recorder->downstream != NULL ){
+                recorder->downstream->send_stop( recorder->downstream->com_module );
+        }
+};
+
+/**
+ * Count and capture a write transaction
+ */
+static void com_driver_recorder_record ( 
+  struct Com_Driver_Recorder *const recorder    //< recorder to record the write with
+,                    uint8_t *const byte_array  //< array of bytes written
+,                   uint16_t  const cnt_bytes   //< count of bytes written
+){
+        recorder->transactions++;
+        recorder->bytes += cnt_bytes;
+        
+        if( recorder->capture != NULL ){
+                for( uint_fast16_t idx = 0; idx < cnt_bytes; idx++ ){
+                        if( recorder->capture_length >= recorder->capture_size ){
+                                break; // capture buffer full, keep counting only
+                        }
+                        recorder->capture[ recorder->capture_length++ ] = byte_array[ idx ];
+                }
+        }
+};
+
+/**
+ * Count and capture a write transaction and forward it
+ *
+ * \return Status of operation.
+ * \retval STATUS_OK    If there is no downstream driver
+ * \retval any          Status returned by the downstream driver
+ *
+ * \asserts com_module != NULL
+ * \asserts byte_array != NULL
+ */
+static enum status_code com_driver_recorder_write_wait ( 
+  void     *const com_module    //< recorder to write through
+, uint16_t  const address       //< bus address of the device to write to
+, uint8_t  *const byte_array    //< array of bytes to write
+, uint16_t  const cnt_bytes     //< count of bytes to write
+){
+        Assert(com_module != NULL);
+        Assert(byte_array != NULL);
+        
+        struct Com_Driver_Recorder *recorder = (struct Com_Driver_Recorder*) com_module;
+        
+        com_driver_recorder_record( recorder, byte_array, cnt_bytes );
+        
+        if( recorder->downstream != NULL ){
+                return recorder->downstream->write_wait( recorder->downstream->com_module, address, byte_array, cnt_bytes );
+        }
+        
+        return STATUS_OK;
+};
+
+/**
+ * Count and capture a write transaction and forward it asynchronously
+ *
+ * Without a downstream driver the write stays pending until \ref com_driver_recorder_complete() is called.
+ *
+ * \return Status of operation.
+ * \retval STATUS_OK                    If the write was started (or is pending)
+ * \retval STATUS_BUSY                  If there is a pending write already
+ * \retval STATUS_ERR_UNSUPPORTED_DEV   If the downstream driver can't write asynchronously
+ * \retval any                          Status returned by the downstream driver
+ *
+ * \asserts com_module != NULL
+ * \asserts byte_array != NULL
+ * \asserts on_done    != NULL
+ */
+static enum status_code com_driver_recorder_write_async ( 
+  void       *const com_module      //< recorder to write through
+, uint16_t    const address         //< bus address of the device to write to
+, uint8_t    *const byte_array      //< array of bytes to write
+, uint16_t    const cnt_bytes       //< count of bytes to write
+, Write_Done *const on_done         //< called with the status of the write, when it is done
+, void       *const user_data       //< user data to pass to on_done
+){
+        Assert(com_module != NULL);
+        Assert(byte_array != NULL);
+        Assert(on_done    != NULL);
+        
+        struct Com_Driver_Recorder *recorder = (struct Com_Driver_Recorder*) com_module;
+        
+        if( recorder->downstream != NULL ){
+                if( recorder->downstream->write_async == NULL ){
+                        return STATUS_ERR_UNSUPPORTED_DEV;
+                }
+                com_driver_recorder_record( recorder, byte_array, cnt_bytes );
+                return recorder->downstream->write_async( recorder->downstream->com_module, address, byte_array, cnt_bytes, on_done, user_data );
+        }
+        
+        if( recorder->pending != NULL ){
+                return STATUS_BUSY;
+        }
+        
+        com_driver_recorder_record( recorder, byte_array, cnt_bytes );
+        recorder->pending      = on_done  ;
+        recorder->pending_data = user_data;
+        
+        return STATUS_OK;
+};
+
+/**
+ * Forward the selection of data or commands to the downstream driver
+ *
+ * \asserts com_module != NULL
+ */
+static void com_driver_recorder_set_data_command ( 
+  void *const com_module        //< recorder to select data or commands with
+, bool  const data              //< true: following writes carry data; false: commands
+){
+        Assert(com_module != NULL);
+        
+        struct Com_Driver_Recorder *recorder = (struct Com_Driver_Recorder*) com_module;
+        
+        if( recorder->downstream != NULL ){
+                recorder->downstream->set_data_command( recorder->downstream->com_module, data );
+        }
+};
+
+// ================
+// public functions
+// ================
+
+/**
+ * assign the recorder 
+ * - com_modul
+ * - driver functions
+ * to the generic com_driver data structure
+ */
+void com_driver_recorder_init(
+  struct Com_Driver          *com_driver        //< Com_Driver data structure to initialize
+, struct Com_Driver_Recorder *const recorder    //< recorder (com_module) to connect to
+){
+        Assert(com_driver != NULL);
+        Assert(recorder   != NULL);
+        
+        com_driver_recorder_reset( recorder );
+        
+        com_driver->com_module    = recorder                         ;
+        com_driver->bus           = ( recorder->downstream != NULL ) ? recorder->downstream->bus : recorder; // the bus recorded
+        com_driver->get_send_stop = com_driver_recorder_get_send_stop;
+        com_driver->set_send_stop = com_driver_recorder_set_send_stop;
+        com_driver->send_stop     = com_driver_recorder_send_stop    ;
+        com_driver->write_wait    = com_driver_recorder_write_wait   ;
+        com_driver->write_async   = com_driver_recorder_write_async  ;
+        
+        // look like the downstream bus: with a data/command line or with control bytes
+        if(( recorder->downstream                   != NULL )
+        && ( recorder->downstream->set_data_command != NULL )
+        ){
+                com_driver->set_data_command = com_driver_recorder_set_data_command;
+        } else {
+                com_driver->set_data_command = NULL;
+        }
+};
+
+/**
+ * \brief Reset all counters and the capture buffer of the recorder.
+ */
+void com_driver_recorder_reset(
+  struct Com_Driver_Recorder *const recorder    //< recorder to reset
+){
+        Assert(recorder != NULL);
+        
+        recorder->transactions   = 0;
+        recorder->bytes          = 0;
+        recorder->stops          = 0;
+        recorder->capture_length = 0;
+        recorder->pending        = NULL;
+        recorder->pending_data   = NULL;
+};
+
+/**
+ * \brief Complete the pending asynchronous write of a recorder without downstream driver.
+ */
+bool com_driver_recorder_complete(
+  struct Com_Driver_Recorder *const recorder    //< recorder to complete the pending write of
+,           enum status_code  const status      //< status to complete the write with
+){
+        Assert(recorder != NULL);
+        
+        Write_Done *on_done = recorder->pending;
+        
+        if( on_done == NULL ){
+                return false;
+        }
+        recorder->pending = NULL;                       // on_done may start the next write
+        
+        on_done( recorder->pending_data, status );
+        
+        return true;
+};
+
+/**
+ * \brief Get the modeled time in micro seconds the recorded traffic occupies an I2C bus.
+ */
+uint32_t com_driver_recorder_i2c_time_us(
+  struct Com_Driver_Recorder const *const recorder      //< recorder to get the bus time for
+,                         uint32_t  const bus_speed     //< bus clock frequency in Hz
+){
+        Assert(recorder != NULL);
+        
+        if( bus_speed == 0 ){
+                return 0;
+        }
+        
+        uint64_t clocks = ( (uint64_t)recorder->transactions * 10 )     // START + address byte + ACK
+                        + ( (uint64_t)recorder->bytes        *  9 )     // data byte + ACK
+                        + ( (uint64_t)recorder->stops             );    // STOP
+        
+        return (uint32_t)( ( clocks * 1000000 ) / bus_speed );
+};
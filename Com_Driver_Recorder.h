@@ -0,0 +1,113 @@
+/** \file  Com_Driver_Recorder.h
+
+    \brief General Purpose Communication Driver implementation that records the traffic sent over it
+ 
+    \license 
+           MIT:        The MIT License (https://opensource.org/licenses/MIT)
+           .
+           Permission is hereby granted, free of charge, to any person obtaining a copy of this software 
+           and associated documentation files (the "Software"), to deal in the Software without restriction, 
+           including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+           and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, 
+           subject to the following conditions:
+           .
+           The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+           .
+           THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+           INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. 
+           IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+           WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR 
+           THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ 
+    \copyright
+           DIT: 2026; Drechsler Information Technologies; www.drechsler-it.de
+ 
+    \authors
+           jrgdre: Joerg Drechsler; DIT
+ 
+    \versions
+           1.0.0: 2026-10-17 initial release
+
+ */
+#ifndef COM_DRIVER_RECORDER_H
+#define COM_DRIVER_RECORDER_H
+
+#include <asf.h>                // it's an Atmel Software Foundation project
+#include "Com_Driver.h"         // based on the generic communication driver interface
+
+/**
+ * \brief Recording communication module
+ *
+ * The recorder counts the transactions and bytes written through it and 
+ * optionally keeps a copy of the written bytes in \ref capture.
+ * If a \ref downstream driver is assigned, every call is forwarded to it,
+ * so the recorder can be put in front of a real bus driver to measure
+ * the traffic a display update causes on the target.
+ * Without a downstream driver it acts as a sink, which allows to measure
+ * the bus traffic of the display stack without any hardware attached.
+ * Asynchronous writes to the sink stay pending, until \ref com_driver_recorder_complete()
+ * completes them, like the interrupt of a real bus driver would.
+ */
+struct Com_Driver_Recorder {
+        struct Com_Driver *downstream    ; //< driver to forward calls to (NULL: discard all writes)
+        bool               send_stop     ; //< send_stop property, if there is no downstream driver
+        uint32_t           transactions  ; //< number of write transactions (packets) sent
+        uint32_t           bytes         ; //< number of payload bytes sent (without bus addresses)
+        uint32_t           stops         ; //< number of explicit STOP conditions sent
+        uint8_t           *capture       ; //< buffer to keep a copy of the bytes written (NULL: don't capture)
+        uint32_t           capture_size  ; //< size of the capture buffer in bytes
+        uint32_t           capture_length; //< number of bytes stored in the capture buffer
+        Write_Done        *pending       ; //< completion handler of the pending asynchronous write (NULL: none)
+        void              *pending_data  ; //< user data to pass to the completion handler
+};
+
+/**
+ * Initialize a general purpose Com_Driver data structure 
+ * with the recording com driver functions.
+ *
+ * Assign the \ref downstream driver before, so the recorder has a data/command line, if the downstream bus has one,
+ * and is on the same bus as the downstream driver.
+ *
+ * \asserts com_driver != NULL
+ * \asserts recorder   != NULL
+ */
+void com_driver_recorder_init(
+  struct Com_Driver          *com_driver        //< communication driver data structure to initialize
+, struct Com_Driver_Recorder *const recorder    //< recorder being used as com_module
+);
+
+/**
+ * Reset all counters and the capture buffer of the recorder.
+ *
+ * \asserts recorder != NULL
+ */
+void com_driver_recorder_reset(
+  struct Com_Driver_Recorder *const recorder    //< recorder to reset
+);
+
+/**
+ * Complete the pending asynchronous write of a recorder without downstream driver.
+ *
+ * Calls the completion handler of the write with \ref status, which may start the next write.
+ *
+ * \return Whether there was a pending write to complete.
+ *
+ * \asserts recorder != NULL
+ */
+bool com_driver_recorder_complete(
+  struct Com_Driver_Recorder *const recorder    //< recorder to complete the pending write of
+,           enum status_code  const status      //< status to complete the write with
+);
+
+/**
+ * Get the modeled time in micro seconds the recorded traffic occupies an I2C bus running at \ref bus_speed.
+ *
+ * Every transaction costs a START condition and the address byte (10 clocks), 
+ * every payload byte 9 clocks (8 data bits + ACK) and every STOP condition 1 clock.
+ */
+uint32_t com_driver_recorder_i2c_time_us(
+  struct Com_Driver_Recorder const *const recorder      //< recorder to get the bus time for
+,                         uint32_t  const bus_speed     //< bus clock frequency in Hz
+);
+
+#endif /* COM_DRIVER_RECORDER_H */
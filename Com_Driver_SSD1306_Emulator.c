@@ -0,0 +1,452 @@
+/**     \file   Com_Driver_SSD1306_Emulator.c
+
+        \brief  Implementation of a communication module, that emulates the display data RAM of a SSD1306.
+ 
+        \license 
+                MIT: The MIT License (https://opensource.org/licenses/MIT)
+                .
+                Permission is hereby granted, free of charge, to any person obtaining a copy of this software 
+                and associated documentation files (the "Software"), to deal in the Software without restriction, 
+                including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+                and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, 
+                subject to the following conditions:
+                .
+                The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+                .
+                THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+                INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. 
+                IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+                WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR 
+                THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ 
+        \copyright
+                DIT: 2026; Drechsler Information Technologies; www.drechsler-it.de
+ 
+        \authors
+                jrgdre: Joerg Drechsler; DIT
+ 
+        \versions
+                1.0.0: 2026-10-17 jrgdre initial release
+
+ */
+#include "Com_Driver_SSD1306_Emulator.h"
+
+// =================
+// private functions
+// =================
+
+/**
+ * Get the length of a command in bytes from its first byte
+ */
+static uint8_t com_driver_ssd1306_emulator_command_length ( 
+  uint8_t const command         //< first byte of the command
+){
+        switch( command ){
+        case SSD1306_SET_CONTINUOUS_HSCROLL_RIGHT           :
+        case SSD1306_SET_CONTINUOUS_HSCROLL_LEFT            :
+                return 7;
+        case SSD1306_SET_CONTINUOUS_HVSCROLL_RIGHT          :
+        case SSD1306_SET_CONTINUOUS_HVSCROLL_LEFT           :
+                return 6;
+        case SSD1306_SET_COLUMN_ADRESSES                    :
+        case SSD1306_SET_PAGE_ADRESSES                      :
+        case SSD1306_SET_VERTICAL_SCROLL_AREA               :
+                return 3;
+        case SSD1306_SET_MEMORY_ADRESSING_MODE              :
+        case SSD1306_SET_CONTRAST                           :
+        case SSD1306_SET_CHARGE_PUMP_SOURCE                 :
+        case SSD1306_SET_MULTIPLEX_RATIO                    :
+        case SSD1306_SET_DISPLAY_OFFSET                     :
+        case SSD1306_SET_DISPLAY_OSC_FREQ_AND_CLOCK_DIV     :
+        case SSD1306_SET_PRECHARGE_PERIODE                  :
+        case SSD1306_SET_COM_PINS_HARDWARE_CONFIGURATION    :
+        case SSD1306_SET_VCOMH_DESELECT_LEVEL               :
+                return 2;
+        default:
+                return 1;
+        }
+};
+
+/**
+ * Execute a command byte, once the command is complete
+ */
+static void com_driver_ssd1306_emulator_command ( 
+  struct Com_Driver_SSD1306_Emulator *const emulator    //< emulator to execute the command with
+,                            uint8_t  const byte        //< command byte received
+){
+        uint8_t *command = emulator->command;
+        
+        command[ emulator->command_length++ ] = byte;
+        
+        if( emulator->command_length < com_driver_ssd1306_emulator_command_length( command[0] ) ){
+                return; // wait for the arguments
+        }
+        emulator->command_length = 0;
+        emulator->commands++;
+        
+        if( command[0] == SSD1306_SET_MEMORY_ADRESSING_MODE ){
+                emulator->addressing_mode = command[1] & 0x03;
+        } 
+        else if( command[0] == SSD1306_SET_COLUMN_ADRESSES ){
+                emulator->column_start = command[1] & 0x7F;
+                emulator->column_end   = command[2] & 0x7F;
+                emulator->column       = emulator->column_start;
+        } 
+        else if( command[0] == SSD1306_SET_PAGE_ADRESSES ){
+                emulator->page_start   = command[1] & 0x07;
+                emulator->page_end     = command[2] & 0x07;
+                emulator->page         = emulator->page_start;
+        } 
+        else if( ( command[0] & 0xF0 ) == SSD1306_SET_PAGE_ADRESSING_COLUMN_START_LOWER ){
+                emulator->column = ( emulator->column & 0xF0 ) | ( command[0] & 0x0F );
+        } 
+        else if( ( command[0] & 0xF0 ) == SSD1306_SET_PAGE_ADRESSING_COLUMN_START_HIGHER ){
+                emulator->column = ( ( command[0] & 0x07 ) << 4 ) | ( emulator->column & 0x0F );
+        } 
+        else if( ( command[0] & 0xF8 ) == SSD1306_SET_PAGE_ADRESSING_START_PAGE ){
+                emulator->page = command[0] & 0x07;
+        } 
+        else if( ( command[0] & 0xC0 ) == SSD1306_SET_DISPLAY_START_LINE ){
+                emulator->start_line = command[0] & 0x3F;
+        }
+        else if( ( command[0] & 0xFE ) == SSD1306_SET_SEGMENT_NORMAL ){
+                emulator->segment_remap = command[0] == SSD1306_SET_SEGMENT_REMAP;
+        }
+        else if( ( command[0] & 0xF7 ) == SSD1306_SET_COM_OUTPUT_DIRECTION_NORMAL ){
+                emulator->com_remap = command[0] == SSD1306_SET_COM_OUTPUT_DIRECTION_REMAP;
+        }
+};
+
+/**
+ * Write a data byte to the display data RAM and move on to the next address
+ */
+static void com_driver_ssd1306_emulator_data ( 
+  struct Com_Driver_SSD1306_Emulator *const emulator    //< emulator to write the data with
+,                            uint8_t  const byte        //< data byte received
+){
+        emulator->ram[ ( emulator->page * SSD1306_COLUMNS ) + emulator->column ] = byte;
+        emulator->data_bytes++;
+        
+        switch( emulator->addressing_mode ){
+        case 0: // horizontal: along the page, then to the next page
+                if( emulator->column != emulator->column_end ){
+                        emulator->column++;
+                        break;
+                }
+                emulator->column = emulator->column_start;
+                emulator->page   = ( emulator->page == emulator->page_end ) ? emulator->page_start : emulator->page + 1;
+                break;
+        case 1: // vertical: down the column, then to the next column
+                if( emulator->page != emulator->page_end ){
+                        emulator->page++;
+                        break;
+                }
+                emulator->page   = emulator->page_start;
+                emulator->column = ( emulator->column == emulator->column_end ) ? emulator->column_start : emulator->column + 1;
+                break;
+        default: // page: along the page, wrapping to its start
+                emulator->column = ( emulator->column + 1 ) & 0x7F;
+                break;
+        }
+};
+
+/**
+ * Execute the bytes of a write transaction: control bytes followed by commands or data on I2C,
+ * commands or data as the D/C line tells on SPI
+ */
+static void com_driver_ssd1306_emulator_execute ( 
+  struct Com_Driver_SSD1306_Emulator *const emulator    //< emulator to execute the write with
+,                            uint8_t *const byte_array  //< array of bytes written
+,                           uint16_t  const cnt_bytes   //< count of bytes written
+,                               bool  const dc          //< level of the D/C line during the write (SPI)
+){
+        uint_fast16_t idx = 0;
+        
+        emulator->transactions++;
+        if( cnt_bytes > emulator->write_length_max ){
+                emulator->write_length_max = cnt_bytes;
+        }
+        
+        if( emulator->data_command_line ){
+                if( dc ){
+                        emulator->writes_data++;
+                } else {
+                        emulator->writes_command++;
+                }
+                if( cnt_bytes < 1 ){
+                        emulator->errors++;     // nothing to write
+                }
+                for( ; idx < cnt_bytes; idx++ ){
+                        if( dc ){
+                                com_driver_ssd1306_emulator_data   ( emulator, byte_array[ idx ] );
+                        } else {
+                                com_driver_ssd1306_emulator_command( emulator, byte_array[ idx ] );
+                        }
+                }
+                return;
+        }
+        
+        if( cnt_bytes < 2 ){
+                emulator->errors++;     // a control byte needs something to control
+                return;
+        }
+        
+        while( idx < cnt_bytes ){
+                uint8_t control = byte_array[ idx++ ];
+                
+                if(( control & ~( SSD1306_CONTINUATION | SSD1306_DATA ) ) != 0 ){
+                        emulator->errors++;     // not a control byte
+                        return;
+                }
+                
+                bool data = ( control & SSD1306_DATA ) != 0;
+                
+                if( control & SSD1306_CONTINUATION ){
+                        if( idx >= cnt_bytes ){
+                                emulator->errors++;     // control byte without its byte
+                                return;
+                        }
+                        if( data ){
+                                com_driver_ssd1306_emulator_data   ( emulator, byte_array[ idx++ ] );
+                        } else {
+                                com_driver_ssd1306_emulator_command( emulator, byte_array[ idx++ ] );
+                        }
+                        continue;
+                }
+                
+                for( ; idx < cnt_bytes; idx++ ){ // the rest of the transaction is of the type given
+                        if( data ){
+                                com_driver_ssd1306_emulator_data   ( emulator, byte_array[ idx ] );
+                        } else {
+                                com_driver_ssd1306_emulator_command( emulator, byte_array[ idx ] );
+                        }
+                }
+        }
+};
+
+/**
+ * Get the current state of the emulator's send_stop property
+ *
+ * \asserts com_module != NULL
+ */
+static bool com_driver_ssd1306_emulator_get_send_stop (
+  void *const com_module        //< com_module to get the state for
+){
+        Assert(com_module != NULL);
+        
+        return ((struct Com_Driver_SSD1306_Emulator*) com_module)->send_stop;
+};
+
+/**
+ * Set a new state for the emulator's send_stop property
+ *
+ * \asserts com_module != NULL
+ */
+static void com_driver_ssd1306_emulator_set_send_stop ( 
+  void *const com_module        //< com_module to set the state for
+, bool  const new_state         //< new state to set
+){
+        Assert(com_module != NULL);
+        
+        ((struct Com_Driver_SSD1306_Emulator*) com_module)->send_stop = new_state;
+};
+
+/**
+ * A STOP condition ends the transaction, the controller keeps its state
+ *
+ * \asserts com_module != NULL
+ */
+static void com_driver_ssd1306_emulator_send_stop ( 
+  void *const com_module        //< com_module to send stop signal with
+){
+        Assert(com_module != NULL);
+};
+
+/**
+ * Execute a write transaction
+ *
+ * \return Status of operation.
+ * \retval STATUS_OK    Always
+ *
+ * \asserts com_module != NULL
+ * \asserts byte_array != NULL
+ */
+static enum status_code com_driver_ssd1306_emulator_write_wait ( 
+  void     *const com_module    //< emulator to write to
+, uint16_t  const address       //< bus address of the device to write to
+, uint8_t  *const byte_array    //< array of bytes to write
+, uint16_t  const cnt_bytes     //< count of bytes to write
+){
+        Assert(com_module != NULL);
+        Assert(byte_array != NULL);
+        UNUSED(address);
+        
+        struct Com_Driver_SSD1306_Emulator *emulator = (struct Com_Driver_SSD1306_Emulator*) com_module;
+        
+        com_driver_ssd1306_emulator_execute( emulator, byte_array, cnt_bytes, emulator->data_command );
+        
+        return STATUS_OK;
+};
+
+/**
+ * Start a write transaction, it is executed by \ref com_driver_ssd1306_emulator_complete()
+ *
+ * \return Status of operation.
+ * \retval STATUS_OK                    If the write is pending
+ * \retval STATUS_BUSY                  If there is a pending write already
+ *
+ * \asserts com_module != NULL
+ * \asserts byte_array != NULL
+ * \asserts on_done    != NULL
+ */
+static enum status_code com_driver_ssd1306_emulator_write_async ( 
+  void       *const com_module      //< emulator to write to
+, uint16_t    const address         //< bus address of the device to write to
+, uint8_t    *const byte_array      //< array of bytes to write
+, uint16_t    const cnt_bytes       //< count of bytes to write
+, Write_Done *const on_done         //< called with the status of the write, when it is done
+, void       *const user_data       //< user data to pass to on_done
+){
+        Assert(com_module != NULL);
+        Assert(byte_array != NULL);
+        Assert(on_done    != NULL);
+        UNUSED(address);
+        
+        struct Com_Driver_SSD1306_Emulator *emulator = (struct Com_Driver_SSD1306_Emulator*) com_module;
+        
+        if( emulator->pending != NULL ){
+                return STATUS_BUSY;
+        }
+        
+        emulator->pending_bytes  = byte_array;
+        emulator->pending_length = cnt_bytes ;
+        emulator->pending        = on_done   ;
+        emulator->pending_data   = user_data ;
+        emulator->pending_dc     = emulator->data_command;
+        
+        return STATUS_OK;
+};
+
+/**
+ * Set the level of the D/C line (SPI)
+ *
+ * \asserts com_module != NULL
+ */
+static void com_driver_ssd1306_emulator_set_data_command ( 
+  void *const com_module        //< emulator to set the D/C line of
+, bool  const data              //< true: data, false: commands
+){
+        Assert(com_module != NULL);
+        
+        struct Com_Driver_SSD1306_Emulator *emulator = (struct Com_Driver_SSD1306_Emulator*) com_module;
+        
+        if(( emulator->pending      != NULL )
+        && ( emulator->data_command != data )
+        ){
+                emulator->errors++;     // the bytes in flight would change their meaning
+        }
+        emulator->data_command = data;
+};
+
+// ================
+// public functions
+// ================
+
+/**
+ * assign the emulator 
+ * - com_modul
+ * - driver functions
+ * to the generic com_driver data structure
+ */
+void com_driver_ssd1306_emulator_init(
+  struct Com_Driver                  *com_driver        //< Com_Driver data structure to initialize
+, struct Com_Driver_SSD1306_Emulator *const emulator    //< emulator (com_module) to connect to
+){
+        Assert(com_driver != NULL);
+        Assert(emulator   != NULL);
+        
+        com_driver_ssd1306_emulator_reset( emulator );
+        emulator->data_command_line  = false;                                     // the wiring stays through a RESET
+        
+        com_driver->com_module       = emulator                                 ;
+        com_driver->bus              = emulator                                 ;
+        com_driver->get_send_stop    = com_driver_ssd1306_emulator_get_send_stop;
+        com_driver->set_send_stop    = com_driver_ssd1306_emulator_set_send_stop;
+        com_driver->send_stop        = com_driver_ssd1306_emulator_send_stop    ;
+        com_driver->write_wait       = com_driver_ssd1306_emulator_write_wait   ;
+        com_driver->write_async      = com_driver_ssd1306_emulator_write_async  ;
+        com_driver->set_data_command = NULL                                     ; // I2C: control bytes
+};
+
+/**
+ * assign the emulator and its driver functions for 4-wire SPI to the generic com_driver data structure
+ */
+void com_driver_ssd1306_emulator_init_spi(
+  struct Com_Driver                  *com_driver        //< Com_Driver data structure to initialize
+, struct Com_Driver_SSD1306_Emulator *const emulator    //< emulator (com_module) to connect to
+){
+        com_driver_ssd1306_emulator_init( com_driver, emulator );
+        
+        emulator->data_command_line  = true;
+        com_driver->set_data_command = com_driver_ssd1306_emulator_set_data_command; // SPI: D/C line
+};
+
+/**
+ * \brief Put the emulator into the state of the controller after RESET and clear its counters.
+ */
+void com_driver_ssd1306_emulator_reset(
+  struct Com_Driver_SSD1306_Emulator *const emulator    //< emulator to reset
+){
+        Assert(emulator != NULL);
+        
+        emulator->addressing_mode  = 2;         // page addressing mode
+        emulator->column_start     = 0;
+        emulator->column_end       = SSD1306_COLUMNS   - 1;
+        emulator->column           = 0;
+        emulator->page_start       = 0;
+        emulator->page_end         = SSD1306_RAM_PAGES - 1;
+        emulator->page             = 0;
+        emulator->start_line       = 0;
+        emulator->segment_remap    = false;
+        emulator->com_remap        = false;
+        emulator->command_length   = 0;
+        emulator->send_stop        = true;
+        emulator->data_command     = false;
+        emulator->writes_command   = 0;
+        emulator->writes_data      = 0;
+        emulator->transactions     = 0;
+        emulator->commands         = 0;
+        emulator->data_bytes       = 0;
+        emulator->write_length_max = 0;
+        emulator->errors           = 0;
+        emulator->pending_bytes    = NULL;
+        emulator->pending_length   = 0;
+        emulator->pending          = NULL;
+        emulator->pending_data     = NULL;
+        emulator->pending_dc       = false;
+};
+
+/**
+ * \brief Complete the pending asynchronous write of the emulator.
+ */
+bool com_driver_ssd1306_emulator_complete(
+  struct Com_Driver_SSD1306_Emulator *const emulator    //< emulator to complete the pending write of
+,                   enum status_code  const status      //< status to complete the write with
+){
+        Assert(emulator != NULL);
+        
+        Write_Done *on_done = emulator->pending;
+        
+        if( on_done == NULL ){
+                return false;
+        }
+        emulator->pending = NULL;                       // on_done may start the next write
+        
+        if( status == STATUS_OK ){
+                com_driver_ssd1306_emulator_execute( emulator, emulator->pending_bytes, emulator->pending_length, emulator->pending_dc );
+        }
+        
+        on_done( emulator->pending_data, status );
+        
+        return true;
+};
@@ -0,0 +1,134 @@
+/**     \file   Com_Driver_SSD1306_Emulator.h
+
+        \brief  Declarations of a communication module, that emulates the display data RAM of a SSD1306.
+ 
+        \license 
+                MIT: The MIT License (https://opensource.org/licenses/MIT)
+                .
+                Permission is hereby granted, free of charge, to any person obtaining a copy of this software 
+                and associated documentation files (the "Software"), to deal in the Software without restriction, 
+                including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+                and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, 
+                subject to the following conditions:
+                .
+                The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+                .
+                THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+                INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. 
+                IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+                WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR 
+                THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ 
+        \copyright
+                DIT: 2026; Drechsler Information Technologies; www.drechsler-it.de
+ 
+        \authors
+                jrgdre: Joerg Drechsler; DIT
+ 
+        \versions
+                1.0.0: 2026-10-17 jrgdre initial release
+
+ */
+#ifndef COM_DRIVER_SSD1306_EMULATOR_H
+#define COM_DRIVER_SSD1306_EMULATOR_H
+
+#include <asf.h>                // it's an Atmel Software Foundation project
+#include "Com_Driver.h"         // based on the generic communication driver interface
+#include "SSD1306.h"            // commands and control bytes emulated
+
+/**
+ * \brief Communication module emulating a SSD1306 on I2C or 4-wire SPI
+ *
+ * On I2C the emulator decodes the control bytes, commands and data written to it like the controller does,
+ * on 4-wire SPI (see \ref com_driver_ssd1306_emulator_init_spi()) the level of the D/C line tells them apart
+ * and 
+ * and keeps the display data RAM, so the result of a byte stream can be checked without a display.
+ * The addressing modes, the column and page range and the page addressing commands are emulated,
+ * the segment and COM remap are kept, the other commands are counted and skipped with their arguments.
+ * Put it \ref Com_Driver_Recorder::downstream of a recorder to count the traffic as well.
+ * Asynchronous writes stay pending, until \ref com_driver_ssd1306_emulator_complete() 
+ * completes them, like the interrupt of a real bus driver would.
+ * Changing the D/C line while a write is pending is an error, it would change the meaning of the bytes in flight.
+ */
+struct Com_Driver_SSD1306_Emulator {
+        uint8_t     ram[SSD1306_RAM_PAGES * SSD1306_COLUMNS]; //< display data RAM, page by page
+        uint8_t     addressing_mode     ; //< memory addressing mode (0: horizontal, 1: vertical, 2: page)
+        uint8_t     column_start        ; //< column range start address
+        uint8_t     column_end          ; //< column range end address
+        uint8_t     column              ; //< column the next data byte is written to
+        uint8_t     page_start          ; //< page range start address
+        uint8_t     page_end            ; //< page range end address
+        uint8_t     page                ; //< page the next data byte is written to
+        uint8_t     start_line          ; //< display start line
+        bool        segment_remap       ; //< columns mirrored (column 127 is mapped to SEG0)
+        bool        com_remap           ; //< rows mirrored (COM scan from COM[N-1] to COM0)
+        uint8_t     command[7]          ; //< command being received
+        uint8_t     command_length      ; //< number of bytes of the command received
+        bool        send_stop           ; //< send_stop property
+        bool        data_command_line   ; //< 4-wire SPI: the D/C line selects commands or data, no control bytes
+        bool        data_command        ; //< level of the D/C line (true: data)
+        uint32_t    writes_command      ; //< number of writes with the D/C line low (SPI)
+        uint32_t    writes_data         ; //< number of writes with the D/C line high (SPI)
+        uint32_t    transactions        ; //< number of write transactions received
+        uint32_t    commands            ; //< number of commands executed
+        uint32_t    data_bytes          ; //< number of bytes written to the display data RAM
+        uint16_t    write_length_max    ; //< longest write transaction received
+        uint32_t    errors              ; //< writes breaking the control byte protocol
+        uint8_t    *pending_bytes       ; //< bytes of the pending asynchronous write
+        uint16_t    pending_length      ; //< number of bytes of the pending asynchronous write
+        Write_Done *pending             ; //< completion handler of the pending asynchronous write (NULL: none)
+        void       *pending_data        ; //< user data to pass to the completion handler
+        bool        pending_dc          ; //< level of the D/C line the pending write started with
+};
+
+/**
+ * Initialize a general purpose Com_Driver data structure 
+ * with the emulator com driver functions and reset the emulator.
+ *
+ * \asserts com_driver != NULL
+ * \asserts emulator   != NULL
+ */
+void com_driver_ssd1306_emulator_init(
+  struct Com_Driver                  *com_driver        //< communication driver data structure to initialize
+, struct Com_Driver_SSD1306_Emulator *const emulator    //< emulator being used as com_module
+);
+
+/**
+ * Initialize a general purpose Com_Driver data structure 
+ * with the emulator com driver functions for 4-wire SPI and reset the emulator.
+ *
+ * \asserts com_driver != NULL
+ * \asserts emulator   != NULL
+ */
+void com_driver_ssd1306_emulator_init_spi(
+  struct Com_Driver                  *com_driver        //< communication driver data structure to initialize
+, struct Com_Driver_SSD1306_Emulator *const emulator    //< emulator being used as com_module
+);
+
+/**
+ * Put the emulator into the state of the controller after RESET and clear its counters.
+ *
+ * The display data RAM is left alone, like it is on the controller.
+ *
+ * \asserts emulator != NULL
+ */
+void com_driver_ssd1306_emulator_reset(
+  struct Com_Driver_SSD1306_Emulator *const emulator    //< emulator to reset
+);
+
+/**
+ * Complete the pending asynchronous write of the emulator.
+ *
+ * The bytes of the write are executed, if \ref status is STATUS_OK, 
+ * then the completion handler of the write is called with \ref status, which may start the next write.
+ *
+ * \return Whether there was a pending write to complete.
+ *
+ * \asserts emulator != NULL
+ */
+bool com_driver_ssd1306_emulator_complete(
+  struct Com_Driver_SSD1306_Emulator *const emulator    //< emulator to complete the pending write of
+,                   enum status_code  const status      //< status to complete the write with
+);
+
+#endif /* COM_DRIVER_SSD1306_EMULATOR_H */
@@ -137,6 +137,140 @@ static enum status_code com_driver_i2c_master_write_wait (
         return status;
 };
 
+#if I2C_MASTER_CALLBACK_MODE == true
+
+/**
+ * \brief Asynchronous write job of an i2c master module
+ *
+ * The ASF i2c master callbacks only get the module passed in,
+ * so the completion handler of the running write is looked up by module.
+ */
+struct Com_Driver_I2c_Master_Job {
+        struct i2c_master_module *module   ; //< module the job runs on (NULL: slot unused)
+        Write_Done               *on_done  ; //< completion handler of the running write
+        void                     *user_data; //< user data to pass to on_done
+};
+
+static struct Com_Driver_I2c_Master_Job jobs[SERCOM_INST_NUM]; //< at most one job per SERCOM
+
+/**
+ * Get the job slot of com_module, claiming a free one on first use
+ *
+ * \return Job slot of the module, NULL if all slots are in use.
+ */
+static struct Com_Driver_I2c_Master_Job *com_driver_i2c_master_job_get (
+  struct i2c_master_module *const com_module    //< module to get the job slot for
+){
+        struct Com_Driver_I2c_Master_Job *free_job = NULL;
+        
+        for( uint_fast8_t idx = 0; idx < SERCOM_INST_NUM; idx++ ){
+                if( jobs[idx].module == com_module ){
+                        return &jobs[idx];
+                }
+                if(( jobs[idx].module == NULL )
+                && ( free_job         == NULL )
+                ){
+                        free_job = &jobs[idx];
+                }
+        }
+        
+        return free_job;
+};
+
+/**
+ * i2c master callback for WRITE_COMPLETE and ERROR: 
+ * hand the result of the write to the completion handler of the job
+ */
+static void com_driver_i2c_master_on_write_done (
+  struct i2c_master_module *const com_module    //< module the write finished on
+){
+        struct Com_Driver_I2c_Master_Job *job = com_driver_i2c_master_job_get( com_module );
+        
+        if(( job          == NULL )
+        || ( job->on_done == NULL )
+        ){
+                return;
+        }
+        
+        Write_Done *on_done = job->on_done;
+        job->on_done        = NULL;                                     // on_done may start the next write
+        
+        on_done( job->user_data, i2c_master_get_job_status( com_module ) );
+};
+
+/**
+ * start sending bytes over i2c using the com_module and return at once
+ *
+ * The module's WRITE_COMPLETE and ERROR callbacks are registered on first use.
+ *
+ * \return Status of operation.
+ * \retval STATUS_OK                    If the write was started
+ * \retval STATUS_BUSY                  If master module is busy with a job
+ * \retval STATUS_ERR_NO_MEMORY         If more modules are used than there are SERCOMs
+ *
+ * \asserts com_module != NULL
+ * \asserts byte_array != NULL
+ * \asserts on_done    != NULL
+ */
+static enum status_code com_driver_i2c_master_write_async ( 
+  void       *const com_module      //< communication module the SSD1306 is connected to
+, uint16_t    const address         //< I2C address the SSD1306 listens to 
+, uint8_t    *const byte_array      //< array of bytes to write, valid until on_done is called
+, uint16_t    const cnt_bytes       //< count of bytes to write
+, Write_Done *const on_done         //< called with the status of the write, when it is done
+, void       *const user_data       //< user data to pass to on_done
+){
+        Assert(com_module != NULL);
+        Assert(byte_array != NULL);
+        Assert(on_done    != NULL);
+        
+        enum status_code                  status         = STATUS_ERR_INVALID_ARG;
+        struct i2c_master_module         *com_module_i2c = (struct i2c_master_module*) com_module;
+        struct Com_Driver_I2c_Master_Job *job            = com_driver_i2c_master_job_get( com_module_i2c );
+        
+        if( job == NULL ){
+                return STATUS_ERR_NO_MEMORY;
+        }
+        if( job->on_done != NULL ){
+                return STATUS_BUSY;
+        }
+        
+        if( job->module == NULL ){                                      // first use of this module
+                job->module = com_module_i2c;
+                i2c_master_register_callback( com_module_i2c, com_driver_i2c_master_on_write_done, I2C_MASTER_CALLBACK_WRITE_COMPLETE );
+                i2c_master_register_callback( com_module_i2c, com_driver_i2c_master_on_write_done, I2C_MASTER_CALLBACK_ERROR          );
+                i2c_master_enable_callback  ( com_module_i2c, I2C_MASTER_CALLBACK_WRITE_COMPLETE );
+                i2c_master_enable_callback  ( com_module_i2c, I2C_MASTER_CALLBACK_ERROR          );
+        }
+        
+        // the packet is copied into the module by the job functions, so it can live on the stack
+        struct i2c_master_packet packet = {
+                .address         = address,
+                .data_length     = cnt_bytes,
+                .data            = byte_array,
+                .ten_bit_address = false,
+                .high_speed      = false,
+                .hs_master_code  = 0x0
+        };
+        
+        job->on_done   = on_done  ;
+        job->user_data = user_data;
+        
+        if( com_module_i2c->send_stop ) {
+                status = i2c_master_write_packet_job( com_module_i2c, &packet );
+        } else {
+                status = i2c_master_write_packet_job_no_stop( com_module_i2c, &packet );
+        }
+        
+        if( status != STATUS_OK ){
+                job->on_done = NULL;                                    // the write didn't start, there won't be a callback
+        }
+        
+        return status;
+};
+
+#endif // I2C_MASTER_CALLBACK_MODE
+
 // ================
 // public functions
 // ================
@@ -154,8 +288,15 @@ void com_driver_i2c_master_init(
         Assert(com_driver != NULL);
         
         com_driver->com_module    = com_module                         ;
+        com_driver->bus           = com_module                         ; // the SERCOM, shared by all its devices
         com_driver->get_send_stop = com_driver_i2c_master_get_send_stop;
         com_driver->set_send_stop = com_driver_i2c_master_set_send_stop;
         com_driver->send_stop     = com_driver_i2c_master_send_stop    ;
         com_driver->write_wait    = com_driver_i2c_master_write_wait   ;
+#if I2C_MASTER_CALLBACK_MODE == true
+        com_driver->write_async   = com_driver_i2c_master_write_async  ;
+#else
+        com_driver->write_async   = NULL                               ;
+#endif
+        com_driver->set_data_command = NULL                            ; // the SSD1306 expects a control byte on i2c
 };
@@ -0,0 +1,333 @@
+/** \file  Com_Driver_spi_master.c
+
+    \brief General Purpose Communication Driver implementation for a SERCOM SPI master with a data/command line
+ 
+    \license 
+           MIT:        The MIT License (https://opensource.org/licenses/MIT)
+           .
+           Permission is hereby granted, free of charge, to any person obtaining a copy of this software 
+           and associated documentation files (the "Software"), to deal in the Software without restriction, 
+           including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+           and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, 
+           subject to the following conditions:
+           .
+           The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+           .
+           THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+           INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. 
+           IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+           WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR 
+           THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ 
+    \copyright
+           DIT: 2026; Drechsler Information Technologies; www.drechsler-it.de
+ 
+    \authors
+           jrgdre: Joerg Drechsler; DIT
+ 
+    \versions
+           1.0.0: 2026-10-17 initial release
+
+ */
+#include "Com_Driver_spi_master.h"
+
+// =================
+// private functions
+// =================
+
+/**
+ * Get the current state of com_modul's send_stop property
+ *
+ * \return Status of the send_stop property
+ * \retval true         device is deselected after a write
+ * \retval false        device stays selected after a write
+ *
+ * \asserts com_module != NULL
+ */
+static bool com_driver_spi_master_get_send_stop (
+  void *const com_module        //< com_module to get the state for
+){
+        Assert(com_module != NULL);
+        
+        struct Com_Driver_Spi_Master *com_module_spi = (struct Com_Driver_Spi_Master*) com_module;
+        
+        return com_module_spi->send_stop;
+};
+
+/**
+ * Set a new state for com_modul's send_stop property
+ *
+ * \asserts com_module != NULL
+ */
+static void com_driver_spi_master_set_send_stop ( 
+  void *const com_module        //< com_module to set the state for
+, bool  const new_state         //< new state to set
+){
+        Assert(com_module != NULL);
+        
+        struct Com_Driver_Spi_Master *com_module_spi = (struct Com_Driver_Spi_Master*) com_module;
+        
+        com_module_spi->send_stop = new_state;
+};
+
+/**
+ * Deselect the device, the SPI equivalent of an i2c STOP condition
+ *
+ * \asserts com_module != NULL
+ */
+static void com_driver_spi_master_send_stop ( 
+  void *const com_module        //< com_module to send stop signal with
+){
+        Assert(com_module != NULL);
+        
+        struct Com_Driver_Spi_Master *com_module_spi = (struct Com_Driver_Spi_Master*) com_module;
+        
+        spi_select_slave( com_module_spi->module, com_module_spi->slave, false );
+};
+
+/**
+ * Select, if the following writes carry data or commands
+ *
+ * Only call it between writes, the device samples the line with the last bit of every byte.
+ *
+ * \asserts com_module != NULL
+ */
+static void com_driver_spi_master_set_data_command ( 
+  void *const com_module        //< com_module to set the data/command line of
+, bool  const data              //< true: data (line high); false: commands (line low)
+){
+        Assert(com_module != NULL);
+        
+        struct Com_Driver_Spi_Master *com_module_spi = (struct Com_Driver_Spi_Master*) com_module;
+        
+        port_pin_set_output_level( com_module_spi->dc_pin, data );
+};
+
+/**
+ * send bytes over spi using the com_module in one burst
+ *
+ * \return Status of operation.
+ * \retval STATUS_OK                    If the bytes were written successfully
+ * \retval STATUS_ERR_TIMEOUT           If the SPI module timed out
+ * \retval STATUS_ERR_INVALID_ARG       If invalid argument(s) were provided
+ *
+ * \asserts com_module != NULL
+ * \asserts byte_array != NULL
+ */
+static enum status_code com_driver_spi_master_write_wait ( 
+  void     *const com_module    //< communication module the device is connected to
+, uint16_t  const address       //< ignored, the device is addressed by its chip select
+, uint8_t  *const byte_array    //< array of bytes to write
+, uint16_t  const cnt_bytes     //< count of bytes to write
+){
+        enum status_code status = STATUS_ERR_INVALID_ARG;
+
+        Assert(com_module != NULL);
+        Assert(byte_array != NULL);
+        
+        UNUSED(address);
+        
+        struct Com_Driver_Spi_Master *com_module_spi = (struct Com_Driver_Spi_Master*) com_module;
+        
+        spi_select_slave( com_module_spi->module, com_module_spi->slave, true );
+        
+        status = spi_write_buffer_wait( com_module_spi->module, byte_array, cnt_bytes ); // returns after the last bit left the shift register
+        
+        if(( com_module_spi->send_stop )
+        || ( status != STATUS_OK       )
+        ){
+                spi_select_slave( com_module_spi->module, com_module_spi->slave, false );
+        }
+        
+        return status;
+};
+
+#if SPI_CALLBACK_MODE == true
+
+/**
+ * \brief Asynchronous write running on a SERCOM
+ *
+ * Several devices (chip selects) may share a SERCOM, the ASF callbacks only get the spi module.
+ */
+struct Com_Driver_Spi_Master_Job {
+        struct spi_module            *module    ; //< SERCOM SPI master module of the slot (NULL: slot free)
+        struct Com_Driver_Spi_Master *running   ; //< com_module of the write running on the module (NULL: none)
+};
+
+static struct Com_Driver_Spi_Master_Job jobs[SERCOM_INST_NUM]; //< job slots, one per SERCOM in use
+
+static void com_driver_spi_master_on_write_done( struct spi_module *const spi_module );
+
+/**
+ * Get the job slot of spi_module, claiming a free one on first use
+ *
+ * The callbacks of the module are registered, when its slot is claimed.
+ *
+ * \return Job slot of the module, NULL if all slots are in use.
+ */
+static struct Com_Driver_Spi_Master_Job *com_driver_spi_master_job_get (
+  struct spi_module *const spi_module           //< module to get the job slot for
+,              bool  const claim                //< claim a free slot, if the module has none yet
+){
+        struct Com_Driver_Spi_Master_Job *free_job = NULL;
+        
+        for( uint_fast8_t idx = 0; idx < SERCOM_INST_NUM; idx++ ){
+                if( jobs[idx].module == spi_module ){
+                        return &jobs[idx];
+                }
+                if(( jobs[idx].module == NULL )
+                && ( free_job         == NULL )
+                ){
+                        free_job = &jobs[idx];
+                }
+        }
+        
+        if(( !claim           )
+        || ( free_job == NULL )
+        ){
+                return NULL;
+        }
+        
+        free_job->module  = spi_module;                                 // first use of this module
+        free_job->running = NULL;
+        spi_register_callback( spi_module, com_driver_spi_master_on_write_done, SPI_CALLBACK_BUFFER_TRANSMITTED );
+        spi_register_callback( spi_module, com_driver_spi_master_on_write_done, SPI_CALLBACK_ERROR              );
+        spi_enable_callback  ( spi_module, SPI_CALLBACK_BUFFER_TRANSMITTED );
+        spi_enable_callback  ( spi_module, SPI_CALLBACK_ERROR              );
+        
+        return free_job;
+};
+
+/**
+ * spi master callback for BUFFER_TRANSMITTED and ERROR: 
+ * release the device of the write and hand its result to the completion handler
+ */
+static void com_driver_spi_master_on_write_done (
+  struct spi_module *const spi_module           //< module the write finished on
+){
+        struct Com_Driver_Spi_Master_Job *job = com_driver_spi_master_job_get( spi_module, false );
+        
+        if(( job          == NULL )
+        || ( job->running == NULL )
+        ){
+                return;
+        }
+        
+        struct Com_Driver_Spi_Master *com_module_spi = job->running;
+        enum status_code              status         = spi_get_job_status( spi_module );
+        
+        if(( com_module_spi->send_stop )
+        || ( status != STATUS_OK       )
+        ){
+                spi_select_slave( spi_module, com_module_spi->slave, false ); // only the device of this write
+        }
+        
+        Write_Done *on_done       = com_module_spi->on_done;
+        com_module_spi->on_done   = NULL;
+        job->running              = NULL;                               // on_done may start the next write
+        
+        if( on_done != NULL ){
+                on_done( com_module_spi->user_data, status );
+        }
+};
+
+/**
+ * start sending bytes over spi using the com_module and return at once
+ *
+ * The module's BUFFER_TRANSMITTED and ERROR callbacks are registered on first use.
+ * Only one write runs on a SERCOM at a time, whichever device it is for.
+ *
+ * \return Status of operation.
+ * \retval STATUS_OK                    If the write was started
+ * \retval STATUS_BUSY                  If the spi module is busy with a write, no device is selected
+ * \retval STATUS_ERR_NO_MEMORY         If more modules are used than there are SERCOMs
+ *
+ * \asserts com_module != NULL
+ * \asserts byte_array != NULL
+ * \asserts on_done    != NULL
+ */
+static enum status_code com_driver_spi_master_write_async ( 
+  void       *const com_module      //< communication module the device is connected to
+, uint16_t    const address         //< ignored, the device is addressed by its chip select
+, uint8_t    *const byte_array      //< array of bytes to write, valid until on_done is called
+, uint16_t    const cnt_bytes       //< count of bytes to write
+, Write_Done *const on_done         //< called with the status of the write, when it is done
+, void       *const user_data       //< user data to pass to on_done
+){
+        Assert(com_module != NULL);
+        Assert(byte_array != NULL);
+        Assert(on_done    != NULL);
+        
+        UNUSED(address);
+        
+        enum status_code                  status         = STATUS_ERR_INVALID_ARG;
+        struct Com_Driver_Spi_Master     *com_module_spi = (struct Com_Driver_Spi_Master*) com_module;
+        struct Com_Driver_Spi_Master_Job *job            = com_driver_spi_master_job_get( com_module_spi->module, true );
+        
+        if( job == NULL ){
+                return STATUS_ERR_NO_MEMORY;
+        }
+        if( job->running != NULL ){
+                return STATUS_BUSY;                                     // before selecting, so only one device is selected
+        }
+        
+        job->running              = com_module_spi;                     // the device of this write, for the callback
+        com_module_spi->on_done   = on_done  ;
+        com_module_spi->user_data = user_data;
+        
+        spi_select_slave( com_module_spi->module, com_module_spi->slave, true );
+        
+        status = spi_write_buffer_job( com_module_spi->module, byte_array, cnt_bytes );
+        
+        if( status != STATUS_OK ){
+                com_module_spi->on_done = NULL;                         // the write didn't start, there won't be a callback
+                job->running            = NULL;
+                spi_select_slave( com_module_spi->module, com_module_spi->slave, false );
+        }
+        
+        return status;
+};
+
+#endif // SPI_CALLBACK_MODE
+
+// ================
+// public functions
+// ================
+
+/**
+ * assign the spi specific
+ * - com_modul
+ * - driver functions
+ * to the generic com_driver data structure
+ */
+void com_driver_spi_master_init(
+  struct Com_Driver            *com_driver      //< Com_Driver data structure to initialize
+, struct Com_Driver_Spi_Master *const com_module //< spi module (com_module) to connect to
+){
+        Assert(com_driver         != NULL);
+        Assert(com_module         != NULL);
+        Assert(com_module->module != NULL);
+        Assert(com_module->slave  != NULL);
+        
+        struct port_config config_port_pin;                             // pin configuration data structure
+        
+        port_get_config_defaults( &config_port_pin );                   // initialize data structure with default value
+        config_port_pin.direction = PORT_PIN_DIR_OUTPUT;                // set pin data direction to output
+        port_pin_set_config( com_module->dc_pin, &config_port_pin );    // set the new pin configuration for the port
+        
+        com_module->on_done   = NULL;
+        com_module->user_data = NULL;
+        
+        com_driver->com_module       = com_module                            ;
+        com_driver->bus              = com_module->module                    ; // the SERCOM, shared by all chip selects
+        com_driver->get_send_stop    = com_driver_spi_master_get_send_stop   ;
+        com_driver->set_send_stop    = com_driver_spi_master_set_send_stop   ;
+        com_driver->send_stop        = com_driver_spi_master_send_stop       ;
+        com_driver->write_wait       = com_driver_spi_master_write_wait      ;
+#if SPI_CALLBACK_MODE == true
+        com_driver->write_async      = com_driver_spi_master_write_async     ;
+#else
+        com_driver->write_async      = NULL                                  ;
+#endif
+        com_driver->set_data_command = com_driver_spi_master_set_data_command;
+};
@@ -0,0 +1,71 @@
+/** \file  Com_Driver_spi_master.h
+
+    \brief General Purpose Communication Driver implementation for a SERCOM SPI master with a data/command line
+ 
+    \license 
+           MIT:        The MIT License (https://opensource.org/licenses/MIT)
+           .
+           Permission is hereby granted, free of charge, to any person obtaining a copy of this software 
+           and associated documentation files (the "Software"), to deal in the Software without restriction, 
+           including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+           and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, 
+           subject to the following conditions:
+           .
+           The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+           .
+           THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+           INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. 
+           IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+           WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR 
+           THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ 
+    \copyright
+           DIT: 2026; Drechsler Information Technologies; www.drechsler-it.de
+ 
+    \authors
+           jrgdre: Joerg Drechsler; DIT
+ 
+    \versions
+           1.0.0: 2026-10-17 initial release
+
+ */
+#ifndef COM_DRIVER_SPI_MASTER_H
+#define COM_DRIVER_SPI_MASTER_H
+
+#include <asf.h>                // it's an Atmel Software Foundation project
+#include "Com_Driver.h"         // based on the generic communication driver interface
+
+/**
+ * \brief SPI communication module of a device with a data/command line (e.g. a SSD1306 in 4-wire SPI mode)
+ *
+ * The device is selected by \ref slave for every write. With \ref send_stop set, 
+ * it is deselected after the write, otherwise it stays selected until send_stop() is called.
+ * The bus address passed to the write functions is ignored, the chip select addresses the device.
+ * \ref dc_pin is driven low for commands and high for data.
+ */
+struct Com_Driver_Spi_Master {
+        struct spi_module     *module   ; //< SERCOM SPI master module the device is connected to
+        struct spi_slave_inst *slave    ; //< chip select of the device
+        uint8_t                dc_pin   ; //< GPIO pin of the data/command line
+        bool                   send_stop; //< deselect the device after a write
+        Write_Done            *on_done  ; //< completion handler of the running asynchronous write (NULL: none)
+        void                  *user_data; //< user data to pass to on_done
+};
+
+/**
+ * Initialize a general purpose Com_Driver data structure 
+ * with the specific spi com driver settings.
+ *
+ * \ref module and \ref slave have to be initialized already, \ref dc_pin is configured as output.
+ *
+ * \asserts com_driver         != NULL
+ * \asserts com_module         != NULL
+ * \asserts com_module->module != NULL
+ * \asserts com_module->slave  != NULL
+ */
+void com_driver_spi_master_init(
+  struct Com_Driver            *com_driver      //< communication driver data structure to initialize
+, struct Com_Driver_Spi_Master *const com_module //< spi communication module being used
+);
+
+#endif /* COM_DRIVER_SPI_MASTER_H */
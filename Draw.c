@@ -34,7 +34,105 @@
  */
 #include "Draw.h"
 #include "Framebuffer.h"
-#include "Stack.h"
+
+/**
+ * \brief Intersect the clip rectangle with the framebuffer
+ *
+ * \return false, if no pixel of the framebuffer is inside the clip rectangle
+ */
+static inline bool clip_bounds(
+  struct Framebuffer const *const framebuffer	// framebuffer to clip to
+, struct Draw_Clip   const *const clip		// clip rectangle (NULL: framebuffer only)
+, struct Draw_Clip         *const bounds	// [out] pixels inside both
+){
+        int32_t x_max = (int32_t)framebuffer->width  - 1;
+        int32_t y_max = (int32_t)framebuffer->height - 1;
+        
+        bounds->x_min = 0;
+        bounds->y_min = 0;
+        bounds->x_max = x_max > INT16_MAX ? INT16_MAX : x_max;
+        bounds->y_max = y_max > INT16_MAX ? INT16_MAX : y_max;
+        if( clip != NULL ){
+                if( clip->x_min > bounds->x_min ) bounds->x_min = clip->x_min;
+                if( clip->y_min > bounds->y_min ) bounds->y_min = clip->y_min;
+                if( clip->x_max < bounds->x_max ) bounds->x_max = clip->x_max;
+                if( clip->y_max < bounds->y_max ) bounds->y_max = clip->y_max;
+        }
+        
+        return ( bounds->x_min <= bounds->x_max ) && ( bounds->y_min <= bounds->y_max );
+}
+
+/**
+ * \brief Check, if any pixel of the rectangle [x0,y0], [x1,y1] is inside bounds
+ */
+static inline bool clip_overlaps(
+  struct Draw_Clip const *const bounds	// pixels to draw
+,          int32_t        const x0	// left   most column of the rectangle
+,          int32_t        const y0	// top    most row    of the rectangle
+,          int32_t        const x1	// right  most column of the rectangle
+,          int32_t        const y1	// bottom most row    of the rectangle
+){
+        return ( x1 >= bounds->x_min ) && ( x0 <= bounds->x_max )
+            && ( y1 >= bounds->y_min ) && ( y0 <= bounds->y_max );
+}
+
+/**
+ * \brief Set a pixel, if it is inside bounds
+ */
+static inline void clip_set_pixel(
+  struct Framebuffer       *const framebuffer	// framebuffer to draw to
+, Framebuffer_Set_Pixel    *const set_pixel	// set_pixel() of the framebuffer
+, struct Draw_Clip   const *const bounds	// pixels to draw
+,          int32_t          const x		// x position of the pixel
+,          int32_t          const y		// y position of the pixel
+,         uint32_t          const pixel_value	// value to set
+){
+        if(( x >= bounds->x_min ) && ( x <= bounds->x_max )
+        && ( y >= bounds->y_min ) && ( y <= bounds->y_max )
+        ){
+                set_pixel( framebuffer, x, y, pixel_value );
+        }
+}
+
+/**
+ * \brief Fill the part of the horizontal span [x0..x1] in row y, that is inside bounds
+ */
+static inline enum status_code clip_fill_hspan(
+  struct Framebuffer       *const framebuffer	// framebuffer to draw to
+, struct Draw_Clip   const *const bounds	// pixels to draw
+,          int32_t                x0		// left  most column of the span
+,          int32_t                x1		// right most column of the span
+,          int32_t          const y		// row of the span
+,         uint32_t          const pixel_value	// value to set
+){
+        if( x0 < bounds->x_min ) x0 = bounds->x_min;
+        if( x1 > bounds->x_max ) x1 = bounds->x_max;
+        if(( x0 > x1 ) || ( y < bounds->y_min ) || ( y > bounds->y_max )){
+                return STATUS_OK;
+        }
+        
+        return framebuffer_fill_hspan( framebuffer, x0, y, x1 - x0 + 1, pixel_value );
+}
+
+/**
+ * \brief Fill the part of the vertical span [y0..y1] in column x, that is inside bounds
+ */
+static inline enum status_code clip_fill_vspan(
+  struct Framebuffer       *const framebuffer	// framebuffer to draw to
+, struct Draw_Clip   const *const bounds	// pixels to draw
+,          int32_t          const x		// column of the span
+,          int32_t                y0		// top    most row of the span
+,          int32_t                y1		// bottom most row of the span
+,         uint32_t          const pixel_value	// value to set
+){
+        if( y0 < bounds->y_min ) y0 = bounds->y_min;
+        if( y1 > bounds->y_max ) y1 = bounds->y_max;
+        if(( y0 > y1 ) || ( x < bounds->x_min ) || ( x > bounds->x_max )){
+                return STATUS_OK;
+        }
+        
+        return framebuffer_fill_vspan( framebuffer, x, y0, y1 - y0 + 1, pixel_value );
+}
 
 /**
  * \brief Draw a circle around [x0,y0] with radius
@@ -42,9 +140,23 @@
 uint8_t draw_circle(
   struct Framebuffer *framebuffer       //< pointer to the framebuffer to draw the pixel to
 ,           uint32_t  pixel_value	//< value to set for the pixels
-,           uint16_t  x0		//< x start position of the line
-,           uint16_t  y0		//< y start position of the line
+,            int16_t  x0		//< x position of the midpoint
+,            int16_t  y0		//< y position of the midpoint
 ,           uint16_t  radius		//< radius in pixel to draw circle with
+){
+        return draw_circle_clipped( framebuffer, pixel_value, x0, y0, radius, NULL );
+}
+
+/**
+ * \brief Draw the pixels of a circle around [x0,y0] with radius, that are inside clip
+ */
+uint8_t draw_circle_clipped(
+  struct Framebuffer       *framebuffer	//< pointer to the framebuffer to draw the pixel to
+,           uint32_t        pixel_value	//< value to set for the pixels
+,            int16_t        x0		//< x position of the midpoint
+,            int16_t        y0		//< y position of the midpoint
+,           uint16_t        radius	//< radius in pixel to draw circle with
+, struct Draw_Clip   const *clip	//< pixels outside are not drawn (NULL: framebuffer)
 ){
 
         if( framebuffer == NULL ){
@@ -55,6 +167,29 @@ uint8_t draw_circle(
         }
 
         Framebuffer_Set_Pixel *set_pixel = framebuffer->set_pixel;
+        struct Draw_Clip       bounds;
+        
+        int32_t r = radius;
+        if(( !clip_bounds( framebuffer, clip, &bounds ) )
+        || ( !clip_overlaps( &bounds, x0 - r, y0 - r, x0 + r, y0 + r ) )
+        ){
+                return STATUS_OK; // nothing visible
+        }
+        
+        // Along its octant a pixel is at least r/2 and at most r away from the midpoint, 
+        // across at most 3/4 r + 1. Octants, whose box is not inside bounds, are skipped.
+        int32_t along  = r >> 1;
+        int32_t across = (( r * 3 ) >> 2 ) + 1;
+        uint8_t octants = 0;
+        
+        if( clip_overlaps( &bounds, x0 + along , y0          , x0 + r     , y0 + across )) octants |= 0x01;
+        if( clip_overlaps( &bounds, x0         , y0 + along  , x0 + across, y0 + r      )) octants |= 0x02;
+        if( clip_overlaps( &bounds, x0 - across, y0 + along  , x0         , y0 + r      )) octants |= 0x04;
+        if( clip_overlaps( &bounds, x0 - r     , y0          , x0 - along , y0 + across )) octants |= 0x08;
+        if( clip_overlaps( &bounds, x0 - r     , y0 - across , x0 - along , y0          )) octants |= 0x10;
+        if( clip_overlaps( &bounds, x0 - across, y0 - r      , x0         , y0 - along  )) octants |= 0x20;
+        if( clip_overlaps( &bounds, x0         , y0 - r      , x0 + across, y0 - along  )) octants |= 0x40;
+        if( clip_overlaps( &bounds, x0 + along , y0 - across , x0 + r     , y0          )) octants |= 0x80;
         
         int x	= radius;
         int y	= 0;
@@ -62,14 +197,20 @@ uint8_t draw_circle(
 
         while ( x >= y )
         {
-                set_pixel( framebuffer, x0 + x, y0 + y, pixel_value );
-                set_pixel( framebuffer, x0 + y, y0 + x, pixel_value );
-                set_pixel( framebuffer, x0 - y, y0 + x, pixel_value );
-                set_pixel( framebuffer, x0 - x, y0 + y, pixel_value );
-                set_pixel( framebuffer, x0 - x, y0 - y, pixel_value );
-                set_pixel( framebuffer, x0 - y, y0 - x, pixel_value );
-                set_pixel( framebuffer, x0 + y, y0 - x, pixel_value );
-                set_pixel( framebuffer, x0 + x, y0 - y, pixel_value );
+                // pixels on the axes and the diagonals belong to two octants, draw them only once
+                uint8_t visible = octants;
+                
+                if( y == 0 ) visible &= ~( 0x04 | 0x10 | 0x40 | 0x80 );
+                if( x == y ) visible &= ~( 0x02 | 0x08 | 0x20 | 0x80 );
+                
+                if( visible & 0x01 ) clip_set_pixel( framebuffer, set_pixel, &bounds, x0 + x, y0 + y, pixel_value );
+                if( visible & 0x02 ) clip_set_pixel( framebuffer, set_pixel, &bounds, x0 + y, y0 + x, pixel_value );
+                if( visible & 0x04 ) clip_set_pixel( framebuffer, set_pixel, &bounds, x0 - y, y0 + x, pixel_value );
+                if( visible & 0x08 ) clip_set_pixel( framebuffer, set_pixel, &bounds, x0 - x, y0 + y, pixel_value );
+                if( visible & 0x10 ) clip_set_pixel( framebuffer, set_pixel, &bounds, x0 - x, y0 - y, pixel_value );
+                if( visible & 0x20 ) clip_set_pixel( framebuffer, set_pixel, &bounds, x0 - y, y0 - x, pixel_value );
+                if( visible & 0x40 ) clip_set_pixel( framebuffer, set_pixel, &bounds, x0 + y, y0 - x, pixel_value );
+                if( visible & 0x80 ) clip_set_pixel( framebuffer, set_pixel, &bounds, x0 + x, y0 - y, pixel_value );
 
                 y += 1;
                 if (err <= 0)
@@ -84,16 +225,102 @@ uint8_t draw_circle(
         return STATUS_OK;
 }
 
+/**
+ * \brief Fill a circle around [x0,y0] with radius
+ */
+uint8_t draw_circle_filled(
+  struct Framebuffer *framebuffer       //< pointer to the framebuffer to draw the pixel to
+,           uint32_t  pixel_value	//< value to set for the pixels
+,            int16_t  x0		//< x position of the midpoint
+,            int16_t  y0		//< y position of the midpoint
+,           uint16_t  radius		//< radius in pixel to draw circle with
+){
+        return draw_circle_filled_clipped( framebuffer, pixel_value, x0, y0, radius, NULL );
+}
+
+/**
+ * \brief Fill the pixels of a circle around [x0,y0] with radius, that are inside clip
+ */
+uint8_t draw_circle_filled_clipped(
+  struct Framebuffer       *framebuffer	//< pointer to the framebuffer to draw the pixel to
+,           uint32_t        pixel_value	//< value to set for the pixels
+,            int16_t        x0		//< x position of the midpoint
+,            int16_t        y0		//< y position of the midpoint
+,           uint16_t        radius	//< radius in pixel to draw circle with
+, struct Draw_Clip   const *clip	//< pixels outside are not drawn (NULL: framebuffer)
+){
+        if( framebuffer == NULL ){
+                return STATUS_ERR_INVALID_ARG;
+        }
+
+        enum status_code status = STATUS_OK;
+        struct Draw_Clip bounds;
+        
+        int32_t r = radius;
+        if(( !clip_bounds( framebuffer, clip, &bounds ) )
+        || ( !clip_overlaps( &bounds, x0 - r, y0 - r, x0 + r, y0 + r ) )
+        ){
+                return STATUS_OK; // nothing visible
+        }
+        
+        int x	= radius;
+        int y	= 0;
+        int err = 0;
+
+        // every row is filled once, from the left to the right most pixel of the outline
+        while(( status == STATUS_OK ) && ( x >= y ))
+        {
+                // rows y0 +- y reach out to x
+                status = clip_fill_hspan( framebuffer, &bounds, x0 - x, x0 + x, y0 + y, pixel_value );
+                if(( status == STATUS_OK ) && ( y > 0 )){
+                        status = clip_fill_hspan( framebuffer, &bounds, x0 - x, x0 + x, y0 - y, pixel_value );
+                }
+
+                y += 1;
+                if (err <= 0)
+                {
+                        err += ( y << 1 ) + 1;
+                } else {
+                        // rows y0 +- x reach out to the last y, unless they are one of the rows above
+                        if(( status == STATUS_OK ) && ( x >= y )){
+                                status = clip_fill_hspan( framebuffer, &bounds, x0 - y + 1, x0 + y - 1, y0 + x, pixel_value );
+                                if( status == STATUS_OK ){
+                                        status = clip_fill_hspan( framebuffer, &bounds, x0 - y + 1, x0 + y - 1, y0 - x, pixel_value );
+                                }
+                        }
+                        x -= 1;
+                        err += ( ( y - x ) << 1 ) + 1;
+                }
+        }
+        
+        return status;
+}
+
 /**
  * \brief Draw an ellipse inside the rectangle specified by [x0,y0], [x1,y1]
  */
 uint8_t draw_ellipse_rect(
   struct Framebuffer *framebuffer       //< pointer to the framebuffer to draw the pixel to
 ,           uint32_t  pixel_value	//< value to set for the pixels
-,           uint16_t  x0		//< x start position of the enclosing rectangle
-,           uint16_t  y0		//< y start position of the enclosing rectangle
-,           uint16_t  x1		//< x end   position of the enclosing rectangle
-,           uint16_t  y1		//< y end   position of the enclosing rectangle
+,            int16_t  x0		//< x start position of the enclosing rectangle
+,            int16_t  y0		//< y start position of the enclosing rectangle
+,            int16_t  x1		//< x end   position of the enclosing rectangle
+,            int16_t  y1		//< y end   position of the enclosing rectangle
+){
+        return draw_ellipse_rect_clipped( framebuffer, pixel_value, x0, y0, x1, y1, NULL );
+}
+
+/**
+ * \brief Draw the pixels of an ellipse inside the rectangle specified by [x0,y0], [x1,y1], that are inside clip
+ */
+uint8_t draw_ellipse_rect_clipped(
+  struct Framebuffer       *framebuffer	//< pointer to the framebuffer to draw the pixel to
+,           uint32_t        pixel_value	//< value to set for the pixels
+,            int16_t        x0_		//< x start position of the enclosing rectangle
+,            int16_t        y0_		//< y start position of the enclosing rectangle
+,            int16_t        x1_		//< x end   position of the enclosing rectangle
+,            int16_t        y1_		//< y end   position of the enclosing rectangle
+, struct Draw_Clip   const *clip	//< pixels outside are not drawn (NULL: framebuffer)
 ){
         if( framebuffer == NULL ){
                 return STATUS_ERR_INVALID_ARG;
@@ -103,7 +330,10 @@ uint8_t draw_ellipse_rect(
         }
 
         Framebuffer_Set_Pixel *set_pixel = framebuffer->set_pixel;
+        struct Draw_Clip       bounds;
         
+	int32_t x0 = x0_, y0 = y0_, x1 = x1_, y1 = y1_;
+	
 	// values of diameter
 	int  a   = abs( x1 - x0 ); 
 	int  b   = abs( y1 - y0 );
@@ -114,9 +344,26 @@ uint8_t draw_ellipse_rect(
 	 // error of 1.step
 	long err = dx + dy + b1 * a*a;
 	long e2;
+	bool y_step;
 
 	if (x0 > x1) { x0 = x1; x1 += a; } // if called with swapped points
 	if (y0 > y1) { y0 = y1;          } // .. exchange them 
+	
+	if(( !clip_bounds( framebuffer, clip, &bounds ) )
+	|| ( !clip_overlaps( &bounds, x0, y0, x0 + a, y0 + b ) )
+	){
+		return STATUS_OK; // nothing visible
+	}
+	
+	// quadrants, whose half of the enclosing rectangle is not inside bounds, are skipped
+	int32_t x_mid  = x0 + ( a >> 1 );
+	int32_t y_mid  = y0 + ( b >> 1 );
+	bool    right  = clip_overlaps( &bounds, x_mid - 1, y0       , x0 + a    , y0 + b     );
+	bool    left   = clip_overlaps( &bounds, x0       , y0       , x_mid + 1 , y0 + b     );
+	bool    bottom = clip_overlaps( &bounds, x0       , y_mid - 1, x0 + a    , y0 + b     );
+	bool    top    = clip_overlaps( &bounds, x0       , y0       , x0 + a    , y_mid + 1  );
+	uint8_t quadrants = ( right && bottom ? 0x01 : 0 ) | ( left  && bottom ? 0x02 : 0 )
+	                  | ( left  && top    ? 0x04 : 0 ) | ( right && top    ? 0x08 : 0 );
 		
 	// starting pixel
 	y0 += ( b + 1 ) >> 1; 
@@ -125,12 +372,19 @@ uint8_t draw_ellipse_rect(
 	b1  = ( b*b ) << 3;
 
 	do {
-		set_pixel( framebuffer, x1, y0, pixel_value); /*   I. Quadrant */
-		set_pixel( framebuffer, x0, y0, pixel_value); /*  II. Quadrant */
-		set_pixel( framebuffer, x0, y1, pixel_value); /* III. Quadrant */
-		set_pixel( framebuffer, x1, y1, pixel_value); /*  IV. Quadrant */
+		// pixels on the axes belong to two quadrants, draw them only once
+		uint8_t visible = quadrants;
+		
+		if( y0 == y1 ) visible &= ~( 0x04 | 0x08 );
+		if( x0 == x1 ) visible &= ~( 0x02 | 0x04 );
+		
+		if( visible & 0x01 ) clip_set_pixel( framebuffer, set_pixel, &bounds, x1, y0, pixel_value); /*   I. Quadrant */
+		if( visible & 0x02 ) clip_set_pixel( framebuffer, set_pixel, &bounds, x0, y0, pixel_value); /*  II. Quadrant */
+		if( visible & 0x04 ) clip_set_pixel( framebuffer, set_pixel, &bounds, x0, y1, pixel_value); /* III. Quadrant */
+		if( visible & 0x08 ) clip_set_pixel( framebuffer, set_pixel, &bounds, x1, y1, pixel_value); /*  IV. Quadrant */
 		e2 = err << 1;
-		if( e2 <= dy ){ 
+		y_step = ( e2 <= dy );
+		if( y_step ){ 
 			// y step 
 			y0++; 
 			y1--; 
@@ -144,150 +398,336 @@ uint8_t draw_ellipse_rect(
 		} 
 	} while( x0 <= x1 );
 	
+	if( !y_step ){
+		// the tip continues on the rows of the last step, which are drawn already
+		y0++;
+		y1--;
+	}
 	while( y0-y1 < b ) {  /* too early stop of flat ellipses a=1 */
-		// finish tip of ellipse
-		set_pixel( framebuffer, x0-1, y0  , pixel_value); 
-		set_pixel( framebuffer, x1+1, y0++, pixel_value);
-		set_pixel( framebuffer, x0-1, y1  , pixel_value);
-		set_pixel( framebuffer, x1+1, y1--, pixel_value);
+		// finish tip of ellipse, both sides are the same column for even widths
+		bool one_column = ( x0 - 1 == x1 + 1 );
+		bool one_row    = ( y0     == y1     );
+		
+		                                clip_set_pixel( framebuffer, set_pixel, &bounds, x0-1, y0, pixel_value);
+		if( !one_column               ) clip_set_pixel( framebuffer, set_pixel, &bounds, x1+1, y0, pixel_value);
+		if(                 !one_row  ) clip_set_pixel( framebuffer, set_pixel, &bounds, x0-1, y1, pixel_value);
+		if( !one_column  && !one_row  ) clip_set_pixel( framebuffer, set_pixel, &bounds, x1+1, y1, pixel_value);
+		y0++;
+		y1--;
 	}
 	
 	return STATUS_OK;
 }
 
 /**
- * \brief Flood fill an area starting from point [x,y] with pixel_new_value
+ * \brief Fill an ellipse inside the rectangle specified by [x0,y0], [x1,y1]
  */
-uint8_t draw_fill(
+uint8_t draw_ellipse_rect_filled(
   struct Framebuffer *framebuffer       //< pointer to the framebuffer to draw the pixel to
-,           uint32_t  pixel_value	//< current value of pixels to change
-,           uint32_t  pixel_value_new	//< new value pixels are set to
-,           uint16_t  x			//< x start point
-,           uint16_t  y			//< y start point
+,           uint32_t  pixel_value	//< value to set for the pixels
+,            int16_t  x0		//< x start position of the enclosing rectangle
+,            int16_t  y0		//< y start position of the enclosing rectangle
+,            int16_t  x1		//< x end   position of the enclosing rectangle
+,            int16_t  y1		//< y end   position of the enclosing rectangle
+){
+        return draw_ellipse_rect_filled_clipped( framebuffer, pixel_value, x0, y0, x1, y1, NULL );
+}
+
+/**
+ * \brief Fill the pixels of an ellipse inside the rectangle specified by [x0,y0], [x1,y1], that are inside clip
+ */
+uint8_t draw_ellipse_rect_filled_clipped(
+  struct Framebuffer       *framebuffer	//< pointer to the framebuffer to draw the pixel to
+,           uint32_t        pixel_value	//< value to set for the pixels
+,            int16_t        x0_		//< x start position of the enclosing rectangle
+,            int16_t        y0_		//< y start position of the enclosing rectangle
+,            int16_t        x1_		//< x end   position of the enclosing rectangle
+,            int16_t        y1_		//< y end   position of the enclosing rectangle
+, struct Draw_Clip   const *clip	//< pixels outside are not drawn (NULL: framebuffer)
 ){
         if( framebuffer == NULL ){
                 return STATUS_ERR_INVALID_ARG;
         }
-        if( framebuffer->set_pixel == NULL ){
-                return STATUS_ERR_INVALID_ARG;
+
+        enum status_code status = STATUS_OK;
+        struct Draw_Clip bounds;
+        
+	int32_t x0 = x0_, y0 = y0_, x1 = x1_, y1 = y1_;
+	
+	// values of diameter
+	int  a   = abs( x1 - x0 ); 
+	int  b   = abs( y1 - y0 );
+	int  b1  = b&1           ; 
+	// error increment
+	long dx  = ( ( 1  - a ) * b*b ) << 2;
+	long dy  = ( ( b1 + 1 ) * a*a ) << 2; 
+	 // error of 1.step
+	long err = dx + dy + b1 * a*a;
+	long e2;
+
+	if (x0 > x1) { x0 = x1; x1 += a; } // if called with swapped points
+	if (y0 > y1) { y0 = y1;          } // .. exchange them 
+	
+	if(( !clip_bounds( framebuffer, clip, &bounds ) )
+	|| ( !clip_overlaps( &bounds, x0, y0, x0 + a, y0 + b ) )
+	){
+		return STATUS_OK; // nothing visible
+	}
+		
+	// starting pixel
+	y0 += ( b + 1 ) >> 1; 
+	y1  = y0 - b1;   
+	a  *= a << 3; 
+	b1  = ( b*b ) << 3;
+
+	// The outline moves from the middle rows outwards and from the left and right edge inwards,
+	// so a row is widest, when the outline gets to it. It is filled then and only then.
+	bool row_new = true;
+	do {
+		if( row_new ){
+			status = clip_fill_hspan( framebuffer, &bounds, x0, x1, y0, pixel_value );
+			if(( status == STATUS_OK ) && ( y1 != y0 )){
+				status = clip_fill_hspan( framebuffer, &bounds, x0, x1, y1, pixel_value );
+			}
+			row_new = false;
+		}
+		e2 = err << 1;
+		if( e2 <= dy ){ 
+			// y step 
+			y0++; 
+			y1--; 
+			err += dy += a; 
+			row_new = true;
+		}  
+		if( ( e2 >= dx ) || ( err << 1 ) > dy ){ 
+			// x step
+			x0++; 
+			x1--; 
+			err += dx += b1; 
+		} 
+	} while(( status == STATUS_OK ) && ( x0 <= x1 ));
+	
+	while(( status == STATUS_OK ) && ( y0-y1 < b )) {  /* too early stop of flat ellipses a=1 */
+		// finish tip of ellipse
+		if( row_new ){
+			status = clip_fill_hspan( framebuffer, &bounds, x0-1, x1+1, y0, pixel_value );
+			if( status == STATUS_OK ){
+				status = clip_fill_hspan( framebuffer, &bounds, x0-1, x1+1, y1, pixel_value );
+			}
+		}
+		row_new = true;
+		y0++;
+		y1--;
+	}
+	
+	return status;
+}
+
+/**
+ * \brief Spans, that did not fit on the span stack, to follow, when the stack is empty
+ */
+struct Fill_Dropped {
+        struct Draw_Fill_Span  entries[DRAW_FILL_DROPPED];	// spans kept
+                      uint8_t  count;				// number of spans kept
+                         bool  lost;				// a span did not fit here either
+};
+
+/**
+ * \brief Put a span on the span stack, if there is room left, otherwise keep it with the dropped spans
+ */
+static inline void fill_span_push(
+  struct Draw_Fill_Stack *const spans		// span stack
+, struct Fill_Dropped    *const dropped		// spans, that did not fit on the stack
+,               uint16_t  const x_first		// x position of the left  most pixel of the run
+,               uint16_t  const x_last		// x position of the right most pixel of the run
+,               uint16_t  const y		// y position of the run
+,                int16_t  const dy		// row to scan next: y + dy
+){
+        struct Draw_Fill_Span span = { x_first, x_last, y, dy };
+        
+        if( draw_fill_stack_push( spans, span ) == STATUS_OK ){
+                return;
         }
-        if( framebuffer->get_pixel == NULL ){
-                return STATUS_ERR_INVALID_ARG;
+        if( dropped->count < DRAW_FILL_DROPPED ){
+                dropped->entries[ dropped->count++ ] = span;
+        } else {
+                dropped->lost = true;
         }
+}
 
-        Framebuffer_Set_Pixel *set_pixel = framebuffer->set_pixel;
-        Framebuffer_Get_Pixel *get_pixel = framebuffer->get_pixel;
-        
-        Stack    *stack;                                // a (self growing) stack for position of pixel we want to remember
-        uint8_t   ret		        = STATUS_OK;	// status of this function
-        uint8_t   ret_above	        = STATUS_OK;	// status of the pixel above test
-        uint8_t   ret_below	        = STATUS_OK;	// status of the pixel below test
-        uint8_t   ret_draw	        = STATUS_OK;	// status of the draw operation
-        uint16_t  x_curr		= x;		// current x position
-        uint16_t  y_curr		= y;		// current y position
-        uint32_t  current_pixel_value	= 0;		// value of the current pixel
-        uint32_t  pixel_value_above	= 0;		// value of the pixel above the current pixel
-        uint32_t  pixel_value_below	= 0;		// value of the pixel below the current pixel
-        bool	  push_next_valid_above	= true;		// the next valid pixel above should be pushed to the stack
-        bool	  push_next_valid_below	= true;		// the next valid pixel below should be pushed to the stack
-        
-        // check the validity of the initial position
-        ret = get_pixel( framebuffer, x, y, &current_pixel_value);
-        if( ret == STATUS_ERR_INVALID_ARG ){
-                return ret; // x or y out of bounds
-        }
-        
-        // allocate a stack for x and y values to remember
-        ret = stack_allocate( &stack, 1 ); // stack is self re-allocating, so we start with an initial_capcity of one
-        if( ret != STATUS_OK ){
-                return ret;
-        }
-        
-        do{
-                // move left until we find a pixel with a value != pixel_value or reach the end of the screen
-                while(( current_pixel_value == pixel_value ) // pixel has the correct value
-                   && ( ret != STATUS_ERR_INVALID_ARG      ) // not yet reached the end of the screen
-                ){
-                        x_curr--;
-                        ret = get_pixel( framebuffer, x_curr, y_curr, &current_pixel_value);
+/**
+ * \brief Follow the spans on the span stack, until it is empty
+ */
+static enum status_code fill_follow(
+  struct Framebuffer     *const framebuffer	// framebuffer to fill in
+,               uint32_t  const pixel_value	// current value of pixels to change
+,               uint32_t  const pixel_value_new	// new value pixels are set to
+, struct Draw_Fill_Stack *const spans		// span stack
+, struct Fill_Dropped    *const dropped		// spans, that did not fit on the stack
+){
+        enum status_code  status = STATUS_OK;
+                uint32_t  x_max  = framebuffer->width - 1;
+                uint32_t  left;			// length of a run from its seed pixel to the left
+                uint32_t  right;		// length of a run from its seed pixel to the right
+                uint32_t  skip;			// number of pixels not to fill in front of a run
+        struct Draw_Fill_Span span;
+        
+        while(( status == STATUS_OK ) && ( draw_fill_stack_pop( spans, &span ) == STATUS_OK )){
+                int32_t  row = (int32_t)span.y + span.dy;
+                uint32_t x_curr;
+                
+                if(( row < 0 ) || ( row >= (int32_t)framebuffer->height )){
+                        continue;
                 }
-                // push back to the last pixel valid for fill
-                x_curr++;
-                ret = get_pixel( framebuffer, x_curr, y_curr, &current_pixel_value);
                 
-                // now move right until we find a pixel with a value != pixel_value or reach the end of the screen
-                while(( ret != STATUS_ERR_INVALID_ARG      ) // pixel is within screen limits
-                   && ( current_pixel_value == pixel_value ) // pixel has the correct value
-                ){
-                        // set the new value for the current pixel
-                        ret_draw = set_pixel( framebuffer, x_curr, y_curr, pixel_value_new );
-                        if( ret_draw != STATUS_OK){
-                                break; // abort all fill operations
+                // find the runs to fill in the row next to the span
+                for( x_curr = span.x_first; ( status == STATUS_OK ) && ( x_curr <= span.x_last ); x_curr += 2 ){
+                        status = framebuffer_scan_hspan( framebuffer, x_curr, row, span.x_last, pixel_value, false, &skip );
+                        x_curr += skip;
+                        if(( status != STATUS_OK ) || ( x_curr > span.x_last )){
+                                break;
                         }
                         
-                        // test the pixel above the current pixel
-                        ret_above = get_pixel( framebuffer, x_curr, y_curr - 1, &pixel_value_above);
-                        if(( ret_above == STATUS_OK           )	// pixel is within screen limits
-                        && ( pixel_value_above == pixel_value ) // pixel as the correct value
-                        ){	// pixel above is valid for fill
-                                if( push_next_valid_above ){
-                                        // we only push the first pixel in a consecutive row of pixels valid for fill
-                                        stack_push( stack, y_curr - 1 );
-                                        stack_push( stack, x_curr     );
-                                        push_next_valid_above = false;
-                                }
-                        } else {
-                                // pixel above is not valid for fill
-                                push_next_valid_above = true; // the next valid one above is to be pushed again
+                        // a run only reaches left of the span, if it starts at the span's first pixel
+                        left = 1;
+                        if( x_curr == span.x_first ){
+                                status = framebuffer_scan_hspan( framebuffer, x_curr, row, 0, pixel_value, true, &left );
                         }
-                        
-                        // test the pixel below the current pixel
-                        ret_below = get_pixel( framebuffer, x_curr, y_curr + 1, &pixel_value_below);
-                        if(( ret_below == STATUS_OK           )	// pixel is within screen limits
-                        && ( pixel_value_below == pixel_value ) // pixel has the correct value
-                        ){	// pixel below is valid for fill
-                                if( push_next_valid_below ){
-                                        // we only push the first pixel in a consecutive row of pixels valid for fill
-                                        stack_push( stack, y_curr + 1 );
-                                        stack_push( stack, x_curr     );
-                                        push_next_valid_below = false;
-                                }
-                        } else {
-                                // pixel below is not valid for fill
-                                push_next_valid_below = true; // the next valid one below is to be pushed again
+                        if( status == STATUS_OK ){
+                                status = framebuffer_scan_hspan( framebuffer, x_curr, row, x_max, pixel_value, true, &right );
+                        }
+                        if( status == STATUS_OK ){
+                                status = framebuffer_fill_hspan( framebuffer, x_curr - left + 1, row, left + right - 1, pixel_value_new );
                         }
                         
-                        // move to next pixel in line and get it's value
-                        x_curr++;
-                        ret = get_pixel( framebuffer, x_curr, y_curr, &current_pixel_value);
+                        uint32_t run_first = x_curr - left  + 1;
+                        uint32_t run_last  = x_curr + right - 1;
                         
-                } // end while
-                
-                if( ret_draw == STATUS_OK ){
-                        // check stack for more eligible pixels to fill
-                        ret = stack_pop( stack, &x_curr );
-                        if( ret != STATUS_OK ){
-                                break; // looks like we are done
+                        // go on in the same direction, and look back where the run sticks out of the span
+                        // (the pixels right next to the span are known not to be filled)
+                        fill_span_push( spans, dropped, run_first, run_last, row, span.dy );
+                        if( run_first + 1 < span.x_first ){
+                                fill_span_push( spans, dropped, run_first, span.x_first - 2, row, -span.dy );
                         }
-                        ret = stack_pop( stack, &y_curr );
-                        if( ret != STATUS_OK ){
-                                break; // looks like we are done
+                        if( run_last > span.x_last + 1u ){
+                                fill_span_push( spans, dropped, span.x_last + 2, run_last, row, -span.dy );
                         }
-                        // we found another pixel
-                        current_pixel_value   = pixel_value;    // that's why we stored it in the first place
-                        push_next_valid_above = true;		// the next valid one above is to be pushed again
-                        push_next_valid_below = true;		// the next valid one below is to be pushed again
+                        
+                        x_curr = run_last; // the pixel after the run is not to fill
                 }
-                
-        } while( ret_draw == STATUS_OK );
+        }
         
-        // always deallocate the stack
-        ret = stack_deallocate( &stack );
-        if( ret != STATUS_OK ){
-                return ret;
+        return status;
+}
+
+/**
+ * \brief Flood fill an area starting from point [x,y] with pixel_new_value
+ */
+uint8_t draw_fill(
+  struct Framebuffer *framebuffer       //< pointer to the framebuffer to draw the pixel to
+,           uint32_t  pixel_value	//< current value of pixels to change
+,           uint32_t  pixel_value_new	//< new value pixels are set to
+,           uint16_t  x			//< x start point
+,           uint16_t  y			//< y start point
+){
+        struct Draw_Fill_Span  entries[DRAW_FILL_SPANS];
+        struct Draw_Fill_Stack spans = STACK_INITIALIZER( entries );
+        
+        return draw_fill_spans( framebuffer, pixel_value, pixel_value_new, x, y, &spans );
+}
+
+/**
+ * \brief Flood fill an area starting from point [x,y] with pixel_new_value, using a caller supplied span stack
+ */
+uint8_t draw_fill_spans(
+  struct Framebuffer     *framebuffer		//< pointer to the framebuffer to draw the pixel to
+,           uint32_t      pixel_value		//< current value of pixels to change
+,           uint32_t      pixel_value_new	//< new value pixels are set to
+,           uint16_t      x			//< x start point
+,           uint16_t      y			//< y start point
+, struct Draw_Fill_Stack *spans			//< span stack to use
+){
+        if(( framebuffer == NULL )
+        || ( spans       == NULL )
+        ){
+                return STATUS_ERR_INVALID_ARG;
+        }
+        if(( x >= framebuffer->width  )
+        || ( y >= framebuffer->height )
+        ){
+                return STATUS_ERR_INVALID_ARG; // x or y out of bounds
         }
+        
+        enum status_code     status = STATUS_OK;	// status of this function
+        struct Fill_Dropped  dropped;			// spans, that did not fit on the stack
+                   uint32_t  x_max  = framebuffer->width - 1;
+                   uint32_t  left;			// length of a run from its seed pixel to the left
+                   uint32_t  right;			// length of a run from its seed pixel to the right
+                   uint32_t  skip;			// number of pixels not to fill in front of a run
+        
+        dropped.count = 0;
+        dropped.lost  = false;
+        draw_fill_stack_clear( spans );
+        
+        // the run of the start point
+        status = framebuffer_scan_hspan( framebuffer, x, y, 0    , pixel_value, true, &left  );
+        if(( status != STATUS_OK ) || ( left < 1 )){
+                return status; // nothing to fill
+        }
+        status = framebuffer_scan_hspan( framebuffer, x, y, x_max, pixel_value, true, &right );
+        if( status == STATUS_OK ){
+                status = framebuffer_fill_hspan( framebuffer, x - left + 1, y, left + right - 1, pixel_value_new );
+        }
+        if( status == STATUS_OK ){
+                // if the new value leaves the pixels as they are, the fill would never end
+                status = framebuffer_scan_hspan( framebuffer, x, y, x, pixel_value, true, &skip );
+                if( skip > 0 ){
+                        return status;
+                }
+        }
+        fill_span_push( spans, &dropped, x - left + 1, x + right - 1, y, -1 );
+        fill_span_push( spans, &dropped, x - left + 1, x + right - 1, y, +1 );
+        
+        if( status == STATUS_OK ){
+                status = fill_follow( framebuffer, pixel_value, pixel_value_new, spans, &dropped );
+        }
+        
+        // A dropped span is a run filled by this fill, so its neighbour row can be scanned later as well as now.
+        // Move the dropped spans onto the empty stack and follow them, until none is left.
+        while(( status == STATUS_OK ) && ( dropped.count > 0 )){
+                while(( dropped.count > 0 )
+                &&    ( draw_fill_stack_push( spans, dropped.entries[ dropped.count - 1 ] ) == STATUS_OK )
+                ){
+                        dropped.count--;
+                }
+                status = fill_follow( framebuffer, pixel_value, pixel_value_new, spans, &dropped );
+        }
+        
+        if(( status == STATUS_OK ) && dropped.lost ){
+                status = STATUS_ERR_NO_MEMORY;
+        }
+        
+        return status;
+}
 
-        return STATUS_OK;
+/**
+ * \brief Steps t, for which p0 + step * t is inside [p_min..p_max]
+ */
+static inline void clip_steps(
+  int32_t  const p0		// start position
+, int32_t  const step		// +1 or -1
+, int32_t  const p_min		// first position inside
+, int32_t  const p_max		// last  position inside
+, int32_t *const t_first	// [out] first step inside
+, int32_t *const t_last		// [out] last  step inside
+){
+        if( step > 0 ){
+                *t_first = p_min - p0;
+                *t_last  = p_max - p0;
+        } else {
+                *t_first = p0 - p_max;
+                *t_last  = p0 - p_min;
+        }
 }
 
 /**
@@ -296,10 +736,25 @@ uint8_t draw_fill(
 uint8_t draw_line(
   struct Framebuffer *framebuffer       //< pointer to the framebuffer to draw the pixel to
 ,           uint32_t  pixel_value	//< value to set for the pixels
-,           uint16_t  x0		//< x start position of the line
-,           uint16_t  y0		//< y start position of the line
-,           uint16_t  x1		//< x end   position of the line
-,           uint16_t  y1		//< y end   position of the line
+,            int16_t  x0		//< x start position of the line
+,            int16_t  y0		//< y start position of the line
+,            int16_t  x1		//< x end   position of the line
+,            int16_t  y1		//< y end   position of the line
+){
+        return draw_line_clipped( framebuffer, pixel_value, x0, y0, x1, y1, NULL );
+}
+
+/**
+ * \brief Set pixel_value for the pixels of a line form [x0,y0] to [x1,y1], that are inside clip
+ */
+uint8_t draw_line_clipped(
+  struct Framebuffer       *framebuffer	//< pointer to the framebuffer to draw the pixel to
+,           uint32_t        pixel_value	//< value to set for the pixels
+,            int16_t        x0		//< x start position of the line
+,            int16_t        y0		//< y start position of the line
+,            int16_t        x1		//< x end   position of the line
+,            int16_t        y1		//< y end   position of the line
+, struct Draw_Clip   const *clip	//< pixels outside are not drawn (NULL: framebuffer)
 ){
         if( framebuffer == NULL ){
                 return STATUS_ERR_INVALID_ARG;
@@ -308,41 +763,402 @@ uint8_t draw_line(
                 return STATUS_ERR_INVALID_ARG;
         }
 
+        struct Draw_Clip bounds;
+        if( !clip_bounds( framebuffer, clip, &bounds ) ){
+                return STATUS_OK; // nothing visible
+        }
+        
+        // horizontal and vertical lines are spans
+        if( y0 == y1 ){
+                return clip_fill_hspan( framebuffer, &bounds, x0 < x1 ? x0 : x1, x0 < x1 ? x1 : x0, y0, pixel_value );
+        }
+        if( x0 == x1 ){
+                return clip_fill_vspan( framebuffer, &bounds, x0, y0 < y1 ? y0 : y1, y0 < y1 ? y1 : y0, pixel_value );
+        }
+
         Framebuffer_Set_Pixel *set_pixel = framebuffer->set_pixel;
         
         int32_t dx =  abs( x1 - x0 ), sx = x0 < x1 ? 1 : -1;
         int32_t dy = -abs( y1 - y0 ), sy = y0 < y1 ? 1 : -1;
-        int32_t err = dx + dy, e2; /* error value e_xy */
         
-        for(;;){  /* loop */
-                set_pixel( framebuffer, x0, y0, pixel_value );
-                if ( x0 == x1 && y0 == y1 ) break;
+        // Every step of the loop below moves one pixel along the major axis. After t steps it has made
+        // minor(t) = ( 2 * minor * t + major ) / ( 2 * major ) steps along the minor axis.
+        // So the steps with pixels inside bounds can be computed in advance.
+        bool    x_major = dx >= -dy;
+        int32_t major   = x_major ?  dx : -dy;
+        int32_t minor   = x_major ? -dy :  dx;
+        int32_t t_first, t_last;	// steps along the major axis inside bounds
+        int32_t m_first, m_last;	// steps along the minor axis inside bounds
+        
+        if( x_major ){
+                clip_steps( x0, sx, bounds.x_min, bounds.x_max, &t_first, &t_last );
+                clip_steps( y0, sy, bounds.y_min, bounds.y_max, &m_first, &m_last );
+        } else {
+                clip_steps( y0, sy, bounds.y_min, bounds.y_max, &t_first, &t_last );
+                clip_steps( x0, sx, bounds.x_min, bounds.x_max, &m_first, &m_last );
+        }
+        if( t_first < 0     ) t_first = 0;
+        if( t_last  > major ) t_last  = major;
+        if( m_first < 0     ) m_first = 0;
+        if( m_last  > minor ) m_last  = minor;
+        if(( t_first > t_last ) || ( m_first > m_last )){
+                return STATUS_OK; // nothing visible
+        }
+        if( m_first > 0 ){
+                // first step with minor(t) >= m_first
+                int32_t t = ( (int64_t)( 2 * m_first - 1 ) * major + 2 * minor - 1 ) / ( 2 * minor );
+                if( t > t_first ) t_first = t;
+        }
+        if( m_last < minor ){
+                // last step with minor(t) <= m_last
+                int32_t t = ( (int64_t)( 2 * m_last + 1 ) * major - 1 ) / ( 2 * minor );
+                if( t < t_last ) t_last = t;
+        }
+        if( t_first > t_last ){
+                return STATUS_OK; // nothing visible
+        }
+        
+        // Bresenham's state at the first visible pixel
+        int32_t m  = ( (int64_t)2 * minor * t_first + major ) / ( 2 * major );
+        int32_t i  = x_major ? t_first : m;	// steps along x
+        int32_t j  = x_major ? m : t_first;	// steps along y
+        int32_t x  = x0 + sx * i;
+        int32_t y  = y0 + sy * j;
+        int32_t err = (int64_t)dx * ( j + 1 ) + (int64_t)dy * ( i + 1 ), e2; /* error value e_xy */
+        
+        for( int32_t n = t_last - t_first + 1; n > 0; n-- ){
+                set_pixel( framebuffer, x, y, pixel_value );
                 e2 = err << 1;
-                if( e2 >= dy ) { err += dy; x0 += sx; } /* e_xy+e_x > 0 */
-                if( e2 <= dx ) { err += dx; y0 += sy; } /* e_xy+e_y < 0 */
+                if( e2 >= dy ) { err += dy; x += sx; } /* e_xy+e_x > 0 */
+                if( e2 <= dx ) { err += dx; y += sy; } /* e_xy+e_y < 0 */
         }
         
         return STATUS_OK;
 }
 
+/**
+ * Bresenham's state of a polygon edge, that is walked row by row.
+ */
+struct Polygon_Edge {
+        int32_t x;		// current pixel
+        int32_t y;
+        int32_t x_end;		// last pixel
+        int32_t y_end;
+        int32_t dx;		// Bresenham's increments and error value
+        int32_t dy;
+        int32_t sx;
+        int32_t sy;
+        int32_t err;
+        bool    done;		// all pixels of the edge are walked
+};
+
+/**
+ * One side of a polygon, the edges from its top to its bottom corner in one direction.
+ */
+struct Polygon_Side {
+        struct Draw_Point   const *points;	// corners of the polygon
+        uint16_t                   count;	// number of corners
+        uint16_t                   idx;		// corner the current edge starts at
+        uint16_t                   idx_last;	// bottom corner
+         int8_t                    step;	// direction to go to the next corner (+1 or -1)
+        struct Polygon_Edge        edge;	// current edge
+};
+
+/**
+ * \brief Start walking the edge from corner a to corner b
+ */
+static inline void polygon_edge_init(
+  struct Polygon_Edge       *const edge
+, struct Draw_Point   const *const a
+, struct Draw_Point   const *const b
+){
+        edge->x     =  a->x;
+        edge->y     =  a->y;
+        edge->x_end =  b->x;
+        edge->y_end =  b->y;
+        edge->dx    =  abs( b->x - a->x );
+        edge->dy    = -abs( b->y - a->y );
+        edge->sx    =  a->x < b->x ? 1 : -1;
+        edge->sy    =  a->y < b->y ? 1 : -1;
+        edge->err   =  edge->dx + edge->dy;
+        edge->done  =  false;
+}
+
+/**
+ * \brief Extend [x_lo,x_hi] by the pixels of the edge in row y and walk the edge past them
+ */
+static inline void polygon_edge_row(
+  struct Polygon_Edge *const edge
+,             int32_t  const y
+,             int32_t *const x_lo
+,             int32_t *const x_hi
+){
+        while(( !edge->done ) && ( edge->y <= y )){
+                if( edge->y == y ){
+                        if( edge->x < *x_lo ) *x_lo = edge->x;
+                        if( edge->x > *x_hi ) *x_hi = edge->x;
+                }
+                if(( edge->x == edge->x_end ) && ( edge->y == edge->y_end )){
+                        edge->done = true;
+                        break;
+                }
+                int32_t e2 = edge->err << 1;
+                if( e2 >= edge->dy ) { edge->err += edge->dy; edge->x += edge->sx; }
+                if( e2 <= edge->dx ) { edge->err += edge->dx; edge->y += edge->sy; }
+        }
+}
+
+/**
+ * \brief Start a side of the polygon at corner idx_first, going in direction step to corner idx_last
+ */
+static inline void polygon_side_init(
+  struct Polygon_Side       *const side
+, struct Draw_Point   const *const points
+,            uint16_t        const count
+,            uint16_t        const idx_first
+,            uint16_t        const idx_last
+,             int8_t         const step
+){
+        side->points   = points;
+        side->count    = count;
+        side->idx      = idx_first;
+        side->idx_last = idx_last;
+        side->step     = step;
+        polygon_edge_init( &side->edge, &points[idx_first], &points[( idx_first + count + step ) % count] );
+}
+
+/**
+ * \brief Extend [x_lo,x_hi] by the pixels of the side in row y
+ */
+static inline void polygon_side_row(
+  struct Polygon_Side *const side
+,             int32_t  const y
+,             int32_t *const x_lo
+,             int32_t *const x_hi
+){
+        for(;;){
+                polygon_edge_row( &side->edge, y, x_lo, x_hi );
+                
+                uint16_t idx_next = ( side->idx + side->count + side->step ) % side->count;
+                if(( !side->edge.done ) || ( idx_next == side->idx_last )){
+                        break;
+                }
+                // the next edge starts at the last pixel of this one, it may have more pixels in this row
+                side->idx = idx_next;
+                polygon_edge_init( &side->edge, &side->points[idx_next], &side->points[( idx_next + side->count + side->step ) % side->count] );
+        }
+}
+
+/**
+ * \brief Fill a convex polygon
+ */
+uint8_t draw_polygon_filled(
+  struct Framebuffer       *framebuffer	//< pointer to the framebuffer to draw the pixel to
+,           uint32_t        pixel_value	//< value to set for the pixels
+, struct Draw_Point  const *points	//< corners of the polygon
+,           uint16_t        count	//< number of corners
+){
+        return draw_polygon_filled_clipped( framebuffer, pixel_value, points, count, NULL );
+}
+
+/**
+ * \brief Fill the pixels of a convex polygon, that are inside clip
+ */
+uint8_t draw_polygon_filled_clipped(
+  struct Framebuffer       *framebuffer	//< pointer to the framebuffer to draw the pixel to
+,           uint32_t        pixel_value	//< value to set for the pixels
+, struct Draw_Point  const *points	//< corners of the polygon
+,           uint16_t        count	//< number of corners
+, struct Draw_Clip   const *clip	//< pixels outside are not drawn (NULL: framebuffer)
+){
+        if(( framebuffer == NULL )
+        || ( points      == NULL )
+        || ( count       <  1    )
+        ){
+                return STATUS_ERR_INVALID_ARG;
+        }
+        
+        enum status_code    status = STATUS_OK;
+        struct Draw_Clip    bounds;
+        struct Polygon_Side side_a;		// the corners in ascending  order from top to bottom
+        struct Polygon_Side side_b;		// the corners in descending order from top to bottom
+        uint16_t            idx_top    = 0;
+        uint16_t            idx_bottom = 0;
+        int32_t             x_min      = points[0].x;
+        int32_t             x_max      = points[0].x;
+        
+        for( uint16_t i = 1; i < count; i++ ){
+                if( points[i].y < points[idx_top   ].y ) idx_top    = i;
+                if( points[i].y > points[idx_bottom].y ) idx_bottom = i;
+                if( points[i].x < x_min ) x_min = points[i].x;
+                if( points[i].x > x_max ) x_max = points[i].x;
+        }
+        
+        int32_t y_top    = points[idx_top   ].y;
+        int32_t y_bottom = points[idx_bottom].y;
+        
+        if(( !clip_bounds( framebuffer, clip, &bounds ) )
+        || ( !clip_overlaps( &bounds, x_min, y_top, x_max, y_bottom ) )
+        ){
+                return STATUS_OK; // nothing visible
+        }
+        if( y_top == y_bottom ){
+                return clip_fill_hspan( framebuffer, &bounds, x_min, x_max, y_top, pixel_value );
+        }
+        
+        polygon_side_init( &side_a, points, count, idx_top, idx_bottom, +1 );
+        polygon_side_init( &side_b, points, count, idx_top, idx_bottom, -1 );
+        
+        // every row is filled once, from the left most to the right most pixel of both sides
+        for( int32_t y = y_top; ( status == STATUS_OK ) && ( y <= y_bottom ) && ( y <= bounds.y_max ); y++ ){
+                int32_t x_lo = INT32_MAX;
+                int32_t x_hi = INT32_MIN;
+                
+                polygon_side_row( &side_a, y, &x_lo, &x_hi );
+                polygon_side_row( &side_b, y, &x_lo, &x_hi );
+                if( x_lo <= x_hi ){
+                        status = clip_fill_hspan( framebuffer, &bounds, x_lo, x_hi, y, pixel_value );
+                }
+        }
+        
+        return status;
+}
+
 /**
  * \brief Draw a rectangle form [x0,y0] to [x1,y1]
  */
 uint8_t draw_rect(
   struct Framebuffer *framebuffer       //< pointer to the framebuffer to draw the pixel to
 ,           uint32_t  pixel_value	//< value to set for the pixels
-,           uint16_t  x0		//< x start position of the line
-,           uint16_t  y0		//< y start position of the line
-,           uint16_t  x1		//< x end   position of the line
-,           uint16_t  y1		//< y end   position of the line
+,            int16_t  x0		//< x start position of the line
+,            int16_t  y0		//< y start position of the line
+,            int16_t  x1		//< x end   position of the line
+,            int16_t  y1		//< y end   position of the line
 ){
-	uint8_t result = STATUS_OK;
+	return draw_rect_clipped( framebuffer, pixel_value, x0, y0, x1, y1, NULL );
+}
+
+/**
+ * \brief Draw the pixels of a rectangle form [x0,y0] to [x1,y1], that are inside clip
+ */
+uint8_t draw_rect_clipped(
+  struct Framebuffer       *framebuffer	//< pointer to the framebuffer to draw the pixel to
+,           uint32_t        pixel_value	//< value to set for the pixels
+,            int16_t        x0		//< x start position of the line
+,            int16_t        y0		//< y start position of the line
+,            int16_t        x1		//< x end   position of the line
+,            int16_t        y1		//< y end   position of the line
+, struct Draw_Clip   const *clip	//< pixels outside are not drawn (NULL: framebuffer)
+){
+	uint8_t          result = STATUS_OK;
+	struct Draw_Clip bounds;
 	
-	result = draw_line( framebuffer, pixel_value, x0, y0, x1, y0); if( result != STATUS_OK ){ return result; }
-	result = draw_line( framebuffer, pixel_value, x1, y0, x1, y1); if( result != STATUS_OK ){ return result; }
-	result = draw_line( framebuffer, pixel_value, x1, y1, x0, y1); if( result != STATUS_OK ){ return result; }
-	result = draw_line( framebuffer, pixel_value, x0, y1, x0, y0); if( result != STATUS_OK ){ return result; }
+	if( framebuffer == NULL ){
+		return STATUS_ERR_INVALID_ARG;
+	}
+	if( !clip_bounds( framebuffer, clip, &bounds ) ){
+		return STATUS_OK; // nothing visible
+	}
+	
+	if( x0 > x1 ){ int16_t x = x0; x0 = x1; x1 = x; } // make [x0,y0] the upper left
+	if( y0 > y1 ){ int16_t y = y0; y0 = y1; y1 = y; } // .. and [x1,y1] the lower right corner
+	
+	// top and bottom edge are horizontal spans, left and right edge vertical spans without the corners
+	// each pixel is drawn once, so degenerated rectangles XOR correctly too
+	result = clip_fill_hspan( framebuffer, &bounds, x0, x1, y0, pixel_value ); if( result != STATUS_OK ){ return result; }
+	if( y1 != y0 ){
+		result = clip_fill_hspan( framebuffer, &bounds, x0, x1, y1, pixel_value ); if( result != STATUS_OK ){ return result; }
+	}
+	if( y1 - y0 > 1 ){
+		result = clip_fill_vspan( framebuffer, &bounds, x0, y0 + 1, y1 - 1, pixel_value ); if( result != STATUS_OK ){ return result; }
+		if( x1 != x0 ){
+			result = clip_fill_vspan( framebuffer, &bounds, x1, y0 + 1, y1 - 1, pixel_value ); if( result != STATUS_OK ){ return result; }
+		}
+	}
 	
 	return result;
 }
 
+/**
+ * \brief Fill a rectangle form [x0,y0] to [x1,y1]
+ */
+uint8_t draw_rect_filled(
+  struct Framebuffer *framebuffer       //< pointer to the framebuffer to draw the pixel to
+,           uint32_t  pixel_value	//< value to set for the pixels
+,            int16_t  x0		//< x start position of the rectangle
+,            int16_t  y0		//< y start position of the rectangle
+,            int16_t  x1		//< x end   position of the rectangle
+,            int16_t  y1		//< y end   position of the rectangle
+){
+	return draw_rect_filled_clipped( framebuffer, pixel_value, x0, y0, x1, y1, NULL );
+}
+
+/**
+ * \brief Fill the pixels of a rectangle form [x0,y0] to [x1,y1], that are inside clip
+ */
+uint8_t draw_rect_filled_clipped(
+  struct Framebuffer       *framebuffer	//< pointer to the framebuffer to draw the pixel to
+,           uint32_t        pixel_value	//< value to set for the pixels
+,            int16_t        x0		//< x start position of the rectangle
+,            int16_t        y0		//< y start position of the rectangle
+,            int16_t        x1		//< x end   position of the rectangle
+,            int16_t        y1		//< y end   position of the rectangle
+, struct Draw_Clip   const *clip	//< pixels outside are not drawn (NULL: framebuffer)
+){
+	struct Draw_Clip bounds;
+	
+	if( framebuffer == NULL ){
+		return STATUS_ERR_INVALID_ARG;
+	}
+	if( !clip_bounds( framebuffer, clip, &bounds ) ){
+		return STATUS_OK; // nothing visible
+	}
+	
+	if( x0 > x1 ){ int16_t x = x0; x0 = x1; x1 = x; } // make [x0,y0] the upper left
+	if( y0 > y1 ){ int16_t y = y0; y0 = y1; y1 = y; } // .. and [x1,y1] the lower right corner
+	
+	if( x0 < bounds.x_min ) x0 = bounds.x_min;
+	if( y0 < bounds.y_min ) y0 = bounds.y_min;
+	if( x1 > bounds.x_max ) x1 = bounds.x_max;
+	if( y1 > bounds.y_max ) y1 = bounds.y_max;
+	if(( x0 > x1 ) || ( y0 > y1 )){
+		return STATUS_OK; // nothing visible
+	}
+	
+	return framebuffer_fill_rect( framebuffer, x0, y0, x1 - x0 + 1, y1 - y0 + 1, pixel_value );
+}
+
+/**
+ * \brief Fill the triangle [x0,y0], [x1,y1], [x2,y2]
+ */
+uint8_t draw_triangle_filled(
+  struct Framebuffer *framebuffer       //< pointer to the framebuffer to draw the pixel to
+,           uint32_t  pixel_value	//< value to set for the pixels
+,            int16_t  x0		//< x position of the 1st corner
+,            int16_t  y0		//< y position of the 1st corner
+,            int16_t  x1		//< x position of the 2nd corner
+,            int16_t  y1		//< y position of the 2nd corner
+,            int16_t  x2		//< x position of the 3rd corner
+,            int16_t  y2		//< y position of the 3rd corner
+){
+	return draw_triangle_filled_clipped( framebuffer, pixel_value, x0, y0, x1, y1, x2, y2, NULL );
+}
+
+/**
+ * \brief Fill the pixels of the triangle [x0,y0], [x1,y1], [x2,y2], that are inside clip
+ */
+uint8_t draw_triangle_filled_clipped(
+  struct Framebuffer       *framebuffer	//< pointer to the framebuffer to draw the pixel to
+,           uint32_t        pixel_value	//< value to set for the pixels
+,            int16_t        x0		//< x position of the 1st corner
+,            int16_t        y0		//< y position of the 1st corner
+,            int16_t        x1		//< x position of the 2nd corner
+,            int16_t        y1		//< y position of the 2nd corner
+,            int16_t        x2		//< x position of the 3rd corner
+,            int16_t        y2		//< y position of the 3rd corner
+, struct Draw_Clip   const *clip	//< pixels outside are not drawn (NULL: framebuffer)
+){
+	struct Draw_Point points[3] = {{ x0, y0 }, { x1, y1 }, { x2, y2 }};
+	
+	return draw_polygon_filled_clipped( framebuffer, pixel_value, points, 3, clip );
+}
@@ -36,6 +36,28 @@
 
 #include <asf.h>	                // This is an Atmel Software Foundation implementation
 #include "Framebuffer.h"
+#include "Stack.h"
+
+/**
+ *	Rectangle to clip drawing operations to, [x_min,y_min] and [x_max,y_max] are inside.
+ *
+ *	The \ref draw_*_clipped() functions draw only pixels inside the clip rectangle and the framebuffer.
+ *	A NULL clip rectangle clips to the framebuffer only.
+ */
+struct Draw_Clip {
+	int16_t x_min;			//< left   most column inside
+	int16_t y_min;			//< top    most row    inside
+	int16_t x_max;			//< right  most column inside
+	int16_t y_max;			//< bottom most row    inside
+};
+
+/**
+ *	Corner of a polygon.
+ */
+struct Draw_Point {
+	int16_t x;			//< column
+	int16_t y;			//< row
+};
 
 /**
  *	Implements the midpoint algorithm 
@@ -43,6 +65,8 @@
  *
  *	\see https://en.wikipedia.org/wiki/Midpoint_circle_algorithm
  *
+ *	The midpoint may be outside the framebuffer, only the visible pixels are drawn.
+ *
  *	\return Status of operation.
  *	\retval STATUS_OK               If operation was successfully
  *	\retval STATUS_ERR_INVALID_ARG  If \ref framebuffer is not assigned
@@ -50,16 +74,63 @@
 uint8_t draw_circle(
   struct Framebuffer *framebuffer       //< pointer to the framebuffer to draw the pixel to
 ,           uint32_t  pixel_value	//< value to set for the pixels
-,           uint16_t  x0		//< x start position of the line
-,           uint16_t  y0		//< y start position of the line
+,            int16_t  x0		//< x position of the midpoint
+,            int16_t  y0		//< y position of the midpoint
 ,           uint16_t  radius            //< radius in pixel to draw circle with
 );
 
+/**
+ *	Same as \ref draw_circle(), but draws only the pixels inside \ref clip.
+ *
+ *	A circle completely outside costs nothing. Of a partially visible circle only the octants
+ *	that may reach into \ref clip are drawn.
+ */
+uint8_t draw_circle_clipped(
+  struct Framebuffer       *framebuffer	//< pointer to the framebuffer to draw the pixel to
+,           uint32_t        pixel_value	//< value to set for the pixels
+,            int16_t        x0		//< x position of the midpoint
+,            int16_t        y0		//< y position of the midpoint
+,           uint16_t        radius	//< radius in pixel to draw circle with
+, struct Draw_Clip   const *clip	//< pixels outside are not drawn (NULL: framebuffer)
+);
+
+/**
+ *	Fill a circle with midpoint [\ref x0,\ref y0] and \ref radius.
+ *
+ *	The circle is drawn as horizontal spans, one per row. It covers the pixels of \ref draw_circle()
+ *	and every pixel between them.
+ *
+ *	\return Status of operation.
+ *	\retval STATUS_OK               If operation was successfully
+ *	\retval STATUS_ERR_INVALID_ARG  If \ref framebuffer is not assigned
+ */
+uint8_t draw_circle_filled(
+  struct Framebuffer *framebuffer       //< pointer to the framebuffer to draw the pixel to
+,           uint32_t  pixel_value	//< value to set for the pixels
+,            int16_t  x0		//< x position of the midpoint
+,            int16_t  y0		//< y position of the midpoint
+,           uint16_t  radius            //< radius in pixel to draw circle with
+);
+
+/**
+ *	Same as \ref draw_circle_filled(), but draws only the pixels inside \ref clip.
+ */
+uint8_t draw_circle_filled_clipped(
+  struct Framebuffer       *framebuffer	//< pointer to the framebuffer to draw the pixel to
+,           uint32_t        pixel_value	//< value to set for the pixels
+,            int16_t        x0		//< x position of the midpoint
+,            int16_t        y0		//< y position of the midpoint
+,           uint16_t        radius	//< radius in pixel to draw circle with
+, struct Draw_Clip   const *clip	//< pixels outside are not drawn (NULL: framebuffer)
+);
+
 /**
  *	Draw an ellipse inside the rectangle specified by [x0,y0], [x1,y1].
  *
  *	\see http://members.chello.at/~easyfilter/bresenham.html
  *
+ *	The rectangle may reach outside the framebuffer, only the visible pixels are drawn.
+ *
  *	\return Status of operation.
  *	\retval STATUS_OK               If operation was successfully
  *	\retval STATUS_ERR_INVALID_ARG	If \ref framebuffer is not assigned
@@ -67,20 +138,99 @@ uint8_t draw_circle(
 uint8_t draw_ellipse_rect(
   struct Framebuffer *framebuffer       //< pointer to the framebuffer to draw the pixel to
 ,           uint32_t  pixel_value	//< value to set for the pixels
-,           uint16_t  x0		//< x start position of the enclosing rectangle
-,           uint16_t  y0		//< y start position of the enclosing rectangle
-,           uint16_t  x1		//< x end   position of the enclosing rectangle
-,           uint16_t  y1		//< y end   position of the enclosing rectangle
+,            int16_t  x0		//< x start position of the enclosing rectangle
+,            int16_t  y0		//< y start position of the enclosing rectangle
+,            int16_t  x1		//< x end   position of the enclosing rectangle
+,            int16_t  y1		//< y end   position of the enclosing rectangle
+);
+
+/**
+ *	Same as \ref draw_ellipse_rect(), but draws only the pixels inside \ref clip.
+ *
+ *	An ellipse completely outside costs nothing. Of a partially visible ellipse only the quadrants
+ *	that may reach into \ref clip are drawn.
+ */
+uint8_t draw_ellipse_rect_clipped(
+  struct Framebuffer       *framebuffer	//< pointer to the framebuffer to draw the pixel to
+,           uint32_t        pixel_value	//< value to set for the pixels
+,            int16_t        x0		//< x start position of the enclosing rectangle
+,            int16_t        y0		//< y start position of the enclosing rectangle
+,            int16_t        x1		//< x end   position of the enclosing rectangle
+,            int16_t        y1		//< y end   position of the enclosing rectangle
+, struct Draw_Clip   const *clip	//< pixels outside are not drawn (NULL: framebuffer)
+);
+
+/**
+ *	Fill an ellipse inside the rectangle specified by [x0,y0], [x1,y1].
+ *
+ *	The ellipse is drawn as horizontal spans, one per row. It covers the pixels of \ref draw_ellipse_rect()
+ *	and every pixel between them.
+ *
+ *	\return Status of operation.
+ *	\retval STATUS_OK               If operation was successfully
+ *	\retval STATUS_ERR_INVALID_ARG	If \ref framebuffer is not assigned
+ */
+uint8_t draw_ellipse_rect_filled(
+  struct Framebuffer *framebuffer       //< pointer to the framebuffer to draw the pixel to
+,           uint32_t  pixel_value	//< value to set for the pixels
+,            int16_t  x0		//< x start position of the enclosing rectangle
+,            int16_t  y0		//< y start position of the enclosing rectangle
+,            int16_t  x1		//< x end   position of the enclosing rectangle
+,            int16_t  y1		//< y end   position of the enclosing rectangle
 );
 
+/**
+ *	Same as \ref draw_ellipse_rect_filled(), but draws only the pixels inside \ref clip.
+ */
+uint8_t draw_ellipse_rect_filled_clipped(
+  struct Framebuffer       *framebuffer	//< pointer to the framebuffer to draw the pixel to
+,           uint32_t        pixel_value	//< value to set for the pixels
+,            int16_t        x0		//< x start position of the enclosing rectangle
+,            int16_t        y0		//< y start position of the enclosing rectangle
+,            int16_t        x1		//< x end   position of the enclosing rectangle
+,            int16_t        y1		//< y end   position of the enclosing rectangle
+, struct Draw_Clip   const *clip	//< pixels outside are not drawn (NULL: framebuffer)
+);
+
+/**
+ *	Number of spans \ref draw_fill() keeps on the stack (8 bytes each).
+ */
+#ifndef DRAW_FILL_SPANS
+#define DRAW_FILL_SPANS 32
+#endif
+
+/**
+ *	Number of spans \ref draw_fill_spans() keeps on the call stack, when the span stack is full (8 bytes each).
+ */
+#ifndef DRAW_FILL_DROPPED
+#define DRAW_FILL_DROPPED 16
+#endif
+
+/**
+ *	A filled run of pixels, whose neighbour row still has to be scanned by the flood fill.
+ */
+struct Draw_Fill_Span {
+	uint16_t x_first;		//< x position of the left  most pixel of the run
+	uint16_t x_last;		//< x position of the right most pixel of the run
+	uint16_t y;			//< y position of the run
+	int16_t  dy;			//< row to scan next: y + dy (+1 or -1)
+};
+
+/**
+ *	Stack of \ref Draw_Fill_Span, see \ref STACK_DECLARE().
+ */
+STACK_DECLARE( Draw_Fill_Stack, draw_fill_stack, struct Draw_Fill_Span )
+
 /**
  *	Flood fill an area starting from point [x,y] with pixel_value_new.
  *
+ *	Same as \ref draw_fill_spans() with a span stack of \ref DRAW_FILL_SPANS entries on the call stack.
+ *
  *	\return Status of operation.
  *	\retval STATUS_OK               If operation was successfully
  *	\retval STATUS_ERR_INVALID_ARG	If \ref framebuffer is not assigned.
  *					Start point [x,y] is out of screen bounds.
- *	\retval STATUS_ERR_NO_MEMORY	If stack could not be allocated.
+ *	\retval STATUS_ERR_NO_MEMORY	If the spans did not fit, the area is filled partially.
  */
 uint8_t draw_fill(
   struct Framebuffer *framebuffer	//< pointer to the framebuffer to draw the pixel to
@@ -90,10 +240,45 @@ uint8_t draw_fill(
 ,           uint16_t  y			//< y start point
 );
 
+/**
+ *	Flood fill an area starting from point [x,y] with pixel_value_new, using a caller supplied span stack.
+ *
+ *	The fill works on whole runs of pixels: it finds the extent of a run with \ref framebuffer_scan_hspan(),
+ *	fills it with \ref framebuffer_fill_hspan() and remembers it in \ref spans, until the rows above and
+ *	below it are scanned for more runs. No memory is allocated, memory and time are bounded by the capacity
+ *	of \ref spans and the size of the area.
+ *
+ *	\ref spans is cleared at the start, its statistics are kept: spans->count_max tells the depth the fills
+ *	needed so far.
+ *
+ *	If \ref spans runs full, up to \ref DRAW_FILL_DROPPED spans, that do not fit, are put aside and followed,
+ *	once the stack is empty again. Only if these don't fit either, runs are filled, but not followed any further:
+ *	the fill stays inside the area, leaves a part of it unfilled and reports STATUS_ERR_NO_MEMORY.
+ *	Pixels, that had pixel_value_new before, can not be told from filled ones, so there is no way to find
+ *	the unfilled part afterwards, other than a deeper \ref spans (see spans->count_max).
+ *
+ *	\return Status of operation.
+ *	\retval STATUS_OK               If operation was successfully
+ *	\retval STATUS_ERR_INVALID_ARG	If \ref framebuffer or \ref spans is not assigned
+ *					or start point [x,y] is out of screen bounds.
+ *	\retval STATUS_ERR_NO_MEMORY	If the spans did not fit, the area is filled partially.
+ */
+uint8_t draw_fill_spans(
+  struct Framebuffer     *framebuffer		//< pointer to the framebuffer to draw the pixel to
+,           uint32_t      pixel_value		//< current value of pixels to change
+,           uint32_t      pixel_value_new	//< new value pixels are set to
+,           uint16_t      x			//< x start point
+,           uint16_t      y			//< y start point
+, struct Draw_Fill_Stack *spans			//< span stack to use, initialized with draw_fill_stack_init()
+);
+
 /**
  *	Implements Bresenham's line algorithm 
  *	to set \ref pixel_value for a line of pixels form [\ref x0,\ref y0] to [\ref x1,\ref y1].
  *
+ *	Horizontal and vertical lines are drawn as spans.
+ *	The end points may be outside the framebuffer, only the visible part of the line is drawn.
+ *
  *	\see http://members.chello.at/~easyfilter/bresenham.html
  *
  *	\return Status of operation.
@@ -103,15 +288,64 @@ uint8_t draw_fill(
 uint8_t draw_line(
   struct Framebuffer *framebuffer       //< pointer to the framebuffer to draw the pixel to
 ,           uint32_t  pixel_value	//< value to set for the pixels
-,           uint16_t  x0		//< x start position of the line
-,           uint16_t  y0		//< y start position of the line
-,           uint16_t  x1		//< x end   position of the line
-,           uint16_t  y1		//< y end   position of the line
+,            int16_t  x0		//< x start position of the line
+,            int16_t  y0		//< y start position of the line
+,            int16_t  x1		//< x end   position of the line
+,            int16_t  y1		//< y end   position of the line
+);
+
+/**
+ *	Same as \ref draw_line(), but draws only the pixels inside \ref clip.
+ *
+ *	The line is clipped before it is rasterized: the steps inside \ref clip are computed up front
+ *	and Bresenham's error term is set up for the first visible pixel, so the visible part has exactly
+ *	the pixels of the unclipped line and the invisible part costs nothing.
+ */
+uint8_t draw_line_clipped(
+  struct Framebuffer       *framebuffer	//< pointer to the framebuffer to draw the pixel to
+,           uint32_t        pixel_value	//< value to set for the pixels
+,            int16_t        x0		//< x start position of the line
+,            int16_t        y0		//< y start position of the line
+,            int16_t        x1		//< x end   position of the line
+,            int16_t        y1		//< y end   position of the line
+, struct Draw_Clip   const *clip	//< pixels outside are not drawn (NULL: framebuffer)
+);
+
+/**
+ *	Fill a convex polygon with the corners \ref points.
+ *
+ *	The polygon is drawn as horizontal spans, one per row. Each row spans from the left most to the right
+ *	most pixel, the lines between the corners have in that row. The corners have to be given in order,
+ *	clockwise or counterclockwise. For a polygon, that is not convex, only the pixels inside the bounding
+ *	box of \ref points are changed, which ones is not specified.
+ *
+ *	\return Status of operation.
+ *	\retval STATUS_OK               If operation was successfully
+ *	\retval STATUS_ERR_INVALID_ARG	If \ref framebuffer or \ref points is not assigned or \ref count is 0
+ */
+uint8_t draw_polygon_filled(
+  struct Framebuffer       *framebuffer	//< pointer to the framebuffer to draw the pixel to
+,           uint32_t        pixel_value	//< value to set for the pixels
+, struct Draw_Point  const *points	//< corners of the polygon
+,           uint16_t        count	//< number of corners
+);
+
+/**
+ *	Same as \ref draw_polygon_filled(), but draws only the pixels inside \ref clip.
+ */
+uint8_t draw_polygon_filled_clipped(
+  struct Framebuffer       *framebuffer	//< pointer to the framebuffer to draw the pixel to
+,           uint32_t        pixel_value	//< value to set for the pixels
+, struct Draw_Point  const *points	//< corners of the polygon
+,           uint16_t        count	//< number of corners
+, struct Draw_Clip   const *clip	//< pixels outside are not drawn (NULL: framebuffer)
 );
 
 /**
  *	Draw a rectangle form [\ref x0,\ref y0] to [\ref x1,\ref y1]
- *	using \ref draw_line.
+ *	using horizontal and vertical spans.
+ *
+ *	The corners may be outside the framebuffer, only the visible edges are drawn.
  *
  *	\return Status of operation.
  *	\retval STATUS_OK               If operation was successfully
@@ -120,10 +354,87 @@ uint8_t draw_line(
 uint8_t draw_rect(
   struct Framebuffer *framebuffer       //< pointer to the framebuffer to draw the pixel to
 ,           uint32_t  pixel_value	//< value to set for the pixels
-,           uint16_t  x0		//< x start position of the line
-,           uint16_t  y0		//< y start position of the line
-,           uint16_t  x1		//< x end   position of the line
-,           uint16_t  y1		//< y end   position of the line
+,            int16_t  x0		//< x start position of the line
+,            int16_t  y0		//< y start position of the line
+,            int16_t  x1		//< x end   position of the line
+,            int16_t  y1		//< y end   position of the line
+);
+
+/**
+ *	Same as \ref draw_rect(), but draws only the pixels inside \ref clip.
+ */
+uint8_t draw_rect_clipped(
+  struct Framebuffer       *framebuffer	//< pointer to the framebuffer to draw the pixel to
+,           uint32_t        pixel_value	//< value to set for the pixels
+,            int16_t        x0		//< x start position of the line
+,            int16_t        y0		//< y start position of the line
+,            int16_t        x1		//< x end   position of the line
+,            int16_t        y1		//< y end   position of the line
+, struct Draw_Clip   const *clip	//< pixels outside are not drawn (NULL: framebuffer)
+);
+
+/**
+ *	Fill the rectangle form [\ref x0,\ref y0] to [\ref x1,\ref y1], borders included,
+ *	with one \ref framebuffer_fill_rect().
+ *
+ *	\return Status of operation.
+ *	\retval STATUS_OK               If operation was successfully
+ *	\retval STATUS_ERR_INVALID_ARG	If \ref framebuffer is not assigned
+ */
+uint8_t draw_rect_filled(
+  struct Framebuffer *framebuffer       //< pointer to the framebuffer to draw the pixel to
+,           uint32_t  pixel_value	//< value to set for the pixels
+,            int16_t  x0		//< x start position of the rectangle
+,            int16_t  y0		//< y start position of the rectangle
+,            int16_t  x1		//< x end   position of the rectangle
+,            int16_t  y1		//< y end   position of the rectangle
+);
+
+/**
+ *	Same as \ref draw_rect_filled(), but draws only the pixels inside \ref clip.
+ */
+uint8_t draw_rect_filled_clipped(
+  struct Framebuffer       *framebuffer	//< pointer to the framebuffer to draw the pixel to
+,           uint32_t        pixel_value	//< value to set for the pixels
+,            int16_t        x0		//< x start position of the rectangle
+,            int16_t        y0		//< y start position of the rectangle
+,            int16_t        x1		//< x end   position of the rectangle
+,            int16_t        y1		//< y end   position of the rectangle
+, struct Draw_Clip   const *clip	//< pixels outside are not drawn (NULL: framebuffer)
+);
+
+/**
+ *	Fill the triangle with the corners [\ref x0,\ref y0], [\ref x1,\ref y1] and [\ref x2,\ref y2],
+ *	see \ref draw_polygon_filled().
+ *
+ *	\return Status of operation.
+ *	\retval STATUS_OK               If operation was successfully
+ *	\retval STATUS_ERR_INVALID_ARG	If \ref framebuffer is not assigned
+ */
+uint8_t draw_triangle_filled(
+  struct Framebuffer *framebuffer       //< pointer to the framebuffer to draw the pixel to
+,           uint32_t  pixel_value	//< value to set for the pixels
+,            int16_t  x0		//< x position of the 1st corner
+,            int16_t  y0		//< y position of the 1st corner
+,            int16_t  x1		//< x position of the 2nd corner
+,            int16_t  y1		//< y position of the 2nd corner
+,            int16_t  x2		//< x position of the 3rd corner
+,            int16_t  y2		//< y position of the 3rd corner
+);
+
+/**
+ *	Same as \ref draw_triangle_filled(), but draws only the pixels inside \ref clip.
+ */
+uint8_t draw_triangle_filled_clipped(
+  struct Framebuffer       *framebuffer	//< pointer to the framebuffer to draw the pixel to
+,           uint32_t        pixel_value	//< value to set for the pixels
+,            int16_t        x0		//< x position of the 1st corner
+,            int16_t        y0		//< y position of the 1st corner
+,            int16_t        x1		//< x position of the 2nd corner
+,            int16_t        y1		//< y position of the 2nd corner
+,            int16_t        x2		//< x position of the 3rd corner
+,            int16_t        y2		//< y position of the 3rd corner
+, struct Draw_Clip   const *clip	//< pixels outside are not drawn (NULL: framebuffer)
 );
 
 #endif
\ No newline at end of file
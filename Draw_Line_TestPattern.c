@@ -32,10 +32,31 @@
 
  */
 
-#include "Adafruit_FeatherWing_OLED.h"
 #include "Draw.h"
 #include "Draw_Line_TestPattern.h"
 
+/**
+ * \brief       Draws a line of the test pattern and presents the framebuffer.
+ */
+static enum status_code draw_line_present(
+  struct Framebuffer *framebuffer       //< pointer to the framebuffer to draw the line to
+,           uint32_t  pixel_value       //< value to set for the pixels
+,           uint16_t  x0                //< x start position of the line
+,           uint16_t  y0                //< y start position of the line
+,           uint16_t  x1                //< x end   position of the line
+,           uint16_t  y1                //< y end   position of the line
+, Draw_Line_TestPattern_Present *present //< show the framebuffer after the line (NULL: don't)
+){
+         enum status_code  status = draw_line( framebuffer, pixel_value, x0, y0, x1, y1 );
+         
+         if( ( status != STATUS_OK ) || ( present == NULL ) ){
+                 return status;
+         }
+         
+         status = present( framebuffer );
+         
+         return ( status == STATUS_NO_CHANGE ) ? STATUS_OK : status;    // the line goes out with the next frame
+}
 
 /**
  * \brief       Draws a test pattern to the screen at the location specified,
@@ -50,6 +71,7 @@ enum status_code draw_line_testpattern(
 ,           uint16_t  yMin              //< y end   position of the line
 ,           uint16_t  xMax              //< x end   position of the line
 ,           uint16_t  yMax              //< y end   position of the line
+, Draw_Line_TestPattern_Present *present //< show the framebuffer after each line (NULL: don't)
 ){
          enum status_code  status = STATUS_OK;
          int32_t  x      = 0;
@@ -58,8 +80,7 @@ enum status_code draw_line_testpattern(
          // sector 0
          for( y = y0; y <= yMax; y++ ) {
                  
-                 status = draw_line( framebuffer, pixel_value,   x0,  y0, xMax,  y)
-                 || featherWing_OLED_update( framebuffer );
+                 status = draw_line_present( framebuffer, pixel_value,   x0,  y0, xMax,  y, present );
                  
                  if( status != STATUS_OK ){
                          return status;
@@ -70,8 +91,7 @@ enum status_code draw_line_testpattern(
          // sector 1
          for( x = xMax; x >= x0 ; x-- ) {
                  
-                 status = draw_line( framebuffer, pixel_value,   x0,  y0, x,  yMax)
-                 || featherWing_OLED_update( framebuffer );
+                 status = draw_line_present( framebuffer, pixel_value,   x0,  y0, x,  yMax, present );
                  
                  if( status != STATUS_OK ){
                          return status;
@@ -82,8 +102,7 @@ enum status_code draw_line_testpattern(
          // sector 2
          for( x = x0; x >= xMin; x-- ) {
                  
-                 status = draw_line( framebuffer, pixel_value,   x0,  y0, x,  yMax)
-                 || featherWing_OLED_update( framebuffer );
+                 status = draw_line_present( framebuffer, pixel_value,   x0,  y0, x,  yMax, present );
                  
                  if( status != STATUS_OK ){
                          return status;
@@ -94,8 +113,7 @@ enum status_code draw_line_testpattern(
          // sector 3
          for( y = yMax; y >= y0; y-- ) {
                  
-                 status = draw_line( framebuffer, pixel_value,   x0,  y0, xMin,  y)
-                 || featherWing_OLED_update( framebuffer );
+                 status = draw_line_present( framebuffer, pixel_value,   x0,  y0, xMin,  y, present );
                  
                  if( status != STATUS_OK ){
                          return status;
@@ -106,8 +124,7 @@ enum status_code draw_line_testpattern(
          // sector 4
          for( y = y0; y >= yMin; y-- ) {
                  
-                 status = draw_line( framebuffer, pixel_value,   x0,  y0, xMin,  y)
-                 || featherWing_OLED_update( framebuffer );
+                 status = draw_line_present( framebuffer, pixel_value,   x0,  y0, xMin,  y, present );
                  
                  if( status != STATUS_OK ){
                          return status;
@@ -118,8 +135,7 @@ enum status_code draw_line_testpattern(
          // sector 5
          for( x = xMin; x <= x0; x++ ) {
                  
-                 status = draw_line( framebuffer, pixel_value,   x0,  y0, x,  yMin)
-                 || featherWing_OLED_update( framebuffer );
+                 status = draw_line_present( framebuffer, pixel_value,   x0,  y0, x,  yMin, present );
                  
                  if( status != STATUS_OK ){
                          return status;
@@ -130,8 +146,7 @@ enum status_code draw_line_testpattern(
          // sector 6
          for( x = x0; x <= xMax; x++ ) {
                  
-                 status = draw_line( framebuffer, pixel_value,   x0,  y0, x,  yMin)
-                 || featherWing_OLED_update( framebuffer );
+                 status = draw_line_present( framebuffer, pixel_value,   x0,  y0, x,  yMin, present );
                  
                  if( status != STATUS_OK ){
                          return status;
@@ -142,8 +157,7 @@ enum status_code draw_line_testpattern(
          // sector 7
          for( y = yMin; y <= y0; y++ ) {
                  
-                 status = draw_line( framebuffer, pixel_value,   x0,  y0, xMax,  y)
-                 || featherWing_OLED_update( framebuffer );
+                 status = draw_line_present( framebuffer, pixel_value,   x0,  y0, xMax,  y, present );
                  
                  if( status != STATUS_OK ){
                          return status;
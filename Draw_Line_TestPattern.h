@@ -35,6 +35,9 @@
 #define DRAW_LINE_TESTPATTERN_H
 
 #include <asf.h>
+#include "Framebuffer.h"
+
+typedef enum status_code Draw_Line_TestPattern_Present( struct Framebuffer *framebuffer ); //< show the framebuffer after a line was drawn
 
 /**
  * Draw a test pattern using the \ref draw_line() function.
@@ -44,12 +47,14 @@
  * \note   Lines are drawn to all sectors from [\ref x0, \ref yo], 
  *         filling the rectangle from [\ref xMin, \ref yMin] to [\ref xMax, \ref yMax].
  *
- * \note   If a reference to the i2c_master_module, the OLED is connected to, is provided,
- *         the display will be updated after each line drawn.
+ * \note   The framebuffer is handed to \ref present after each line drawn 
+ *         (e.g. \ref featherWing_OLED_present()). Lines still pending in a 
+ *         paced present have to be sent by the caller when done.
  *
  * \return Status of operation.
  * \retval STATUS_OK                    If operation was successfully
  * \retval STATUS_ERR_INVALID_ARG       If \ref framebuffer is not assigned
+ * \retval any                          Status of \ref present
  */
 enum status_code draw_line_testpattern(
   struct Framebuffer *framebuffer       //< pointer to the framebuffer to draw the pixel to
@@ -60,6 +65,7 @@ enum status_code draw_line_testpattern(
 ,           uint16_t  yMin              //< y end   position of the line
 ,           uint16_t  xMax              //< x end   position of the line
 ,           uint16_t  yMax              //< y end   position of the line
+, Draw_Line_TestPattern_Present *present //< show the framebuffer after each line (NULL: don't)
 );
 
 #endif
@@ -0,0 +1,292 @@
+/**     \file   Draw_Test_Fill.c
+
+        \brief  Host test of the flood fill with span stacks too small for the area.
+ 
+        \license 
+                MIT: The MIT License (https://opensource.org/licenses/MIT)
+                .
+                Permission is hereby granted, free of charge, to any person obtaining a copy of this software 
+                and associated documentation files (the "Software"), to deal in the Software without restriction, 
+                including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+                and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, 
+                subject to the following conditions:
+                .
+                The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+                .
+                THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+                INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. 
+                IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+                WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR 
+                THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ 
+        \copyright
+                DIT: 2026; Drechsler Information Technologies; www.drechsler-it.de
+ 
+        \authors
+                jrgdre: Joerg Drechsler; DIT
+ 
+        \versions
+                1.0.0: 2026-10-17 jrgdre initial release
+
+ */
+#include <string.h>                     // memset
+#include "Draw.h"                       // flood fill tested
+#include "Framebuffer_SSD1306.h"        // framebuffer to fill in
+#include "SSD1306.h"                    // geometry
+#include "Test.h"                       // checks
+
+/**
+ * \brief Create a cleared 128x64 framebuffer
+ */
+static struct Framebuffer *setup (
+  void
+){
+        struct Framebuffer *fb = framebuffer_SSD1306_create( SSD1306_COLUMNS, SSD1306_GEOMETRY_128x64 );
+        
+        fb->clear( fb );  // the tiles of a new framebuffer are undefined
+        
+        return fb;
+}
+
+/**
+ * \brief Picture to fill, a byte per pixel, and the area a reference fill finds in it
+ */
+static uint8_t picture[64][128];
+static uint8_t area   [64][128];
+
+/**
+ * \brief Copy the framebuffer into \ref picture
+ */
+static void picture_take (
+  struct Framebuffer *const fb                  //< framebuffer to copy
+){
+        uint32_t value;
+        
+        for( uint32_t y = 0; y < fb->height; y++ ){
+                for( uint32_t x = 0; x < fb->width; x++ ){
+                        fb->get_pixel( fb, x, y, &value );
+                        picture[y][x] = (uint8_t)value;
+                }
+        }
+}
+
+/**
+ * \brief Mark the pixels of \ref picture 4-connected to [x,y] having pixel_value in \ref area, pixel by pixel
+ */
+static void area_find (
+  uint32_t const pixel_value                    //< value of the pixels of the area
+, uint32_t const x                              //< x position of the seed
+, uint32_t const y                              //< y position of the seed
+){
+        static uint16_t queue[64 * 128];
+        uint32_t        head = 0;
+        uint32_t        tail = 0;
+        
+        memset( area, 0x00, sizeof( area ) );
+        if( picture[y][x] != pixel_value ){
+                return;
+        }
+        area[y][x]    = 1;
+        queue[tail++] = ( y << 7 ) | x;
+        
+        while( head < tail ){
+                int32_t const px = queue[head] & 0x7F;
+                int32_t const py = queue[head] >> 7;
+                
+                head++;
+                for( uint_fast8_t n = 0; n < 4; n++ ){
+                        int32_t const nx = px + ( n == 0 ) - ( n == 1 );
+                        int32_t const ny = py + ( n == 2 ) - ( n == 3 );
+                        
+                        if(( nx < 0 ) || ( nx >= 128 ) || ( ny < 0 ) || ( ny >= 64 )
+                        || ( area[ny][nx] ) || ( picture[ny][nx] != pixel_value )
+                        ){
+                                continue;
+                        }
+                        area[ny][nx]  = 1;
+                        queue[tail++] = ( ny << 7 ) | nx;
+                }
+        }
+}
+
+/**
+ * \brief Check a fill from [x,y] against the reference fill
+ *
+ * Filled completely, the framebuffer shows the area set, partially filled, it shows some of it set.
+ * Pixels outside the area never change.
+ *
+ * \return Status of the fill.
+ */
+static enum status_code fill_check (
+  struct Framebuffer     *const fb              //< framebuffer to fill in
+, struct Draw_Fill_Stack *const spans           //< span stack to use (NULL: draw_fill())
+,               uint32_t  const x               //< x position of the seed
+,               uint32_t  const y               //< y position of the seed
+){
+        enum status_code status;
+        uint32_t         value;
+        uint32_t         wrong = 0;
+        
+        picture_take( fb );
+        area_find( 0, x, y );
+        
+        status = ( spans != NULL ) ? draw_fill_spans( fb, 0, 1, x, y, spans ) : draw_fill( fb, 0, 1, x, y );
+        TEST_CHECK(( status == STATUS_OK ) || ( status == STATUS_ERR_NO_MEMORY ));
+        
+        for( uint32_t py = 0; py < fb->height; py++ ){
+                for( uint32_t px = 0; px < fb->width; px++ ){
+                        fb->get_pixel( fb, px, py, &value );
+                        if( area[py][px] ? (( status == STATUS_OK ) && ( value != 1 )) : ( value != picture[py][px] ) ){
+                                wrong++;
+                        }
+                }
+        }
+        TEST_CHECK( wrong == 0 );
+        
+        return status;
+}
+
+/**
+ * \brief Draw a comb: teeth on the odd columns, open to the top row and, if both, to the bottom row
+ */
+static void draw_comb (
+  struct Framebuffer *const fb                  //< framebuffer to draw to
+,               bool  const both                //< the bottom row is open, too
+,           uint32_t  const width               //< columns of the comb, the ones right of it are a wall
+){
+        for( uint32_t x = width; x < fb->width; x++ ){
+                framebuffer_fill_vspan( fb, x, 0, fb->height, 1 );
+        }
+        for( uint32_t x = 1; x < width; x += 2 ){
+                framebuffer_fill_vspan( fb, x, 1, fb->height - ( both ? 2 : 1 ), 1 );
+        }
+}
+
+/**
+ * \brief A comb is filled exactly, with stacks too small for its gaps filled partially, but never beyond
+ */
+static void test_comb (
+  void
+){
+        static uint32_t const capacities[] = { 1, 4, 16, 128 };
+        
+        for( uint_fast8_t both = 0; both < 2; both++ ){
+                for( uint_fast8_t c = 0; c < sizeof( capacities ) / sizeof( capacities[0] ); c++ ){
+                        struct Framebuffer    *fb = setup();
+                        struct Draw_Fill_Span  entries[128];
+                        struct Draw_Fill_Stack spans;
+                        enum status_code       status;
+                        
+                        draw_fill_stack_init( &spans, entries, capacities[c] );
+                        draw_comb( fb, both, fb->width );
+                        
+                        status = fill_check( fb, &spans, 0, fb->height - 1 );
+                        TEST_CHECK( spans.count_max <= capacities[c] );
+                        TEST_CHECK(( capacities[c] < 128 ) || ( status == STATUS_OK ));
+                        
+                        fb->destroy( fb );
+                }
+        }
+}
+
+/**
+ * \brief An outlined comb, whose stack runs full, doesn't leak into lines of the new value next to it
+ */
+static void test_outlined_comb (
+  void
+){
+        static uint32_t const capacities[] = { 1, 4, 16 };
+        
+        for( uint_fast8_t c = 0; c < sizeof( capacities ) / sizeof( capacities[0] ); c++ ){
+                struct Framebuffer    *fb = setup();
+                struct Draw_Fill_Span  entries[16];
+                struct Draw_Fill_Stack spans;
+                
+                draw_fill_stack_init( &spans, entries, capacities[c] );
+                
+                // comb in the left half, lines of the new value in the right half, in the rows of the comb
+                fb->fill_rect( fb, 0, 0, 64, 64, 1 );
+                fb->fill_rect( fb, 1, 1, 62, 62, 0 );
+                for( uint32_t x = 2; x < 62; x += 2 ){
+                        framebuffer_fill_vspan( fb, x, 2, 61, 1 );
+                }
+                for( uint32_t y = 0; y < 64; y += 3 ){
+                        framebuffer_fill_hspan( fb, 64, y, 64, 1 );
+                }
+                
+                fill_check( fb, &spans, 1, 1 );
+                TEST_CHECK( spans.overflows > 0 );
+                
+                fb->destroy( fb );
+        }
+}
+
+/**
+ * \brief Fills of random pictures match the reference fill, overflowing stacks fill partially, but never beyond
+ */
+static void test_random (
+  void
+){
+        static uint32_t const capacities[] = { 2, 8, 32 };
+        uint32_t              seed         = 1;
+        uint32_t              complete     = 0;     // fills completed, although the stack ran full
+        
+        for( uint32_t picture_idx = 0; picture_idx < 300; picture_idx++ ){
+                struct Framebuffer    *fb = setup();
+                struct Draw_Fill_Span  entries[32];
+                struct Draw_Fill_Stack spans;
+                uint32_t               capacity = capacities[ picture_idx % 3 ];
+                
+                draw_fill_stack_init( &spans, entries, capacity );
+                
+                // about a third of the pixels set, which leaves a large area with many branches
+                for( uint32_t y = 0; y < fb->height; y++ ){
+                        for( uint32_t x = 0; x < fb->width; x++ ){
+                                seed = ( seed * 1103515245 ) + 12345;
+                                fb->set_pixel( fb, x, y, (( seed >> 16 ) % 3 ) == 0 );
+                        }
+                }
+                seed = ( seed * 1103515245 ) + 12345;
+                
+                uint32_t x = ( seed >> 16 ) % fb->width;
+                uint32_t y = ( seed >> 8  ) % fb->height;
+                
+                if(( fill_check( fb, ( picture_idx & 1 ) ? &spans : NULL, x, y ) == STATUS_OK )
+                && ( picture_idx & 1 ) && ( spans.overflows > 0 )
+                ){
+                        complete++;
+                }
+                
+                fb->destroy( fb );
+        }
+        TEST_CHECK( complete > 0 );
+}
+
+/**
+ * \brief draw_fill() fills a comb of 16 teeth with its default stack, one of 64 partially
+ */
+static void test_default_stack (
+  void
+){
+        struct Framebuffer *fb = setup();
+        
+        draw_comb( fb, true, 32 );
+        TEST_CHECK( fill_check( fb, NULL, 0, 0 ) == STATUS_OK );
+        
+        fb->clear( fb );
+        draw_comb( fb, true, fb->width );
+        TEST_CHECK( fill_check( fb, NULL, 0, 0 ) == STATUS_ERR_NO_MEMORY );
+        
+        fb->destroy( fb );
+}
+
+int main (
+  void
+){
+        test_comb();
+        test_outlined_comb();
+        test_random();
+        test_default_stack();
+        
+        return TEST_RESULT();
+}
@@ -0,0 +1,441 @@
+/**     \file   Font.c
+
+        \brief  Table driven renderer shared by all fonts.
+ 
+        \license 
+                MIT: The MIT License (https://opensource.org/licenses/MIT)
+                .
+                Permission is hereby granted, free of charge, to any person obtaining a copy of this software 
+                and associated documentation files (the "Software"), to deal in the Software without restriction, 
+                including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+                and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, 
+                subject to the following conditions:
+                .
+                The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+                .
+                THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+                INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. 
+                IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+                WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR 
+                THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ 
+        \copyright
+                DIT: 2026; Drechsler Information Technologies; www.drechsler-it.de
+ 
+        \authors
+                jrgdre: Joerg Drechsler; DIT
+ 
+        \versions
+                1.0.0: 2026-10-17 jrgdre initial release
+
+ */
+#include "Font.h"                       // font interface
+
+// ===========================================================================
+//  private
+// ===========================================================================
+
+#define FONT_CLIP_COLUMNS 16            //< glyph columns shifted per framebuffer call, if a glyph is clipped at the top
+
+/**
+ * \brief Bounds of a clip rectangle, [x0,x1) x [y0,y1)
+ */
+struct Font_Clip {
+        int32_t x0; //< left   most column inside
+        int32_t y0; //< top    most row    inside
+        int32_t x1; //< column behind the right  most column inside
+        int32_t y1; //< row    behind the bottom most row    inside
+};
+
+/**
+ * \brief Get the index of the glyph of a character
+ *
+ * Characters without a glyph get the glyph of \ref font->code_default.
+ */
+static inline uint_fast8_t font_glyph_idx (
+  struct Font const *const font         //< font to look the glyph up in
+,        char        const character    //< character to look up
+){
+        uint_fast8_t glyph_idx = (uint8_t)character; // chars may be signed, code points are not
+        
+        if(( glyph_idx < font->code_first )
+        || ( glyph_idx > font->code_last  )
+        ){
+                glyph_idx = font->code_default;
+        }
+        
+        return glyph_idx - font->code_first;
+};
+
+/**
+ * \brief Look up the glyph of a character
+ *
+ * \return Width of the glyph in pixel.
+ */
+static inline uint8_t font_glyph (
+  struct Font    const  *const font             //< font to look the glyph up in
+,           char         const character        //< character to look up
+,       uint8_t  const **const columns          //< [out] first column of the glyph's first stripe
+){
+        uint_fast8_t glyph_idx = font_glyph_idx( font, character );
+        
+        *columns = &font->bitmap[ font->offsets[ glyph_idx ] ];
+        
+        return font->widths[ glyph_idx ];
+};
+
+/**
+ * \brief Draw the stripes of a glyph
+ */
+static inline enum status_code font_glyph_draw (
+  struct Framebuffer *const framebuffer         //< framebuffer to draw to
+, struct Font  const *const font                //< font of the glyph
+,       uint8_t const *     columns             //< first column of the glyph's first stripe
+,       uint8_t       const width               //< width of the glyph in pixel
+,      uint32_t       const pixel_value         //< value to set for the pixels
+,      uint16_t       const x0                  //< x position of the glyph's upper left corner
+,      uint16_t       const y0                  //< y position of the glyph's upper left corner
+,          bool       const opaque              //< if true, background pixels are set to 0x00
+){
+        enum status_code status = STATUS_OK;
+        
+        for( uint_fast8_t row = 0; row < font->height; row += 8, columns += width ){
+                uint_fast8_t rows = font->height - row < 8 ? font->height - row : 8;
+                
+                status = framebuffer_blit_columns( framebuffer, x0, y0 + row, width, rows, columns, pixel_value, opaque );
+                if( status != STATUS_OK ){
+                        break;
+                }
+        }
+        
+        return status;
+};
+
+/**
+ * \brief Draw the part of a glyph inside a clip rectangle
+ *
+ * Glyphs completely outside the clip rectangle do not touch the framebuffer.
+ */
+static enum status_code font_glyph_draw_clipped (
+  struct Framebuffer *const framebuffer         //< framebuffer to draw to
+, struct Font  const *const font                //< font of the glyph
+,       uint8_t const *     columns             //< first column of the glyph's first stripe
+,       uint8_t       const width               //< width of the glyph in pixel
+,      uint32_t       const pixel_value         //< value to set for the pixels
+,       int32_t       const x0                  //< x position of the glyph's upper left corner
+,       int32_t       const y0                  //< y position of the glyph's upper left corner
+, struct Font_Clip const *const clip            //< pixels outside are not drawn
+,          bool       const opaque              //< if true, background pixels are set to 0x00
+){
+        enum status_code status = STATUS_OK;
+        
+        int32_t const column_first = clip->x0 > x0         ? clip->x0 - x0 : 0;
+        int32_t const column_end   = clip->x1 < x0 + width ? clip->x1 - x0 : width;
+        
+        if(( column_first >= column_end                 )
+        || ( y0               >= clip->y1               )
+        || ( y0 + font->height <= clip->y0              )
+        ){
+                return STATUS_OK;
+        }
+        
+        for( uint_fast8_t row = 0; row < font->height; row += 8, columns += width ){
+                int32_t const y         = y0 + row;
+                int32_t const rows      = font->height - row < 8 ? font->height - row : 8;
+                int32_t const row_first = clip->y0 > y        ? clip->y0 - y : 0;
+                int32_t const row_end   = clip->y1 < y + rows ? clip->y1 - y : rows;
+                
+                if( row_first >= row_end ){
+                        continue;
+                }
+                if( row_first == 0 ){
+                        status = framebuffer_blit_columns( framebuffer, x0 + column_first, y, column_end - column_first, row_end, 
+                                                           &columns[ column_first ], pixel_value, opaque );
+                } else {
+                        // shift the rows inside the clip rectangle down to bit 0
+                        uint8_t shifted[FONT_CLIP_COLUMNS];
+                        
+                        for( int32_t column = column_first; ( status == STATUS_OK ) && ( column < column_end ); column += FONT_CLIP_COLUMNS ){
+                                int32_t count = column_end - column < FONT_CLIP_COLUMNS ? column_end - column : FONT_CLIP_COLUMNS;
+                                
+                                for( int32_t idx = 0; idx < count; idx++ ){
+                                        shifted[ idx ] = columns[ column + idx ] >> row_first;
+                                }
+                                status = framebuffer_blit_columns( framebuffer, x0 + column, y + row_first, count, row_end - row_first, 
+                                                                   shifted, pixel_value, opaque );
+                        }
+                }
+                if( status != STATUS_OK ){
+                        break;
+                }
+        }
+        
+        return status;
+};
+
+/**
+ * \brief Find the end of the line starting at \ref line
+ *
+ * A line ends at the end of the text, at a '\n' or, if \ref wrap, before the word that does not fit into \ref width_max 
+ * any more. A word wider than \ref width_max is broken between two characters.
+ *
+ * \return Character behind the last character of the line.
+ */
+static char const *font_line_end (
+  struct Font const  *const font        //< font to measure with
+,        char const  *const line        //< first character of the line
+,    uint16_t         const width_max   //< width available for the line in pixel
+,        bool         const wrap        //< if true, break lines wider than width_max
+,    uint16_t        *const line_width  //< [out] width of the line in pixel
+,        char const **const next        //< [out] first character of the next line
+){
+        char const *end         = line;
+        char const *space       = NULL;         // last space the line can be broken at
+        uint16_t    space_width = 0;            // width of the line in front of space
+        uint16_t    width       = 0;            // width of the line up to end
+        
+        for( ; ( *end != 0x00 ) && ( *end != '\n' ); end++ ){
+                uint16_t width_new = font->widths[ font_glyph_idx( font, *end ) ];
+                
+                if( end != line ){
+                        width_new += width + font->spacing;
+                        if( *end == ' ' ){
+                                space       = end;
+                                space_width = width;
+                        }
+                        if( wrap && ( width_new > width_max ) ){
+                                if( space != NULL ){
+                                        end   = space;
+                                        width = space_width;
+                                }
+                                *line_width = width;
+                                for( *next = end; **next == ' '; (*next)++ ); // a wrapped line does not start with spaces
+                                return end;
+                        }
+                }
+                width = width_new;
+        }
+        
+        *line_width = width;
+        *next       = *end == '\n' ? end + 1 : end;
+        return end;
+};
+
+// ===========================================================================
+//  public
+// ===========================================================================
+
+/**
+ * \asserts ( font != NULL )
+ */
+enum status_code font_draw_character (
+  struct Framebuffer *framebuffer       //< pointer to the framebuffer to draw the bitmap to
+, struct Font const  *font              //< font to draw with
+,               char  character         //< character to draw
+,           uint32_t  pixel_value       //< value to set for the pixels
+,           uint16_t  x0                //< x start position of character bitmap in framebuffer
+,           uint16_t  y0                //< y start position of character bitmap in framebuffer
+,            uint8_t  font_background   //< how to draw font background
+,            uint8_t *char_width        //< [out] width of character drawn in pixel
+){
+        Assert( font != NULL );
+        
+        uint8_t const *columns;
+        
+        *char_width = font_glyph( font, character, &columns );
+        
+        return font_glyph_draw( framebuffer, font, columns, *char_width, pixel_value, x0, y0, 
+                                font_background == FONT_BACKGROUND_OPAQUE );
+}
+
+/**
+ * \asserts ( font   != NULL )
+ * \asserts ( string != NULL )
+ */
+enum status_code font_draw_string (
+  struct Framebuffer *framebuffer       //< pointer to the framebuffer to draw the bitmap to
+, struct Font const  *font              //< font to draw with
+,         const char *string            //< string to draw
+,           uint32_t  pixel_value       //< value to set for the pixels
+,           uint16_t  x0                //< x start position of string bitmap in framebuffer
+,           uint16_t  y0                //< y start position of string bitmap in framebuffer
+,            uint8_t  font_background   //< how to draw font background
+,           uint16_t *string_width      //< [out] width of string drawn in pixel
+){
+        Assert( font   != NULL );
+        Assert( string != NULL );
+        
+        enum status_code  status  = STATUS_OK;
+                uint16_t  x_pos   = 0;
+           uint8_t const *columns;
+                 uint8_t  width;
+        
+        *string_width = 0;
+        
+        for( ; *string != 0x00; string++ ){
+                width  = font_glyph( font, *string, &columns );
+                status = font_glyph_draw( framebuffer, font, columns, width, pixel_value, x0 + x_pos, y0, 
+                                          font_background == FONT_BACKGROUND_OPAQUE );
+                if( status != STATUS_OK ){
+                        break;
+                }
+                x_pos += width + font->spacing;
+        }
+        if( x_pos > 0 ){
+                *string_width = x_pos - font->spacing;
+        }
+        
+        return status;
+}
+
+/**
+ * \asserts ( font != NULL )
+ */
+uint8_t font_measure_character (
+  struct Font const *font               //< font to measure with
+,              char  character          //< character to measure
+){
+        Assert( font != NULL );
+        
+        return font->widths[ font_glyph_idx( font, character ) ];
+}
+
+/**
+ * \asserts ( font   != NULL )
+ * \asserts ( string != NULL )
+ */
+uint16_t font_measure_string (
+  struct Font const *font               //< font to measure with
+,        const char *string             //< string to measure
+){
+        Assert( font   != NULL );
+        Assert( string != NULL );
+        
+        uint16_t width = 0;
+        
+        for( ; *string != 0x00; string++ ){
+                width += font->widths[ font_glyph_idx( font, *string ) ] + font->spacing;
+        }
+        if( width > 0 ){
+                width -= font->spacing;
+        }
+        
+        return width;
+}
+
+/**
+ * \asserts ( font != NULL )
+ * \asserts ( text != NULL )
+ */
+void font_measure_text (
+  struct Font const *font               //< font to measure with
+,        const char *text               //< text to measure, lines separated by '\n'
+,          uint16_t  width_max          //< width available for a line in pixel
+,           uint8_t  layout             //< layout flags, only FONT_LAYOUT_WRAP is used
+,          uint16_t *width              //< [out] width  of the widest line in pixel
+,          uint16_t *height             //< [out] height of all lines in pixel
+,          uint16_t *lines              //< [out] number of lines (optional, NULL: not needed)
+){
+        Assert( font != NULL );
+        Assert( text != NULL );
+        
+        uint16_t    line_count = 0;
+        uint16_t    line_width;
+        char const *next;
+        
+        *width = 0;
+        
+        for( char const *line = text; *line != 0x00; line = next ){
+                font_line_end( font, line, width_max, layout & FONT_LAYOUT_WRAP, &line_width, &next );
+                if( line_width > *width ){
+                        *width = line_width;
+                }
+                line_count++;
+        }
+        
+        *height = line_count > 0 ? ( line_count * ( font->height + font->spacing ) ) - font->spacing : 0;
+        if( lines != NULL ){
+                *lines = line_count;
+        }
+}
+
+/**
+ * \asserts ( font != NULL )
+ * \asserts ( text != NULL )
+ * \asserts ( box  != NULL )
+ */
+enum status_code font_draw_text (
+  struct Framebuffer     *framebuffer     //< pointer to the framebuffer to draw the text to
+, struct Font      const *font            //< font to draw with
+,              char const *text           //< text to draw, lines separated by '\n'
+,               uint32_t  pixel_value     //< value to set for the pixels
+, struct Font_Rect const *box             //< rectangle to lay the text out in
+, struct Font_Rect const *clip            //< pixels outside are not drawn (NULL: box)
+,                uint8_t  layout          //< layout flags, see \ref Font_Layout
+,                uint8_t  font_background //< how to draw font background
+){
+        Assert( font != NULL );
+        Assert( text != NULL );
+        Assert( box  != NULL );
+        
+        if( framebuffer == NULL ){
+                return STATUS_ERR_INVALID_ARG;
+        }
+        
+        enum status_code  status = STATUS_OK;
+                    bool  wrap   = layout & FONT_LAYOUT_WRAP;
+                    bool  opaque = font_background == FONT_BACKGROUND_OPAQUE;
+        struct Font_Clip  bounds;
+                uint16_t  text_width;
+                uint16_t  text_height;
+                 int32_t  y;
+        
+        // clip to the clip rectangle and the framebuffer
+        clip = clip != NULL ? clip : box;
+        bounds.x0 = clip->x  > 0 ? clip->x : 0;
+        bounds.y0 = clip->y  > 0 ? clip->y : 0;
+        bounds.x1 = (int32_t)clip->x + clip->width ;
+        bounds.y1 = (int32_t)clip->y + clip->height;
+        bounds.x1 = bounds.x1 < (int32_t)framebuffer->width  ? bounds.x1 : (int32_t)framebuffer->width ;
+        bounds.y1 = bounds.y1 < (int32_t)framebuffer->height ? bounds.y1 : (int32_t)framebuffer->height;
+        if(( bounds.x0 >= bounds.x1 )
+        || ( bounds.y0 >= bounds.y1 )
+        ){
+                return STATUS_OK;
+        }
+        
+        // vertical alignment needs the height of the laid out text
+        y = box->y;
+        if( layout & ( FONT_LAYOUT_MIDDLE | FONT_LAYOUT_BOTTOM ) ){
+                font_measure_text( font, text, box->width, layout, &text_width, &text_height, NULL );
+                y += layout & FONT_LAYOUT_BOTTOM ? (int32_t)box->height - text_height : ( (int32_t)box->height - text_height ) / 2;
+        }
+        
+        for( char const *line = text, *next; ( status == STATUS_OK ) && ( *line != 0x00 ); line = next, y += font->height + font->spacing ){
+                uint16_t    line_width;
+                char const *end = font_line_end( font, line, box->width, wrap, &line_width, &next );
+                int32_t     x   = box->x;
+                
+                if( y >= bounds.y1 ){
+                        break; // all following lines are below the clip rectangle
+                }
+                if( y + font->height <= bounds.y0 ){
+                        continue;
+                }
+                if( layout & FONT_LAYOUT_RIGHT ){
+                        x += (int32_t)box->width - line_width;
+                } else if( layout & FONT_LAYOUT_CENTER ){
+                        x += ( (int32_t)box->width - line_width ) / 2;
+                }
+                
+                for( ; ( status == STATUS_OK ) && ( line != end ) && ( x < bounds.x1 ); line++ ){
+                        uint8_t const *columns;
+                        uint8_t        width = font_glyph( font, *line, &columns );
+                        
+                        status = font_glyph_draw_clipped( framebuffer, font, columns, width, pixel_value, x, y, &bounds, opaque );
+                        x     += width + font->spacing;
+                }
+        }
+        
+        return status;
+}
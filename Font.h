@@ -32,9 +32,159 @@
 #ifndef FONT_H
 #define FONT_H
 
+#include <asf.h>
+#include "Framebuffer.h"
+
 enum Font_Background_Mode {
         FONT_BACKGROUND_TRANSPARENT = 0x00,
         FONT_BACKGROUND_OPAQUE      = 0x01
 };
 
-#endif
\ No newline at end of file
+/**
+ * \brief Layout flags of \ref font_draw_text(), one horizontal and one vertical alignment can be combined with FONT_LAYOUT_WRAP
+ */
+enum Font_Layout {
+        FONT_LAYOUT_LEFT            = 0x00, //< lines start at the left   edge of the box
+        FONT_LAYOUT_CENTER          = 0x01, //< lines are centered horizontally in the box
+        FONT_LAYOUT_RIGHT           = 0x02, //< lines end   at the right  edge of the box
+        FONT_LAYOUT_TOP             = 0x00, //< text starts at the top    edge of the box
+        FONT_LAYOUT_MIDDLE          = 0x04, //< text is centered vertically in the box
+        FONT_LAYOUT_BOTTOM          = 0x08, //< text ends   at the bottom edge of the box
+        FONT_LAYOUT_WRAP            = 0x10  //< lines wider than the box are broken between words
+};
+
+/**
+ * \brief Rectangle of a text layout, may lie partly outside the framebuffer
+ */
+struct Font_Rect {
+        int16_t  x     ; //< x position of the upper left corner
+        int16_t  y     ; //< y position of the upper left corner
+        uint16_t width ; //< width  in pixel
+        uint16_t height; //< height in pixel
+};
+
+/**
+        \brief Table driven description of a proportional bitmap font
+        
+        A font is data only, all fonts are drawn by \ref font_draw_character() and \ref font_draw_string().
+        
+        The glyphs of the code points [code_first, code_last] are stored one after the other in \ref bitmap. 
+        A glyph is stored column major in stripes of 8 pixel rows, one byte per column, the top most pixel of a stripe in bit 0. 
+        The stripes follow each other, so a glyph of width w and height h occupies w * ((h + 7) / 8) bytes.
+        The stripes have the layout of SSD1306 tiles, so a glyph drawn at a page aligned y is copied column byte by column byte.
+        
+ */
+struct Font {
+        uint8_t         height      ; //< height of the glyphs in pixel
+        uint8_t         spacing     ; //< pixel columns between two glyphs of a string
+        uint8_t         code_first  ; //< code point of the first glyph
+        uint8_t         code_last   ; //< code point of the last  glyph
+        uint8_t         code_default; //< code point drawn for characters not in [code_first, code_last]
+        uint8_t  const *widths      ; //< width of the glyphs in pixel, index = code point - code_first
+        uint16_t const *offsets     ; //< offset of the glyphs in bitmap, index = code point - code_first
+        uint8_t  const *bitmap      ; //< glyph stripes
+};
+
+/**
+ * \brief Draw the bitmap of a single character.
+ *
+ * Draw the bitmap of a single character of \ref font to the \ref framebuffer
+ * using \ref pixel_value starting with the upper left corner at [\ref x0,\ref y0].
+ *
+ * \return Status of operation.
+ * \retval STATUS_OK               If operation was successfully
+ * \retval STATUS_ERR_INVALID_ARG  If \ref framebuffer is not assigned
+ */
+enum status_code font_draw_character (
+  struct Framebuffer *framebuffer       //< pointer to the framebuffer to draw the bitmap to
+, struct Font const  *font              //< font to draw with
+,               char  character         //< character to draw
+,           uint32_t  pixel_value       //< value to set for the pixels
+,           uint16_t  x0                //< x start position of character bitmap in framebuffer
+,           uint16_t  y0                //< y start position of character bitmap in framebuffer
+,            uint8_t  font_background   //< how to draw font background
+,            uint8_t *char_width        //< [out] width of character drawn in pixel
+);
+
+/**
+ * \brief Draw the bitmap of a string of characters.
+ *
+ * Draw the bitmap of a string of characters of \ref font to the \ref framebuffer
+ * using \ref pixel_value starting with the upper left corner at [\ref x0,\ref y0].
+ *
+ * \return Status of operation.
+ * \retval STATUS_OK               If operation was successfully
+ * \retval STATUS_ERR_INVALID_ARG  If \ref framebuffer is not assigned
+ */
+enum status_code font_draw_string (
+  struct Framebuffer *framebuffer       //< pointer to the framebuffer to draw the bitmap to
+, struct Font const  *font              //< font to draw with
+,         const char *string            //< string to draw
+,           uint32_t  pixel_value       //< value to set for the pixels
+,           uint16_t  x0                //< x start position of string bitmap in framebuffer
+,           uint16_t  y0                //< y start position of string bitmap in framebuffer
+,            uint8_t  font_background   //< how to draw font background
+,           uint16_t *string_width      //< [out] width of string drawn in pixel
+);
+
+/**
+ * \brief Get the width of a single character without drawing it.
+ *
+ * \return Width of the character in pixel.
+ */
+uint8_t font_measure_character (
+  struct Font const *font               //< font to measure with
+,              char  character          //< character to measure
+);
+
+/**
+ * \brief Get the width of a string of characters without drawing it.
+ *
+ * The width is the one \ref font_draw_string() reports. It is calculated from the font's width table only.
+ *
+ * \return Width of the string in pixel.
+ */
+uint16_t font_measure_string (
+  struct Font const *font               //< font to measure with
+,        const char *string             //< string to measure
+);
+
+/**
+ * \brief Get the size of a text laid out by \ref font_draw_text() without drawing it.
+ *
+ * Lines are separated by '\n' and, if \ref layout has FONT_LAYOUT_WRAP set, broken between words to fit into 
+ * \ref width_max. Two lines are \ref font->spacing pixel rows apart.
+ */
+void font_measure_text (
+  struct Font const *font               //< font to measure with
+,        const char *text               //< text to measure, lines separated by '\n'
+,          uint16_t  width_max          //< width available for a line in pixel
+,           uint8_t  layout             //< layout flags, only FONT_LAYOUT_WRAP is used
+,          uint16_t *width              //< [out] width  of the widest line in pixel
+,          uint16_t *height             //< [out] height of all lines in pixel
+,          uint16_t *lines              //< [out] number of lines (optional, NULL: not needed)
+);
+
+/**
+ * \brief Draw a text laid out in a box.
+ *
+ * The lines of \ref text are aligned in \ref box as requested by \ref layout, see \ref font_measure_text() for how lines are formed.
+ * Only pixels inside \ref clip and the framebuffer are drawn. Glyphs completely outside are skipped without 
+ * calling the framebuffer.
+ *
+ * \return Status of operation.
+ * \retval STATUS_OK               If operation was successfully
+ * \retval STATUS_ERR_INVALID_ARG  If \ref framebuffer is not assigned
+ */
+enum status_code font_draw_text (
+  struct Framebuffer     *framebuffer     //< pointer to the framebuffer to draw the text to
+, struct Font      const *font            //< font to draw with
+,              char const *text           //< text to draw, lines separated by '\n'
+,               uint32_t  pixel_value     //< value to set for the pixels
+, struct Font_Rect const *box             //< rectangle to lay the text out in
+, struct Font_Rect const *clip            //< pixels outside are not drawn (NULL: box)
+,                uint8_t  layout          //< layout flags, see \ref Font_Layout
+,                uint8_t  font_background //< how to draw font background
+);
+
+#endif // FONT_H
\ No newline at end of file
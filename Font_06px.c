@@ -33,168 +33,139 @@
 #include "Font.h"
 #include "Font_06px.h"
 
-#define FONT_06PX_CHAR_IDX_MAX          47
-#define FONT_06PX_CHAR_WIDTH_BYTE_IDX    6
-#define FONT_06PX_HEIGHT                 6
-
 /**
- * Character index = (ASCII-Code - 0x20) >> 1
- * Character left  = !(ASCII-Code - 0x20) % 2
+ * Glyph width in pixel, index = (ASCII-Code - 0x20)
  */
-const uint8_t font_06px[FONT_06PX_CHAR_IDX_MAX + 1][FONT_06PX_HEIGHT + 1] = {
-        {0x01, 0x01, 0x01, 0x00, 0x01, 0x00, 0x21},     // <SPACE> !
-        {0xAA, 0xBF, 0x0A, 0x1F, 0x0A, 0x00, 0x35},     // ' #
-        {0x74, 0xA1, 0x72, 0x2C, 0xF1, 0x20, 0x53},     // $ % 
-        {0x11, 0x29, 0x12, 0x2C, 0x28, 0x14, 0x42},     // & 
-        {0x06, 0x09, 0x09, 0x09, 0x06, 0x00, 0x22},     // ( )
-        {0x48, 0x32, 0x7F, 0x32, 0x48, 0x00, 0x43},     // * +
-        {0x00, 0x00, 0x07, 0x08, 0x08, 0x10, 0x23},     // , -
-        {0x00, 0x01, 0x02, 0x04, 0x18, 0x00, 0x14},     // . /
-        {0x1D, 0x17, 0x15, 0x15, 0x1D, 0x00, 0x32},     // 0 1
-        {0x3F, 0x09, 0x3B, 0x21, 0x3F, 0x00, 0x33},     // 2 3
-        {0x27, 0x2C, 0x3F, 0x09, 0x0F, 0x00, 0x33},     // 4 5
-        {0x27, 0x21, 0x39, 0x29, 0x39, 0x00, 0x33},     // 6 7
-        {0x3F, 0x2D, 0x3F, 0x29, 0x39, 0x00, 0x33},     // 8 9
-        {0x00, 0x05, 0x00, 0x05, 0x02, 0x00, 0x12},     // : ;
-        {0x08, 0x17, 0x20, 0x17, 0x08, 0x00, 0x33},     // < =
-        {0x12, 0x09, 0x06, 0x08, 0x12, 0x00, 0x32},     // > ?
-        {0x66, 0x99, 0xBF, 0x89, 0x69, 0x00, 0x44},     // @ A
-        {0xE7, 0x98, 0xE8, 0x98, 0xE7, 0x00, 0x44},     // B C
-        {0x77, 0x4C, 0x4E, 0x4C, 0x77, 0x00, 0x43},     // D E
-        {0x76, 0x48, 0x6B, 0x49, 0x46, 0x00, 0x34},     // F G
-        {0x4F, 0x4A, 0x7A, 0x4A, 0x4F, 0x00, 0x43},     // H I
-        {0xF9, 0x1A, 0x1C, 0x9A, 0x69, 0x00, 0x44},     // J K
-        {0x9B, 0x95, 0x95, 0x91, 0xF1, 0x00, 0x35},     // L M
-        {0x96, 0xD9, 0xB9, 0x99, 0x96, 0x00, 0x44},     // N O
-        {0xE6, 0x99, 0xE9, 0x89, 0x86, 0x01, 0x44},     // P Q
-        {0xE6, 0x98, 0xE6, 0x91, 0x96, 0x00, 0x44},     // R S
-        {0x79, 0x29, 0x29, 0x29, 0x26, 0x00, 0x34},     // T U
-        {0xB1, 0xB1, 0xB5, 0xB5, 0x4A, 0x00, 0x35},     // V W
-        {0x2D, 0x2D, 0x12, 0x2A, 0x2A, 0x00, 0x33},     // X Y
-        {0x1F, 0x06, 0x0A, 0x12, 0x1F, 0x00, 0x32},     // Z [
-        {0x03, 0x21, 0x11, 0x09, 0x07, 0x00, 0x42},     // \ ]
-        {0x10, 0x28, 0x00, 0x00, 0x00, 0x07, 0x33},     // ^ _
-        {0x20, 0x27, 0x19, 0x09, 0x07, 0x00, 0x24},     //  a
-        {0x40, 0x73, 0x4C, 0x4C, 0x73, 0x00, 0x43},     // b c
-        {0x08, 0x3B, 0x4F, 0x4C, 0x3B, 0x00, 0x43},     // d e
-        {0x30, 0x27, 0x79, 0x27, 0x21, 0x0E, 0x34},     // f g
-        {0x42, 0x70, 0x4E, 0x4A, 0x4F, 0x00, 0x43},     // h i
-        {0x28, 0x09, 0x7E, 0x19, 0x19, 0x60, 0x34},     // j k
-        {0xC0, 0x5E, 0x55, 0x55, 0x75, 0x00, 0x35},     // l m
-        {0x00, 0xE6, 0x99, 0x99, 0x96, 0x00, 0x44},     // n o
-        {0x00, 0xE7, 0x99, 0xE7, 0x81, 0x81, 0x44},     // p q
-        {0x00, 0x0F, 0x12, 0x11, 0x13, 0x00, 0x32},     // r s
-        {0x20, 0x79, 0x29, 0x29, 0x37, 0x00, 0x34},     // t u
-        {0x00, 0xB1, 0xB5, 0xB5, 0x4A, 0x00, 0x35},     // v w
-        {0x00, 0x99, 0x69, 0x67, 0x91, 0x0E, 0x44},     // x y
-        {0x03, 0x72, 0x14, 0x22, 0x3B, 0x00, 0x43},     // z {
-        {0x0E, 0x0A, 0x01, 0x0A, 0x0E, 0x00, 0x13},     // | }
-        {0x2A, 0x55, 0x02, 0x00, 0x00, 0x00, 0x43}      // ~ 
+static uint8_t const font_06px_widths[96] = {
+        2, 1, 3, 5, 5, 3, 4, 2, 2, 2, 4, 3, 2, 3, 1, 4,
+        3, 2, 3, 3, 3, 3, 3, 3, 3, 3, 1, 2, 3, 3, 3, 2,
+        4, 4, 4, 4, 4, 3, 3, 4, 4, 3, 4, 4, 3, 5, 4, 4,
+        4, 4, 4, 4, 3, 4, 3, 5, 3, 3, 3, 2, 4, 2, 3, 3,
+        2, 4, 4, 3, 4, 3, 3, 4, 4, 3, 3, 4, 3, 5, 4, 4,
+        4, 4, 3, 2, 3, 4, 3, 5, 4, 4, 4, 3, 1, 3, 4, 3
 };
 
 /**
- * \asserts ( framebuffer != NULL )
- * \asserts ( framebuffer->set_pixel != NULL )
+ * Offset of the first column of a glyph in \ref font_06px_bitmap, index = (ASCII-Code - 0x20)
  */
-enum status_code  font_06px_draw_character (
-  struct Framebuffer *framebuffer       //< pointer to the framebuffer to draw the bitmap to
-,               char  character         //< character to draw
-,           uint32_t  pixel_value       //< value to set for the pixels
-,           uint16_t  x0                //< x start position of character bitmap in framebuffer
-,           uint16_t  y0                //< y start position of character bitmap in framebuffer
-,            uint8_t  font_background   //< how to draw font background
-,            uint8_t *char_width        //< [out] width of character drawn in pixel
-){
-        Assert( framebuffer != NULL );
-        Assert( framebuffer->set_pixel != NULL );
-        
-        Framebuffer_Set_Pixel *set_pixel = framebuffer->set_pixel;
-
-        int_fast16_t  char_idx;         // index of the shared character byte in the font
-        uint_fast8_t  char_offset;      // offset of char in the shared character byte
-        uint_fast8_t  char_left_width;  // width of the left char in the shared character byte
-        uint_fast8_t  char_right_width; // width of the right char in the shared character byte
-                bool  is_char_left;     // true if we want to use the left char in the shared character byte
-                bool  is_set_pixel;     // true if we want to set pixel_value for that pixel
-        int_fast16_t  residue;          // residue of the char index calculation 
-        uint_fast8_t  scanline;         // a single x line of bits 
-        uint_fast8_t  x, y;             // current x and y pixel position to draw
-        
-        // find out which entry of the font array to use
-        char_idx = (character - 0x20) >> 1;
-        if( ( char_idx >= 0 ) && ( char_idx <= FONT_06PX_CHAR_IDX_MAX ) ) {
-                residue      = (character - 0x20) % 2;
-                is_char_left = residue > 0 ? false : true; // if there is no residue, its a left char
-        } else {
-                // print <SPACE> for unknown characters
-                char_idx         = 1;
-                is_char_left = true;
-        }
-                
-        char_left_width  = ( font_06px[char_idx][FONT_06PX_CHAR_WIDTH_BYTE_IDX] >> 4 ) & 0xF;
-        char_right_width = ( font_06px[char_idx][FONT_06PX_CHAR_WIDTH_BYTE_IDX]      ) & 0xF;
-        char_offset      = is_char_left ? char_right_width : 0x00;
-       *char_width       = is_char_left ? char_left_width : char_right_width;        
-
-        // for convenience of calculation we paint forward in y-direction and backwards in x-direction
-        // - y is the scanline index for the character bitmap (we got from top to bottom)
-        // - for the pixel information we use the scanline byte like a shift register and evaluate the 2^0 bit
-        y = 0;        // y to start with
-        do {
-                x = *char_width;        // x to start with
-                scanline = font_06px[char_idx][y] >> char_offset; // push out the right char, if the left one is wanted
-                while( x > 0 ){
-                        is_set_pixel = scanline & 0x01; // evaluate the bit at 2^0
-                        if( is_set_pixel ){
-                                set_pixel( framebuffer, x0+x-1, y0+y, pixel_value );       // always draw pixel if to set
-                        } else {
-                                if( font_background == FONT_BACKGROUND_OPAQUE ){
-                                        set_pixel( framebuffer, x0+x-1, y0+y, 0x00 );      // only clear background pixel, if mode is opaque
-                                }
-                        }
-                        scanline = scanline >> 1;
-                        x--;
-                }
-                y++;
-        } while ( y < FONT_06PX_HEIGHT );
-                
-        return STATUS_OK;
-}
+static uint16_t const font_06px_offsets[96] = {
+           0,    2,    3,    6,   11,   16,   19,   23,   25,   27,   29,   33,   36,   38,   41,   42,
+          46,   49,   51,   54,   57,   60,   63,   66,   69,   72,   75,   76,   78,   81,   84,   87,
+          89,   93,   97,  101,  105,  109,  112,  115,  119,  123,  126,  130,  134,  137,  142,  146,
+         150,  154,  158,  162,  166,  169,  173,  176,  181,  184,  187,  190,  192,  196,  198,  201,
+         204,  206,  210,  214,  217,  221,  224,  227,  231,  235,  238,  241,  245,  248,  253,  257,
+         261,  265,  269,  272,  274,  277,  281,  284,  289,  293,  297,  301,  304,  305,  308,  312
+};
 
 /**
- * \asserts ( framebuffer != NULL )
- * \asserts ( string      != NULL )
+ * Glyph columns, one byte per column, top most pixel in bit 0
  */
-enum status_code font_06px_draw_string (
-  struct Framebuffer *framebuffer       //< pointer to the framebuffer to draw the bitmap to
-,         const char *string            //< string to draw
-,           uint32_t  pixel_value       //< value to set for the pixels
-,           uint16_t  x0                //< x start position of character bitmap in framebuffer
-,           uint16_t  y0                //< y start position of character bitmap in framebuffer
-,            uint8_t  font_background   //< how to draw font background
-,            uint8_t *string_width      //< [out] width of character drawn in pixel
-){
-        Assert( framebuffer != NULL );
-        Assert( string      != NULL );
-
-        *string_width = 0;
-        
-        uint_fast8_t  x_pos      = 0;
-             uint8_t  char_width = 0;
-                char  curr;
-        
-        for( uint_fast8_t idx = 0; idx < 256; idx++ ) {
-                curr = string[idx];
-                if( curr == 0x00 ){
-                        break;
-                }
-                font_06px_draw_character( framebuffer, string[idx], pixel_value, x0+x_pos, y0, FONT_BACKGROUND_OPAQUE, &char_width); 
-                x_pos += char_width + 1;
-                *string_width += char_width + 1;
-        }
-        if( *string_width > 0 ){
-                (*string_width)--;
-        }
+static uint8_t const font_06px_bitmap[315] = {
+        0x00, 0x00,                                     // Char 032 ( )
+        0x17,                                           // Char 033 (!)
+        0x03, 0x00, 0x03,                               // Char 034 (")
+        0x0A, 0x1F, 0x0A, 0x1F, 0x0A,                   // Char 035 (#)
+        0x12, 0x15, 0x3F, 0x15, 0x08,                   // Char 036 ($)
+        0x09, 0x04, 0x12,                               // Char 037 (%)
+        0x1A, 0x25, 0x1A, 0x28,                         // Char 038 (&)
+        0x04, 0x03,                                     // Char 039 (')
+        0x0E, 0x11,                                     // Char 040 (()
+        0x11, 0x0E,                                     // Char 041 ())
+        0x15, 0x0E, 0x0E, 0x15,                         // Char 042 (*)
+        0x04, 0x0E, 0x04,                               // Char 043 (+)
+        0x20, 0x18,                                     // Char 044 (,)
+        0x04, 0x04, 0x04,                               // Char 045 (-)
+        0x10,                                           // Char 046 (.)
+        0x10, 0x08, 0x04, 0x02,                         // Char 047 (/)
+        0x1F, 0x11, 0x1F,                               // Char 048 (0)
+        0x02, 0x1F,                                     // Char 049 (1)
+        0x1D, 0x15, 0x17,                               // Char 050 (2)
+        0x11, 0x15, 0x1F,                               // Char 051 (3)
+        0x07, 0x04, 0x1E,                               // Char 052 (4)
+        0x17, 0x15, 0x1D,                               // Char 053 (5)
+        0x1F, 0x14, 0x1C,                               // Char 054 (6)
+        0x01, 0x01, 0x1F,                               // Char 055 (7)
+        0x1F, 0x15, 0x1F,                               // Char 056 (8)
+        0x07, 0x05, 0x1F,                               // Char 057 (9)
+        0x0A,                                           // Char 058 (:)
+        0x10, 0x0A,                                     // Char 059 (;)
+        0x04, 0x0A, 0x11,                               // Char 060 (<)
+        0x0A, 0x0A, 0x0A,                               // Char 061 (=)
+        0x11, 0x0A, 0x04,                               // Char 062 (>)
+        0x15, 0x02,                                     // Char 063 (?)
+        0x0E, 0x11, 0x15, 0x06,                         // Char 064 (@)
+        0x1E, 0x05, 0x05, 0x1E,                         // Char 065 (A)
+        0x1F, 0x15, 0x15, 0x0A,                         // Char 066 (B)
+        0x0E, 0x11, 0x11, 0x11,                         // Char 067 (C)
+        0x1F, 0x11, 0x11, 0x0E,                         // Char 068 (D)
+        0x1F, 0x15, 0x11,                               // Char 069 (E)
+        0x1F, 0x05, 0x01,                               // Char 070 (F)
+        0x0E, 0x11, 0x15, 0x0C,                         // Char 071 (G)
+        0x1F, 0x04, 0x04, 0x1F,                         // Char 072 (H)
+        0x11, 0x1F, 0x11,                               // Char 073 (I)
+        0x09, 0x11, 0x11, 0x0F,                         // Char 074 (J)
+        0x1F, 0x04, 0x0A, 0x11,                         // Char 075 (K)
+        0x1F, 0x10, 0x10,                               // Char 076 (L)
+        0x1F, 0x01, 0x06, 0x01, 0x1F,                   // Char 077 (M)
+        0x1F, 0x02, 0x04, 0x1F,                         // Char 078 (N)
+        0x0E, 0x11, 0x11, 0x0E,                         // Char 079 (O)
+        0x1F, 0x05, 0x05, 0x02,                         // Char 080 (P)
+        0x0E, 0x11, 0x11, 0x2E,                         // Char 081 (Q)
+        0x1F, 0x05, 0x05, 0x1A,                         // Char 082 (R)
+        0x02, 0x15, 0x15, 0x08,                         // Char 083 (S)
+        0x01, 0x1F, 0x01,                               // Char 084 (T)
+        0x0F, 0x10, 0x10, 0x0F,                         // Char 085 (U)
+        0x0F, 0x10, 0x0F,                               // Char 086 (V)
+        0x0F, 0x10, 0x0C, 0x10, 0x0F,                   // Char 087 (W)
+        0x1B, 0x04, 0x1B,                               // Char 088 (X)
+        0x03, 0x1C, 0x03,                               // Char 089 (Y)
+        0x19, 0x15, 0x13,                               // Char 090 (Z)
+        0x1F, 0x11,                                     // Char 091 ([)
+        0x02, 0x04, 0x08, 0x10,                         // Char 092 (\)
+        0x11, 0x1F,                                     // Char 093 (])
+        0x02, 0x01, 0x02,                               // Char 094 (^)
+        0x20, 0x20, 0x20,                               // Char 095 (_)
+        0x03, 0x04,                                     // Char 096 (`)
+        0x0C, 0x12, 0x12, 0x1E,                         // Char 097 (a)
+        0x1F, 0x12, 0x12, 0x0C,                         // Char 098 (b)
+        0x0C, 0x12, 0x12,                               // Char 099 (c)
+        0x0C, 0x12, 0x12, 0x1F,                         // Char 100 (d)
+        0x0C, 0x16, 0x16,                               // Char 101 (e)
+        0x04, 0x1F, 0x05,                               // Char 102 (f)
+        0x24, 0x2A, 0x2A, 0x1E,                         // Char 103 (g)
+        0x1F, 0x02, 0x02, 0x1C,                         // Char 104 (h)
+        0x14, 0x1D, 0x10,                               // Char 105 (i)
+        0x24, 0x25, 0x1C,                               // Char 106 (j)
+        0x1F, 0x04, 0x04, 0x1A,                         // Char 107 (k)
+        0x01, 0x1F, 0x10,                               // Char 108 (l)
+        0x1E, 0x02, 0x1E, 0x02, 0x1C,                   // Char 109 (m)
+        0x1E, 0x02, 0x02, 0x1C,                         // Char 110 (n)
+        0x0C, 0x12, 0x12, 0x0C,                         // Char 111 (o)
+        0x3E, 0x0A, 0x0A, 0x04,                         // Char 112 (p)
+        0x04, 0x0A, 0x0A, 0x3E,                         // Char 113 (q)
+        0x1C, 0x02, 0x02,                               // Char 114 (r)
+        0x16, 0x1A,                                     // Char 115 (s)
+        0x02, 0x1F, 0x12,                               // Char 116 (t)
+        0x0E, 0x10, 0x10, 0x1E,                         // Char 117 (u)
+        0x0E, 0x10, 0x0E,                               // Char 118 (v)
+        0x0E, 0x10, 0x0C, 0x10, 0x0E,                   // Char 119 (w)
+        0x12, 0x0C, 0x0C, 0x12,                         // Char 120 (x)
+        0x26, 0x28, 0x28, 0x1E,                         // Char 121 (y)
+        0x02, 0x1A, 0x16, 0x10,                         // Char 122 (z)
+        0x04, 0x1B, 0x11,                               // Char 123 ({)
+        0x1B,                                           // Char 124 (|)
+        0x11, 0x1B, 0x04,                               // Char 125 (})
+        0x02, 0x01, 0x02, 0x01,                         // Char 126 (~)
+        0x02, 0x05, 0x02                                // Char 127 (.)
+};
 
-        return STATUS_OK;
-}
+struct Font const font_06px = {
+        .height       = 6,
+        .spacing      = 1,
+        .code_first   = 0x20,
+        .code_last    = 0x7F,
+        .code_default = 0x20,
+        .widths       = font_06px_widths,
+        .offsets      = font_06px_offsets,
+        .bitmap       = font_06px_bitmap
+};
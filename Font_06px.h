@@ -33,47 +33,12 @@
 #define FONT_06PX_H
 
 #include <asf.h>
-#include "Framebuffer.h"
+#include "Font.h"
 
 /**
- * \brief Draw the bitmap of a single character.
- *
- * Draw the bitmap of a single character to the \ref framebuffer
- * using \ref pixel_value starting with the upper left corner at [\ref x0,\ref y0].
- *
- * \return Status of operation.
- * \retval STATUS_OK               If operation was successfully
- * \retval STATUS_ERR_INVALID_ARG  If \ref framebuffer_draw_pixel or \ref framebuffer is not assigned
+ * \brief The tiny 6 pixel height, proportional font, draw it with \ref font_draw_string().
  */
-enum status_code font_06px_draw_character (
-  struct Framebuffer *framebuffer         //< pointer to the framebuffer to draw the bitmap to
-,               char  character           //< character to draw
-,           uint32_t  pixel_value         //< value to set for the pixels
-,           uint16_t  x0                  //< x start position of character bitmap in framebuffer
-,           uint16_t  y0                  //< y start position of character bitmap in framebuffer
-,            uint8_t  font_background     //< how to draw font background
-,            uint8_t *char_width          //< [out] width of character drawn in pixel
-);
-
-/**
- * \brief Draw the bitmap of a string of characters.
- *
- * Draw the bitmap of a string of characters to the \ref framebuffer
- * using \ref pixel_value starting with the upper left corner at [\ref x0,\ref y0].
- *
- * \return Status of operation.
- * \retval STATUS_OK               If operation was successfully
- * \retval STATUS_ERR_INVALID_ARG  If \ref framebuffer_draw_pixel, \ref framebuffer or \ref string is not assigned
- */
-enum status_code font_06px_draw_string (
-  struct Framebuffer *framebuffer       //< pointer to the framebuffer to draw the bitmap to
-,         const char *string            //< string to draw
-,           uint32_t  pixel_value       //< value to set for the pixels
-,           uint16_t  x0                //< x start position of character bitmap in framebuffer
-,           uint16_t  y0                //< y start position of character bitmap in framebuffer
-,            uint8_t  font_background   //< how to draw font background
-,            uint8_t *string_width      //< [out] width of character drawn in pixel
-);
+extern struct Font const font_06px;
 
 #endif // FONT_06PX_H
 
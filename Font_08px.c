@@ -33,202 +33,139 @@
 #include "Font.h"
 #include "Font_08px.h"
 
-#define FONT_08PX_CHAR_IDX_MAX          95
-#define FONT_08PX_CHAR_WIDTH_BYTE_IDX    8
-#define FONT_08PX_HEIGHT                 8
-
 /**
- * Character index = (ASCII-Code - 0x20)
+ * Glyph width in pixel, index = (ASCII-Code - 0x20)
  */
-const uint8_t font_08px[FONT_08PX_CHAR_IDX_MAX + 1][FONT_08PX_HEIGHT + 1] = {
-        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01},        // Char 032 ( )
-        {0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x00, 0xC0, 0x00, 0x02},        // Char 033 (!)
-        {0xD8, 0xD8, 0xD8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05},        // Char 034 (")
-        {0x6C, 0x6C, 0xFE, 0x6C, 0xFE, 0x6C, 0x6C, 0x00, 0x07},        // Char 035 (#)
-        {0x18, 0x7E, 0xC0, 0x7C, 0x06, 0xFC, 0x18, 0x00, 0x07},        // Char 036 ($)
-        {0x00, 0xC6, 0xCC, 0x18, 0x30, 0x66, 0xC6, 0x00, 0x07},        // Char 037 (%)
-        {0x38, 0x6C, 0x38, 0x76, 0xDC, 0xCC, 0x76, 0x00, 0x07},        // Char 038 (&)
-        {0x60, 0x60, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03},        // Char 039 (')
-        {0x30, 0x60, 0xC0, 0xC0, 0xC0, 0x60, 0x30, 0x00, 0x04},        // Char 040 (()
-        {0xC0, 0x60, 0x30, 0x30, 0x30, 0x60, 0xC0, 0x00, 0x04},        // Char 041 ())
-        {0x00, 0x66, 0x3C, 0xFF, 0x3C, 0x66, 0x00, 0x00, 0x08},        // Char 042 (*)
-        {0x00, 0x30, 0x30, 0xFC, 0x30, 0x30, 0x00, 0x00, 0x06},        // Char 043 (+)
-        {0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x60, 0xC0, 0x03},        // Char 044 (,)
-        {0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x06},        // Char 045 (-)
-        {0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0x00, 0x02},        // Char 046 (.)
-        {0x06, 0x0C, 0x18, 0x30, 0x60, 0xC0, 0x80, 0x00, 0x07},        // Char 047 (/)
-        {0x7C, 0xCE, 0xDE, 0xF6, 0xE6, 0xC6, 0x7C, 0x00, 0x07},        // Char 048 (0)
-        {0x30, 0x70, 0x30, 0x30, 0x30, 0x30, 0xFC, 0x00, 0x06},        // Char 049 (1)
-        {0x7C, 0xC6, 0x06, 0x7C, 0xC0, 0xC0, 0xFE, 0x00, 0x07},        // Char 050 (2)
-        {0xFC, 0x06, 0x06, 0x3C, 0x06, 0x06, 0xFC, 0x00, 0x07},        // Char 051 (3)
-        {0x0C, 0xCC, 0xCC, 0xCC, 0xFE, 0x0C, 0x0C, 0x00, 0x07},        // Char 052 (4)
-        {0xFE, 0xC0, 0xFC, 0x06, 0x06, 0xC6, 0x7C, 0x00, 0x07},        // Char 053 (5)
-        {0x7C, 0xC0, 0xC0, 0xFC, 0xC6, 0xC6, 0x7C, 0x00, 0x07},        // Char 054 (6)
-        {0xFE, 0x06, 0x06, 0x0C, 0x18, 0x30, 0x30, 0x00, 0x07},        // Char 055 (7)
-        {0x7C, 0xC6, 0xC6, 0x7C, 0xC6, 0xC6, 0x7C, 0x00, 0x07},        // Char 056 (8)
-        {0x7C, 0xC6, 0xC6, 0x7E, 0x06, 0x06, 0x7C, 0x00, 0x07},        // Char 057 (9)
-        {0x00, 0xC0, 0xC0, 0x00, 0x00, 0xC0, 0xC0, 0x00, 0x02},        // Char 058 (:)
-        {0x00, 0x60, 0x60, 0x00, 0x00, 0x60, 0x60, 0xC0, 0x03},        // Char 059 (;)
-        {0x18, 0x30, 0x60, 0xC0, 0x60, 0x30, 0x18, 0x00, 0x05},        // Char 060 (<)
-        {0x00, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x06},        // Char 061 (=)
-        {0xC0, 0x60, 0x30, 0x18, 0x30, 0x60, 0xC0, 0x00, 0x05},        // Char 062 (>)
-        {0x78, 0xCC, 0x18, 0x30, 0x30, 0x00, 0x30, 0x00, 0x06},        // Char 063 (?)
-        {0x7C, 0xC6, 0xDE, 0xDE, 0xDE, 0xC0, 0x7E, 0x00, 0x07},        // Char 064 (@)
-        {0x38, 0x6C, 0xC6, 0xC6, 0xFE, 0xC6, 0xC6, 0x00, 0x07},        // Char 065 (A)
-        {0xFC, 0xC6, 0xC6, 0xFC, 0xC6, 0xC6, 0xFC, 0x00, 0x07},        // Char 066 (B)
-        {0x7C, 0xC6, 0xC0, 0xC0, 0xC0, 0xC6, 0x7C, 0x00, 0x07},        // Char 067 (C)
-        {0xF8, 0xCC, 0xC6, 0xC6, 0xC6, 0xCC, 0xF8, 0x00, 0x07},        // Char 068 (D)
-        {0xFE, 0xC0, 0xC0, 0xF8, 0xC0, 0xC0, 0xFE, 0x00, 0x07},        // Char 069 (E)
-        {0xFE, 0xC0, 0xC0, 0xF8, 0xC0, 0xC0, 0xC0, 0x00, 0x07},        // Char 070 (F)
-        {0x7C, 0xC6, 0xC0, 0xC0, 0xCE, 0xC6, 0x7C, 0x00, 0x07},        // Char 071 (G)
-        {0xC6, 0xC6, 0xC6, 0xFE, 0xC6, 0xC6, 0xC6, 0x00, 0x07},        // Char 072 (H)
-        {0xFC, 0x30, 0x30, 0x30, 0x30, 0x30, 0xFC, 0x00, 0x06},        // Char 073 (I)
-        {0x06, 0x06, 0x06, 0x06, 0x06, 0xC6, 0x7C, 0x00, 0x07},        // Char 074 (J)
-        {0xC6, 0xCC, 0xD8, 0xF0, 0xD8, 0xCC, 0xC6, 0x00, 0x07},        // Char 075 (K)
-        {0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFE, 0x00, 0x07},        // Char 076 (L)
-        {0xC6, 0xEE, 0xFE, 0xFE, 0xD6, 0xC6, 0xC6, 0x00, 0x07},        // Char 077 (M)
-        {0xC6, 0xE6, 0xF6, 0xDE, 0xCE, 0xC6, 0xC6, 0x00, 0x07},        // Char 078 (N)
-        {0x7C, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0x7C, 0x00, 0x07},        // Char 079 (O)
-        {0xFC, 0xC6, 0xC6, 0xFC, 0xC0, 0xC0, 0xC0, 0x00, 0x07},        // Char 080 (P)
-        {0x7C, 0xC6, 0xC6, 0xC6, 0xD6, 0xDE, 0x7C, 0x06, 0x07},        // Char 081 (Q)
-        {0xFC, 0xC6, 0xC6, 0xFC, 0xD8, 0xCC, 0xC6, 0x00, 0x07},        // Char 082 (R)
-        {0x7C, 0xC6, 0xC0, 0x7C, 0x06, 0xC6, 0x7C, 0x00, 0x07},        // Char 083 (S)
-        {0xFF, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x08},        // Char 084 (T)
-        {0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xFE, 0x00, 0x07},        // Char 085 (U)
-        {0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0x7C, 0x38, 0x00, 0x07},        // Char 086 (V)
-        {0xC6, 0xC6, 0xC6, 0xC6, 0xD6, 0xFE, 0x6C, 0x00, 0x07},        // Char 087 (W)
-        {0xC6, 0xC6, 0x6C, 0x38, 0x6C, 0xC6, 0xC6, 0x00, 0x07},        // Char 088 (X)
-        {0xC6, 0xC6, 0xC6, 0x7C, 0x18, 0x30, 0xE0, 0x00, 0x07},        // Char 089 (Y)
-        {0xFE, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xFE, 0x00, 0x07},        // Char 090 (Z)
-        {0xF0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xF0, 0x00, 0x04},        // Char 091 ([)
-        {0xC0, 0x60, 0x30, 0x18, 0x0C, 0x06, 0x02, 0x00, 0x07},        // Char 092 (\)
-        {0xF0, 0x30, 0x30, 0x30, 0x30, 0x30, 0xF0, 0x00, 0x04},        // Char 093 (])
-        {0x10, 0x38, 0x6C, 0xC6, 0x00, 0x00, 0x00, 0x00, 0x07},        // Char 094 (^)
-        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x08},        // Char 095 (_)
-        {0xC0, 0xC0, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03},        // Char 096 (`)
-        {0x00, 0x00, 0x7C, 0x06, 0x7E, 0xC6, 0x7E, 0x00, 0x07},        // Char 097 (a)
-        {0xC0, 0xC0, 0xFC, 0xC6, 0xC6, 0xC6, 0xFC, 0x00, 0x07},        // Char 098 (b)
-        {0x00, 0x00, 0x7C, 0xC6, 0xC0, 0xC6, 0x7C, 0x00, 0x07},        // Char 099 (c)
-        {0x06, 0x06, 0x7E, 0xC6, 0xC6, 0xC6, 0x7E, 0x00, 0x07},        // Char 100 (d)
-        {0x00, 0x00, 0x7C, 0xC6, 0xFE, 0xC0, 0x7C, 0x00, 0x07},        // Char 101 (e)
-        {0x38, 0x6C, 0x60, 0xF0, 0x60, 0x60, 0xF0, 0x00, 0x06},        // Char 102 (f)
-        {0x00, 0x00, 0x7E, 0xC6, 0xC6, 0x7E, 0x06, 0xFC, 0x07},        // Char 103 (g)
-        {0xC0, 0xC0, 0xFC, 0xC6, 0xC6, 0xC6, 0xC6, 0x00, 0x07},        // Char 104 (h)
-        {0x60, 0x00, 0xE0, 0x60, 0x60, 0x60, 0xF0, 0x00, 0x04},        // Char 105 (i)
-        {0x06, 0x00, 0x06, 0x06, 0x06, 0x06, 0xC6, 0x7C, 0x07},        // Char 106 (j)
-        {0xC0, 0xC0, 0xCC, 0xD8, 0xF8, 0xCC, 0xC6, 0x00, 0x07},        // Char 107 (k)
-        {0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x60, 0x00, 0x03},        // Char 108 (l)
-        {0x00, 0x00, 0xCC, 0xFE, 0xFE, 0xD6, 0xD6, 0x00, 0x07},        // Char 109 (m)
-        {0x00, 0x00, 0xFC, 0xC6, 0xC6, 0xC6, 0xC6, 0x00, 0x07},        // Char 110 (n)
-        {0x00, 0x00, 0x7C, 0xC6, 0xC6, 0xC6, 0x7C, 0x00, 0x07},        // Char 111 (o)
-        {0x00, 0x00, 0xFC, 0xC6, 0xC6, 0xFC, 0xC0, 0xC0, 0x07},        // Char 112 (p)
-        {0x00, 0x00, 0x7E, 0xC6, 0xC6, 0x7E, 0x06, 0x06, 0x07},        // Char 113 (q)
-        {0x00, 0x00, 0xFC, 0xC6, 0xC0, 0xC0, 0xC0, 0x00, 0x07},        // Char 114 (r)
-        {0x00, 0x00, 0x7E, 0xC0, 0x7C, 0x06, 0xFC, 0x00, 0x07},        // Char 115 (s)
-        {0x30, 0x30, 0xFC, 0x30, 0x30, 0x30, 0x1C, 0x00, 0x06},        // Char 116 (t)
-        {0x00, 0x00, 0xC6, 0xC6, 0xC6, 0xC6, 0x7E, 0x00, 0x07},        // Char 117 (u)
-        {0x00, 0x00, 0xC6, 0xC6, 0xC6, 0x7C, 0x38, 0x00, 0x07},        // Char 118 (v)
-        {0x00, 0x00, 0xC6, 0xC6, 0xD6, 0xFE, 0x6C, 0x00, 0x07},        // Char 119 (w)
-        {0x00, 0x00, 0xC6, 0x6C, 0x38, 0x6C, 0xC6, 0x00, 0x07},        // Char 120 (x)
-        {0x00, 0x00, 0xC6, 0xC6, 0xC6, 0x7E, 0x06, 0xFC, 0x07},        // Char 121 (y)
-        {0x00, 0x00, 0xFE, 0x0C, 0x38, 0x60, 0xFE, 0x00, 0x07},        // Char 122 (z)
-        {0x1C, 0x30, 0x30, 0xE0, 0x30, 0x30, 0x1C, 0x00, 0x06},        // Char 123 ({)
-        {0xC0, 0xC0, 0xC0, 0x00, 0xC0, 0xC0, 0xC0, 0x00, 0x02},        // Char 124 (|)
-        {0xE0, 0x30, 0x30, 0x1C, 0x30, 0x30, 0xE0, 0x00, 0x06},        // Char 125 (})
-        {0x76, 0xDC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07},        // Char 126 (~)
-        {0x00, 0x10, 0x38, 0x6C, 0xC6, 0xC6, 0xFE, 0x00, 0x07}         // Char 127 (.)
+static uint8_t const font_08px_widths[96] = {
+        1, 2, 5, 7, 7, 7, 7, 3, 4, 4, 8, 6, 3, 6, 2, 7,
+        7, 6, 7, 7, 7, 7, 7, 7, 7, 7, 2, 3, 5, 6, 5, 6,
+        7, 7, 7, 7, 7, 7, 7, 7, 7, 6, 7, 7, 7, 7, 7, 7,
+        7, 7, 7, 7, 8, 7, 7, 7, 7, 7, 7, 4, 7, 4, 7, 8,
+        3, 7, 7, 7, 7, 7, 6, 7, 7, 4, 7, 7, 3, 7, 7, 7,
+        7, 7, 7, 7, 6, 7, 7, 7, 7, 7, 7, 6, 2, 6, 7, 7
 };
 
 /**
- * \asserts ( framebuffer != NULL )
- * \asserts ( framebuffer->set_pixel != NULL )
+ * Offset of the first column of a glyph in \ref font_08px_bitmap, index = (ASCII-Code - 0x20)
  */
-enum status_code font_08px_draw_character (
-  struct Framebuffer *framebuffer       //< pointer to the framebuffer to draw the bitmap to
-,               char  character         //< character to draw
-,           uint32_t  pixel_value       //< value to set for the pixels
-,           uint16_t  x0                //< x start position of character bitmap in framebuffer
-,           uint16_t  y0                //< y start position of character bitmap in framebuffer
-,            uint8_t  font_background   //< how to draw font background
-,            uint8_t *char_width        //< [out] width of character drawn in pixel
-){
-        Assert( framebuffer != NULL );
-        Assert( framebuffer->set_pixel != NULL );
-        
-        Framebuffer_Set_Pixel *set_pixel = framebuffer->set_pixel;
-
-            uint16_t  char_idx;         // index of the character byte in the font
-                bool  is_set_pixel;     // true if we want to set pixel_value for that pixel
-        uint_fast8_t  scanline;         // a single x line of bits 
-        uint_fast8_t  x, y;             // current x and y pixel position to draw
-        
-        // find out which entry of the font array to use
-        char_idx = character - 0x20;
-        if( ( char_idx < 0 ) || ( char_idx > FONT_08PX_CHAR_IDX_MAX ) ) {
-                char_idx = 1; // print <SPACE> for unknown characters
-        }
-        
-        *char_width = font_08px[char_idx][FONT_08PX_CHAR_WIDTH_BYTE_IDX];
-
-        // we paint forward in y- and in x-direction
-        // - y is the scanline index for the character bitmap (we got from top to bottom)
-        // - for the pixel information we use the scanline byte like a shift register and evaluate the 2^7 bit
-        y = 0;        // y to start with
-        do {
-                x = 0;        // x to start with
-                scanline = font_08px[char_idx][y];
-                while( x < *char_width ){
-                        is_set_pixel = scanline & 0x80; // evaluate the bit at 2^7
-                        if( is_set_pixel ){
-                                set_pixel( framebuffer, x0+x, y0+y, pixel_value );  // always draw pixel if to set
-                        } else {
-                                if( font_background == FONT_BACKGROUND_OPAQUE ){
-                                        set_pixel( framebuffer, x0+x, y0+y, 0x00 ); // only clear background pixel, if mode is opaque
-                                }
-                        }
-                        scanline = scanline << 1;
-                        x++;
-                }
-                y++;
-        } while ( y < FONT_08PX_HEIGHT );
-                
-        return STATUS_OK;
-}
+static uint16_t const font_08px_offsets[96] = {
+           0,    1,    3,    8,   15,   22,   29,   36,   39,   43,   47,   55,   61,   64,   70,   72,
+          79,   86,   92,   99,  106,  113,  120,  127,  134,  141,  148,  150,  153,  158,  164,  169,
+         175,  182,  189,  196,  203,  210,  217,  224,  231,  238,  244,  251,  258,  265,  272,  279,
+         286,  293,  300,  307,  314,  322,  329,  336,  343,  350,  357,  364,  368,  375,  379,  386,
+         394,  397,  404,  411,  418,  425,  432,  438,  445,  452,  456,  463,  470,  473,  480,  487,
+         494,  501,  508,  515,  522,  528,  535,  542,  549,  556,  563,  570,  576,  578,  584,  591
+};
 
 /**
- * \asserts ( framebuffer != NULL )
- * \asserts ( string      != NULL )
+ * Glyph columns, one byte per column, top most pixel in bit 0
  */
-enum status_code font_08px_draw_string (
-  struct Framebuffer *framebuffer       //< pointer to the framebuffer to draw the bitmap to
-,         const char *string            //< string to draw
-,           uint32_t  pixel_value       //< value to set for the pixels
-,           uint16_t  x0                //< x start position of character bitmap in framebuffer
-,           uint16_t  y0                //< y start position of character bitmap in framebuffer
-,            uint8_t  font_background   //< how to draw font background
-,            uint8_t *string_width      //< [out] width of character drawn in pixel
-){
-        Assert( framebuffer != NULL );
-        Assert( string      != NULL );
-
-        *string_width = 0;
-        
-        uint_fast8_t  x_pos      = 0;
-             uint8_t  char_width = 0;
-                char  curr;
-        
-        for( uint_fast8_t idx = 0; idx < 256; idx++ ) {
-                curr = string[idx];
-                if( curr == 0x00 ){
-                        break;
-                }
-                font_08px_draw_character( framebuffer, string[idx], pixel_value, x0+x_pos, y0, FONT_BACKGROUND_OPAQUE, &char_width); 
-                x_pos += char_width + 1;
-                *string_width += char_width + 1;
-        }
-        if( *string_width > 0 ){
-                (*string_width)--;
-        }
+static uint8_t const font_08px_bitmap[598] = {
+        0x00,                                           // Char 032 ( )
+        0x5F, 0x5F,                                     // Char 033 (!)
+        0x07, 0x07, 0x00, 0x07, 0x07,                   // Char 034 (")
+        0x14, 0x7F, 0x7F, 0x14, 0x7F, 0x7F, 0x14,       // Char 035 (#)
+        0x24, 0x2E, 0x2A, 0x6B, 0x6B, 0x3A, 0x12,       // Char 036 ($)
+        0x46, 0x66, 0x30, 0x18, 0x0C, 0x66, 0x62,       // Char 037 (%)
+        0x30, 0x7A, 0x4F, 0x5D, 0x37, 0x7A, 0x48,       // Char 038 (&)
+        0x04, 0x07, 0x03,                               // Char 039 (')
+        0x1C, 0x3E, 0x63, 0x41,                         // Char 040 (()
+        0x41, 0x63, 0x3E, 0x1C,                         // Char 041 ())
+        0x08, 0x2A, 0x3E, 0x1C, 0x1C, 0x3E, 0x2A, 0x08, // Char 042 (*)
+        0x08, 0x08, 0x3E, 0x3E, 0x08, 0x08,             // Char 043 (+)
+        0x80, 0xE0, 0x60,                               // Char 044 (,)
+        0x08, 0x08, 0x08, 0x08, 0x08, 0x08,             // Char 045 (-)
+        0x60, 0x60,                                     // Char 046 (.)
+        0x60, 0x30, 0x18, 0x0C, 0x06, 0x03, 0x01,       // Char 047 (/)
+        0x3E, 0x7F, 0x59, 0x4D, 0x47, 0x7F, 0x3E,       // Char 048 (0)
+        0x40, 0x42, 0x7F, 0x7F, 0x40, 0x40,             // Char 049 (1)
+        0x72, 0x7B, 0x49, 0x49, 0x49, 0x4F, 0x46,       // Char 050 (2)
+        0x41, 0x41, 0x49, 0x49, 0x49, 0x7F, 0x36,       // Char 051 (3)
+        0x1E, 0x1E, 0x10, 0x10, 0x7F, 0x7F, 0x10,       // Char 052 (4)
+        0x27, 0x67, 0x45, 0x45, 0x45, 0x7D, 0x39,       // Char 053 (5)
+        0x3E, 0x7F, 0x49, 0x49, 0x49, 0x79, 0x30,       // Char 054 (6)
+        0x01, 0x01, 0x61, 0x71, 0x19, 0x0F, 0x07,       // Char 055 (7)
+        0x36, 0x7F, 0x49, 0x49, 0x49, 0x7F, 0x36,       // Char 056 (8)
+        0x06, 0x4F, 0x49, 0x49, 0x49, 0x7F, 0x3E,       // Char 057 (9)
+        0x66, 0x66,                                     // Char 058 (:)
+        0x80, 0xE6, 0x66,                               // Char 059 (;)
+        0x08, 0x1C, 0x36, 0x63, 0x41,                   // Char 060 (<)
+        0x14, 0x14, 0x14, 0x14, 0x14, 0x14,             // Char 061 (=)
+        0x41, 0x63, 0x36, 0x1C, 0x08,                   // Char 062 (>)
+        0x02, 0x03, 0x59, 0x5D, 0x07, 0x02,             // Char 063 (?)
+        0x3E, 0x7F, 0x41, 0x5D, 0x5D, 0x5F, 0x5E,       // Char 064 (@)
+        0x7C, 0x7E, 0x13, 0x11, 0x13, 0x7E, 0x7C,       // Char 065 (A)
+        0x7F, 0x7F, 0x49, 0x49, 0x49, 0x7F, 0x36,       // Char 066 (B)
+        0x3E, 0x7F, 0x41, 0x41, 0x41, 0x63, 0x22,       // Char 067 (C)
+        0x7F, 0x7F, 0x41, 0x41, 0x63, 0x3E, 0x1C,       // Char 068 (D)
+        0x7F, 0x7F, 0x49, 0x49, 0x49, 0x41, 0x41,       // Char 069 (E)
+        0x7F, 0x7F, 0x09, 0x09, 0x09, 0x01, 0x01,       // Char 070 (F)
+        0x3E, 0x7F, 0x41, 0x41, 0x51, 0x73, 0x32,       // Char 071 (G)
+        0x7F, 0x7F, 0x08, 0x08, 0x08, 0x7F, 0x7F,       // Char 072 (H)
+        0x41, 0x41, 0x7F, 0x7F, 0x41, 0x41,             // Char 073 (I)
+        0x20, 0x60, 0x40, 0x40, 0x40, 0x7F, 0x3F,       // Char 074 (J)
+        0x7F, 0x7F, 0x08, 0x1C, 0x36, 0x63, 0x41,       // Char 075 (K)
+        0x7F, 0x7F, 0x40, 0x40, 0x40, 0x40, 0x40,       // Char 076 (L)
+        0x7F, 0x7F, 0x0E, 0x1C, 0x0E, 0x7F, 0x7F,       // Char 077 (M)
+        0x7F, 0x7F, 0x06, 0x0C, 0x18, 0x7F, 0x7F,       // Char 078 (N)
+        0x3E, 0x7F, 0x41, 0x41, 0x41, 0x7F, 0x3E,       // Char 079 (O)
+        0x7F, 0x7F, 0x09, 0x09, 0x09, 0x0F, 0x06,       // Char 080 (P)
+        0x3E, 0x7F, 0x41, 0x71, 0x61, 0xFF, 0xBE,       // Char 081 (Q)
+        0x7F, 0x7F, 0x09, 0x19, 0x39, 0x6F, 0x46,       // Char 082 (R)
+        0x26, 0x6F, 0x49, 0x49, 0x49, 0x7B, 0x32,       // Char 083 (S)
+        0x01, 0x01, 0x01, 0x7F, 0x7F, 0x01, 0x01, 0x01, // Char 084 (T)
+        0x7F, 0x7F, 0x40, 0x40, 0x40, 0x7F, 0x7F,       // Char 085 (U)
+        0x1F, 0x3F, 0x60, 0x60, 0x60, 0x3F, 0x1F,       // Char 086 (V)
+        0x3F, 0x7F, 0x60, 0x30, 0x60, 0x7F, 0x3F,       // Char 087 (W)
+        0x63, 0x77, 0x1C, 0x08, 0x1C, 0x77, 0x63,       // Char 088 (X)
+        0x47, 0x4F, 0x68, 0x38, 0x18, 0x0F, 0x07,       // Char 089 (Y)
+        0x41, 0x61, 0x71, 0x59, 0x4D, 0x47, 0x43,       // Char 090 (Z)
+        0x7F, 0x7F, 0x41, 0x41,                         // Char 091 ([)
+        0x01, 0x03, 0x06, 0x0C, 0x18, 0x30, 0x60,       // Char 092 (\)
+        0x41, 0x41, 0x7F, 0x7F,                         // Char 093 (])
+        0x08, 0x0C, 0x06, 0x03, 0x06, 0x0C, 0x08,       // Char 094 (^)
+        0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, // Char 095 (_)
+        0x03, 0x07, 0x04,                               // Char 096 (`)
+        0x20, 0x74, 0x54, 0x54, 0x54, 0x7C, 0x78,       // Char 097 (a)
+        0x7F, 0x7F, 0x44, 0x44, 0x44, 0x7C, 0x38,       // Char 098 (b)
+        0x38, 0x7C, 0x44, 0x44, 0x44, 0x6C, 0x28,       // Char 099 (c)
+        0x38, 0x7C, 0x44, 0x44, 0x44, 0x7F, 0x7F,       // Char 100 (d)
+        0x38, 0x7C, 0x54, 0x54, 0x54, 0x5C, 0x18,       // Char 101 (e)
+        0x48, 0x7E, 0x7F, 0x49, 0x03, 0x02,             // Char 102 (f)
+        0x98, 0xBC, 0xA4, 0xA4, 0xA4, 0xFC, 0x7C,       // Char 103 (g)
+        0x7F, 0x7F, 0x04, 0x04, 0x04, 0x7C, 0x78,       // Char 104 (h)
+        0x44, 0x7D, 0x7D, 0x40,                         // Char 105 (i)
+        0x40, 0xC0, 0x80, 0x80, 0x80, 0xFD, 0x7D,       // Char 106 (j)
+        0x7F, 0x7F, 0x10, 0x18, 0x3C, 0x64, 0x40,       // Char 107 (k)
+        0x3F, 0x7F, 0x40,                               // Char 108 (l)
+        0x7C, 0x7C, 0x18, 0x78, 0x1C, 0x7C, 0x78,       // Char 109 (m)
+        0x7C, 0x7C, 0x04, 0x04, 0x04, 0x7C, 0x78,       // Char 110 (n)
+        0x38, 0x7C, 0x44, 0x44, 0x44, 0x7C, 0x38,       // Char 111 (o)
+        0xFC, 0xFC, 0x24, 0x24, 0x24, 0x3C, 0x18,       // Char 112 (p)
+        0x18, 0x3C, 0x24, 0x24, 0x24, 0xFC, 0xFC,       // Char 113 (q)
+        0x7C, 0x7C, 0x04, 0x04, 0x04, 0x0C, 0x08,       // Char 114 (r)
+        0x48, 0x5C, 0x54, 0x54, 0x54, 0x74, 0x24,       // Char 115 (s)
+        0x04, 0x04, 0x3F, 0x7F, 0x44, 0x44,             // Char 116 (t)
+        0x3C, 0x7C, 0x40, 0x40, 0x40, 0x7C, 0x7C,       // Char 117 (u)
+        0x1C, 0x3C, 0x60, 0x60, 0x60, 0x3C, 0x1C,       // Char 118 (v)
+        0x3C, 0x7C, 0x60, 0x30, 0x60, 0x7C, 0x3C,       // Char 119 (w)
+        0x44, 0x6C, 0x38, 0x10, 0x38, 0x6C, 0x44,       // Char 120 (x)
+        0x9C, 0xBC, 0xA0, 0xA0, 0xA0, 0xFC, 0x7C,       // Char 121 (y)
+        0x44, 0x64, 0x74, 0x54, 0x5C, 0x4C, 0x44,       // Char 122 (z)
+        0x08, 0x08, 0x3E, 0x77, 0x41, 0x41,             // Char 123 ({)
+        0x77, 0x77,                                     // Char 124 (|)
+        0x41, 0x41, 0x77, 0x3E, 0x08, 0x08,             // Char 125 (})
+        0x02, 0x03, 0x01, 0x03, 0x02, 0x03, 0x01,       // Char 126 (~)
+        0x70, 0x78, 0x4C, 0x46, 0x4C, 0x78, 0x70        // Char 127 (.)
+};
 
-        return STATUS_OK;
-}
+struct Font const font_08px = {
+        .height       = 8,
+        .spacing      = 1,
+        .code_first   = 0x20,
+        .code_last    = 0x7F,
+        .code_default = 0x20,
+        .widths       = font_08px_widths,
+        .offsets      = font_08px_offsets,
+        .bitmap       = font_08px_bitmap
+};
@@ -0,0 +1,153 @@
+/**     \file   Font_Text_Field.c
+
+        \brief  Implementation of a line of text, that repaints only the characters that changed.
+ 
+        \license 
+                MIT: The MIT License (https://opensource.org/licenses/MIT)
+                .
+                Permission is hereby granted, free of charge, to any person obtaining a copy of this software 
+                and associated documentation files (the "Software"), to deal in the Software without restriction, 
+                including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+                and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, 
+                subject to the following conditions:
+                .
+                The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+                .
+                THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+                INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. 
+                IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+                WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR 
+                THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ 
+        \copyright
+                DIT: 2026; Drechsler Information Technologies; www.drechsler-it.de
+ 
+        \authors
+                jrgdre: Joerg Drechsler; DIT
+ 
+        \versions
+                1.0.0: 2026-10-17 jrgdre initial release
+
+ */
+#include "Font_Text_Field.h"            // text field interface
+
+// ===========================================================================
+//  public
+// ===========================================================================
+
+/**
+ * \asserts ( field != NULL )
+ * \asserts ( font  != NULL )
+ */
+void font_text_field_init (
+  struct Font_Text_Field *field         //< text field to initialize
+, struct Framebuffer     *framebuffer   //< framebuffer to draw to
+, struct Font const      *font          //< font to draw with
+,               uint32_t  pixel_value   //< value of the text pixels
+,               uint16_t  x             //< x position of the upper left corner
+,               uint16_t  y             //< y position of the upper left corner
+){
+        Assert( field != NULL );
+        Assert( font  != NULL );
+        
+        field->framebuffer = framebuffer;
+        field->font        = font;
+        field->pixel_value = pixel_value;
+        field->x           = x;
+        field->y           = y;
+        field->width       = 0;
+        field->length      = 0;
+        field->text[0]     = 0x00;
+}
+
+/**
+ * \brief Repaint the glyphs of a text field that changed, with the framebuffer's raster operation set to SET.
+ */
+static enum status_code text_field_repaint (
+  struct Font_Text_Field *field         //< text field to update
+,             char const *text          //< new text
+){
+        struct Font const *font   = field->font;
+        enum status_code   status = STATUS_OK;
+        uint_fast8_t       idx    = 0;
+        uint16_t           x      = 0;          // x offset of the glyph at idx
+        uint8_t            width  = 0;          // width of the glyph at idx
+        
+        // the glyphs in front of the first changed character keep their place
+        while(( idx < field->length ) && ( text[idx] == field->text[idx] )){
+                idx++;
+        }
+        if( idx > 0 ){
+                width = font_measure_character( font, text[idx - 1] );
+                x     = field->glyph_x[idx - 1] + width + font->spacing;
+        }
+        
+        for( ; ( status == STATUS_OK ) && ( idx < FONT_TEXT_FIELD_LENGTH_MAX ) && ( text[idx] != 0x00 ); idx++ ){
+                bool unchanged = ( idx             <  field->length  )
+                              && ( text[idx]       == field->text[idx] )
+                              && ( x               == field->glyph_x[idx] );
+                
+                if( unchanged ){
+                        width = font_measure_character( font, text[idx] );
+                } else {
+                        status = font_draw_character( field->framebuffer, font, text[idx], field->pixel_value, 
+                                                      field->x + x, field->y, FONT_BACKGROUND_OPAQUE, &width );
+                        if(( status == STATUS_OK ) && ( text[idx + 1] != 0x00 ) && ( idx + 1 < FONT_TEXT_FIELD_LENGTH_MAX )){
+                                // the gap to the next glyph may hold pixels of a glyph drawn at another place before
+                                status = framebuffer_fill_rect( field->framebuffer, field->x + x + width, field->y, 
+                                                                font->spacing, font->height, 0x00 );
+                        }
+                        field->text   [idx] = text[idx];
+                        field->glyph_x[idx] = x;
+                }
+                x += width + font->spacing;
+        }
+        if( status != STATUS_OK ){
+                // the field content is unknown, draw all of it at the next update
+                field->length = 0;
+                field->width  = x > field->width ? x : field->width;
+                return status;
+        }
+        
+        // clear what is left of a wider text drawn before
+        x = idx > 0 ? x - font->spacing : 0;
+        if( field->width > x ){
+                status = framebuffer_fill_rect( field->framebuffer, field->x + x, field->y, field->width - x, font->height, 0x00 );
+        }
+        
+        field->text[idx] = 0x00;
+        field->length    = idx;
+        if( status == STATUS_OK ){
+                field->width = x; // otherwise keep clearing up to the wider text at the next update
+        }
+        
+        if(( status == STATUS_OK ) && ( text[idx] != 0x00 )){
+                status = STATUS_ERR_OVERFLOW;
+        }
+        
+        return status;
+}
+
+/**
+ * \asserts ( field != NULL )
+ * \asserts ( text  != NULL )
+ */
+enum status_code font_text_field_update (
+  struct Font_Text_Field *field         //< text field to update
+,             char const *text          //< new text
+){
+        Assert( field != NULL );
+        Assert( text  != NULL );
+        
+        if( field->framebuffer == NULL ){
+                return STATUS_ERR_INVALID_ARG;
+        }
+        
+        // the field keeps track of what it has drawn, which only holds for plain set pixels
+        enum Framebuffer_Raster_Op raster_op = framebuffer_set_raster_op( field->framebuffer, FRAMEBUFFER_RASTER_OP_SET );
+        enum status_code           status    = text_field_repaint( field, text );
+        
+        framebuffer_set_raster_op( field->framebuffer, raster_op );
+        
+        return status;
+}
@@ -0,0 +1,94 @@
+/**     \file   Font_Text_Field.h
+
+        \brief  Declarations of a line of text, that repaints only the characters that changed.
+ 
+        \license 
+                MIT: The MIT License (https://opensource.org/licenses/MIT)
+                .
+                Permission is hereby granted, free of charge, to any person obtaining a copy of this software 
+                and associated documentation files (the "Software"), to deal in the Software without restriction, 
+                including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+                and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, 
+                subject to the following conditions:
+                .
+                The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+                .
+                THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+                INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. 
+                IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+                WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR 
+                THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ 
+        \copyright
+                DIT: 2026; Drechsler Information Technologies; www.drechsler-it.de
+ 
+        \authors
+                jrgdre: Joerg Drechsler; DIT
+ 
+        \versions
+                1.0.0: 2026-10-17 jrgdre initial release
+
+ */
+#ifndef FONT_TEXT_FIELD_H
+#define FONT_TEXT_FIELD_H
+
+#include <asf.h>
+#include "Font.h"
+#include "Framebuffer.h"
+
+#ifndef FONT_TEXT_FIELD_LENGTH_MAX
+#define FONT_TEXT_FIELD_LENGTH_MAX      32      //< maximum number of characters of a text field
+#endif
+
+/**
+        \brief A single line of text at a fixed position, for readouts updated over and over
+        
+        The field remembers the characters it has drawn and where. An update compares the new text character by character
+        and repaints only the glyph cells that changed. Glyph positions are recalculated from the first character with a 
+        different width onward, so "-73db" -> "-74db" repaints one glyph, not the line.
+        Since unchanged tiles are not touched, the next \ref ssd1306_display_update() sends only the tiles of changed glyphs.
+        
+        The text is drawn with an opaque background, always with \ref FRAMEBUFFER_RASTER_OP_SET. A field owns the pixel rows [y, y + font->height) from x up to the 
+        right end of the widest text it has drawn, nothing else should draw there.
+        
+ */
+struct Font_Text_Field {
+        struct Framebuffer *framebuffer ; //< framebuffer the field is drawn to
+        struct Font const  *font        ; //< font of the field
+        uint32_t            pixel_value ; //< value of the text pixels
+        uint16_t            x           ; //< x position of the upper left corner
+        uint16_t            y           ; //< y position of the upper left corner
+        uint16_t            width       ; //< width of the text drawn in pixel
+        uint8_t             length      ; //< number of characters drawn
+        char                text   [FONT_TEXT_FIELD_LENGTH_MAX + 1]; //< characters drawn, zero terminated
+        uint16_t            glyph_x[FONT_TEXT_FIELD_LENGTH_MAX    ]; //< x offset of the glyphs drawn, relative to x
+};
+
+/**
+ * \brief Initialize an empty text field, nothing is drawn.
+ */
+void font_text_field_init (
+  struct Font_Text_Field *field         //< text field to initialize
+, struct Framebuffer     *framebuffer   //< framebuffer to draw to
+, struct Font const      *font          //< font to draw with
+,               uint32_t  pixel_value   //< value of the text pixels
+,               uint16_t  x             //< x position of the upper left corner
+,               uint16_t  y             //< y position of the upper left corner
+);
+
+/**
+ * \brief Change the text of a text field, repainting only the glyphs that changed.
+ *
+ * Texts longer than \ref FONT_TEXT_FIELD_LENGTH_MAX characters are cut.
+ *
+ * \return Status of operation.
+ * \retval STATUS_OK               If operation was successfully
+ * \retval STATUS_ERR_OVERFLOW     If \ref text was cut, the cut text is drawn
+ * \retval STATUS_ERR_INVALID_ARG  If the field's framebuffer is not assigned
+ */
+enum status_code font_text_field_update (
+  struct Font_Text_Field *field         //< text field to update
+,             char const *text          //< new text
+);
+
+#endif // FONT_TEXT_FIELD_H
@@ -0,0 +1,169 @@
+/**     \file   Frame_Scheduler.c
+
+        \brief  Implementation of a frame scheduler, that paces the updates of a SSD1306 display.
+ 
+        \license 
+                MIT: The MIT License (https://opensource.org/licenses/MIT)
+                .
+                Permission is hereby granted, free of charge, to any person obtaining a copy of this software 
+                and associated documentation files (the "Software"), to deal in the Software without restriction, 
+                including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+                and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, 
+                subject to the following conditions:
+                .
+                The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+                .
+                THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+                INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. 
+                IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+                WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR 
+                THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ 
+        \copyright
+                DIT: 2026; Drechsler Information Technologies; www.drechsler-it.de
+ 
+        \authors
+                jrgdre: Joerg Drechsler; DIT
+ 
+        \versions
+                1.0.0: 2026-10-17 jrgdre initial release
+
+ */
+#include <string.h>                     // memset
+#include "Frame_Scheduler.h"            // frame scheduler interface
+
+// ===========================================================================
+//  public
+// ===========================================================================
+
+/**
+ * \asserts scheduler != NULL
+ * \asserts ssd1306   != NULL
+ */
+void frame_scheduler_init (
+  struct Frame_Scheduler       *const scheduler         //< scheduler to initialize
+, struct SSD1306               *const ssd1306           //< controller to send the frames to
+, Frame_Scheduler_Clock        *const clock             //< tick counter (NULL: no pacing, no times)
+,                     uint32_t  const ticks_per_second  //< frequency of the tick counter
+,                     uint16_t  const fps               //< target frame rate (0: no pacing)
+){
+        Assert( scheduler != NULL );
+        Assert( ssd1306   != NULL );
+        
+        scheduler->ssd1306          = ssd1306;
+        scheduler->clock            = clock;
+        scheduler->ticks_per_second = ticks_per_second;
+        
+        frame_scheduler_set_fps    ( scheduler, fps );
+        frame_scheduler_stats_reset( scheduler );
+};
+
+/**
+ * \asserts scheduler != NULL
+ */
+void frame_scheduler_set_fps (
+  struct Frame_Scheduler       *const scheduler         //< scheduler to change
+,                     uint16_t  const fps               //< target frame rate (0: no pacing)
+){
+        Assert( scheduler != NULL );
+        
+        scheduler->frame_ticks = 0;
+        scheduler->frame_due   = 0;
+        
+        if(( scheduler->clock == NULL )
+        || ( fps              <  1    )
+        ){
+                return;
+        }
+        
+        scheduler->frame_ticks = scheduler->ticks_per_second / fps;
+        if( scheduler->frame_ticks < 1 ){
+                scheduler->frame_ticks = 1;             // as fast as the clock can tell
+        }
+        scheduler->frame_due   = scheduler->clock();
+};
+
+/**
+ * \asserts scheduler   != NULL
+ * \asserts framebuffer != NULL
+ */
+enum status_code frame_scheduler_present (
+  struct Frame_Scheduler *const scheduler               //< scheduler of the display
+, struct Framebuffer     *const framebuffer             //< framebuffer to present
+){
+        Assert( scheduler   != NULL );
+        Assert( framebuffer != NULL );
+        
+        if( scheduler->frame_ticks < 1 ){
+                return frame_scheduler_flush( scheduler, framebuffer );
+        }
+        
+        // ticks since the frame before was due: it is in the past, so the difference stays right,
+        // when the counter wraps, however late the frame is
+        uint32_t elapsed = scheduler->clock() - ( scheduler->frame_due - scheduler->frame_ticks );
+        
+        if( elapsed < scheduler->frame_ticks ){
+                return STATUS_NO_CHANGE;                // not due yet, draw on
+        }
+        
+        // the frames due meanwhile are gone, keep the frames on their grid
+        uint32_t frames_missed = ( elapsed - scheduler->frame_ticks ) / scheduler->frame_ticks;
+        
+        scheduler->stats.frames_dropped += frames_missed;
+        scheduler->frame_due            += ( frames_missed + 1 ) * scheduler->frame_ticks;
+        
+        return frame_scheduler_flush( scheduler, framebuffer );
+};
+
+/**
+ * \asserts scheduler   != NULL
+ * \asserts framebuffer != NULL
+ */
+enum status_code frame_scheduler_flush (
+  struct Frame_Scheduler *const scheduler               //< scheduler of the display
+, struct Framebuffer     *const framebuffer             //< framebuffer to send
+){
+        Assert( scheduler   != NULL );
+        Assert( framebuffer != NULL );
+        
+        struct SSD1306               *ssd1306      = scheduler->ssd1306;
+        struct Frame_Scheduler_Stats *stats        = &scheduler->stats;
+        uint32_t                      transactions = ssd1306->transactions_written;
+        uint32_t                      bytes        = ssd1306->bytes_written;
+        uint32_t                      ticks        = ( scheduler->clock != NULL ) ? scheduler->clock() : 0;
+        
+        enum status_code status = ssd1306_display_update( ssd1306, framebuffer );
+        
+        ticks        = ( scheduler->clock != NULL ) ? scheduler->clock() - ticks : 0;
+        transactions = ssd1306->transactions_written - transactions;
+        bytes        = ssd1306->bytes_written        - bytes;
+        
+        stats->frames_flushed++;
+        stats->transactions      += transactions;
+        stats->bytes             += bytes;
+        stats->transactions_last  = transactions;
+        stats->bytes_last         = bytes;
+        stats->flush_ticks_total += ticks;
+        
+        if( ticks < stats->flush_ticks_min ){
+                stats->flush_ticks_min = ticks;
+        }
+        if( ticks > stats->flush_ticks_max ){
+                stats->flush_ticks_max = ticks;
+        }
+        
+        return status;
+};
+
+/**
+ * \asserts scheduler != NULL
+ */
+void frame_scheduler_stats_reset (
+  struct Frame_Scheduler *const scheduler               //< scheduler to reset the statistics of
+){
+        Assert( scheduler != NULL );
+        
+        memset( &scheduler->stats, 0x00, sizeof( scheduler->stats ) );
+        
+        scheduler->stats.flush_ticks_min = UINT32_MAX;
+};
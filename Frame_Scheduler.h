@@ -0,0 +1,145 @@
+/**     \file   Frame_Scheduler.h
+
+        \brief  Declarations of a frame scheduler, that paces the updates of a SSD1306 display.
+ 
+        \license 
+                MIT: The MIT License (https://opensource.org/licenses/MIT)
+                .
+                Permission is hereby granted, free of charge, to any person obtaining a copy of this software 
+                and associated documentation files (the "Software"), to deal in the Software without restriction, 
+                including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+                and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, 
+                subject to the following conditions:
+                .
+                The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+                .
+                THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+                INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. 
+                IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+                WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR 
+                THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ 
+        \copyright
+                DIT: 2026; Drechsler Information Technologies; www.drechsler-it.de
+ 
+        \authors
+                jrgdre: Joerg Drechsler; DIT
+ 
+        \versions
+                1.0.0: 2026-10-17 jrgdre initial release
+
+ */
+#ifndef FRAME_SCHEDULER_H
+#define FRAME_SCHEDULER_H
+
+#include <asf.h>
+#include "Framebuffer.h"
+#include "SSD1306.h"
+
+typedef uint32_t Frame_Scheduler_Clock( void ); //< get a free running tick counter, e.g. the counter of a TC or the RTC
+
+/**
+ * \brief Statistics of the frames of a frame scheduler
+ *
+ * Times are in ticks of the clock of the scheduler. 
+ * The average time of a flush is \ref flush_ticks_total / \ref frames_flushed.
+ */
+struct Frame_Scheduler_Stats {
+        uint32_t frames_flushed    ; //< frames sent to the display
+        uint32_t frames_dropped    ; //< frame slots passed without a frame, since drawing or sending took too long
+        uint32_t transactions      ; //< bus transactions of all frames flushed
+        uint32_t bytes             ; //< bytes written to the bus of all frames flushed
+        uint32_t transactions_last ; //< bus transactions of the last frame flushed
+        uint32_t bytes_last        ; //< bytes written to the bus of the last frame flushed
+        uint32_t flush_ticks_min   ; //< shortest time a flush took (UINT32_MAX: no frame yet)
+        uint32_t flush_ticks_max   ; //< longest  time a flush took
+        uint32_t flush_ticks_total ; //< time all flushes took
+};
+
+/**
+ * \brief Frame scheduler of a SSD1306 display
+ *
+ * The application presents the framebuffer as often as it likes, e.g. after every line drawn (see \ref frame_scheduler_present()).
+ * The scheduler sends it to the display only, when a frame is due at the target frame rate, 
+ * so everything drawn in between goes out in one update.
+ * If drawing and sending take longer than a frame, the frames due meanwhile are dropped, instead of piling up.
+ * Without a clock or frame rate every present is sent at once.
+ */
+struct Frame_Scheduler {
+        struct SSD1306                  *ssd1306           ; //< controller to send the frames to
+        Frame_Scheduler_Clock           *clock             ; //< tick counter (NULL: no pacing, no times)
+        uint32_t                         ticks_per_second  ; //< frequency of the tick counter
+        uint32_t                         frame_ticks       ; //< time between two frames (0: no pacing)
+        uint32_t                         frame_due         ; //< tick the next frame is due at
+        struct Frame_Scheduler_Stats     stats             ; //< statistics of the frames
+};
+
+/**
+ * \brief Initialize a frame scheduler for \ref fps frames per second.
+ *
+ * The first frame is due at once.
+ *
+ * \asserts scheduler != NULL
+ * \asserts ssd1306   != NULL
+ */
+void frame_scheduler_init (
+  struct Frame_Scheduler       *const scheduler         //< scheduler to initialize
+, struct SSD1306               *const ssd1306           //< controller to send the frames to
+, Frame_Scheduler_Clock        *const clock             //< tick counter (NULL: no pacing, no times)
+,                     uint32_t  const ticks_per_second  //< frequency of the tick counter
+,                     uint16_t  const fps               //< target frame rate (0: no pacing)
+);
+
+/**
+ * \brief Change the target frame rate of a frame scheduler.
+ *
+ * The next frame is due at once.
+ *
+ * \asserts scheduler != NULL
+ */
+void frame_scheduler_set_fps (
+  struct Frame_Scheduler       *const scheduler         //< scheduler to change
+,                     uint16_t  const fps               //< target frame rate (0: no pacing)
+);
+
+/**
+ * \brief Present the framebuffer: send it to the display, if a frame is due.
+ *
+ * \return Status of operation.
+ * \retval STATUS_OK                    If the frame was sent
+ * \retval STATUS_NO_CHANGE             If no frame is due yet, what's drawn goes out with the next one
+ * \retval any                          Status of \ref ssd1306_display_update()
+ *
+ * \asserts scheduler   != NULL
+ * \asserts framebuffer != NULL
+ */
+enum status_code frame_scheduler_present (
+  struct Frame_Scheduler *const scheduler               //< scheduler of the display
+, struct Framebuffer     *const framebuffer             //< framebuffer to present
+);
+
+/**
+ * \brief Send the framebuffer to the display now, e.g. the last frame of an animation.
+ *
+ * The frame is counted and timed, but doesn't change when the next one is due.
+ *
+ * \return Status of \ref ssd1306_display_update().
+ *
+ * \asserts scheduler   != NULL
+ * \asserts framebuffer != NULL
+ */
+enum status_code frame_scheduler_flush (
+  struct Frame_Scheduler *const scheduler               //< scheduler of the display
+, struct Framebuffer     *const framebuffer             //< framebuffer to send
+);
+
+/**
+ * \brief Reset the statistics of a frame scheduler.
+ *
+ * \asserts scheduler != NULL
+ */
+void frame_scheduler_stats_reset (
+  struct Frame_Scheduler *const scheduler               //< scheduler to reset the statistics of
+);
+
+#endif // FRAME_SCHEDULER_H
@@ -0,0 +1,125 @@
+/**     \file   Frame_Scheduler_Test.c
+
+        \brief  Host test of the frame pacing of the frame scheduler.
+ 
+        \license 
+                MIT: The MIT License (https://opensource.org/licenses/MIT)
+                .
+                Permission is hereby granted, free of charge, to any person obtaining a copy of this software 
+                and associated documentation files (the "Software"), to deal in the Software without restriction, 
+                including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+                and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, 
+                subject to the following conditions:
+                .
+                The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+                .
+                THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+                INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. 
+                IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+                WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR 
+                THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ 
+        \copyright
+                DIT: 2026; Drechsler Information Technologies; www.drechsler-it.de
+ 
+        \authors
+                jrgdre: Joerg Drechsler; DIT
+ 
+        \versions
+                1.0.0: 2026-10-17 jrgdre initial release
+
+ */
+#include <string.h>                     // memset
+#include "Com_Driver_SSD1306_Emulator.h"// display data RAM of the controller
+#include "Frame_Scheduler.h"            // scheduler tested
+#include "Framebuffer_SSD1306.h"        // SSD1306 framebuffer
+#include "SSD1306.h"                    // controller
+#include "Test.h"                       // checks
+
+static struct SSD1306                     ssd1306   ; //< controller the frames go to
+static struct Com_Driver_SSD1306_Emulator emulator  ; //< executes the traffic
+static struct Frame_Scheduler             scheduler ; //< scheduler tested
+static uint32_t                           ticks     ; //< time of the test clock
+
+/**
+ * \brief Test clock, set by the tests
+ */
+static uint32_t clock_test (
+  void
+){
+        return ticks;
+}
+
+/**
+ * \brief Set up a scheduler at 10 frames per second of 1000 ticks, starting at tick \ref start
+ */
+static struct Framebuffer *setup (
+  uint32_t const start                          //< tick the test starts at
+){
+        struct Framebuffer *fb = framebuffer_SSD1306_create( SSD1306_COLUMNS, SSD1306_GEOMETRY_128x64 );
+        
+        memset( &ssd1306, 0x00, sizeof( ssd1306 ) );
+        ssd1306.address            = 0x3C;
+        ssd1306.geometry           = SSD1306_GEOMETRY_128x64;
+        ssd1306.charge_pump_source = SSD1306_CHARGE_PUMP_SOURCE_INTERNAL_VCC;
+        
+        com_driver_ssd1306_emulator_init( &ssd1306.com_driver, &emulator );
+        TEST_CHECK( ssd1306_init( &ssd1306 ) == STATUS_OK );
+        fb->clear( fb );  // the tiles of a new framebuffer are undefined
+        
+        ticks = start;
+        frame_scheduler_init( &scheduler, &ssd1306, clock_test, 1000, 10 );
+        
+        return fb;
+}
+
+/**
+ * \brief Frames go out on their grid, across a wrap of the clock
+ */
+static void test_grid (
+  void
+){
+        struct Framebuffer *fb = setup( UINT32_MAX - 50 );
+        
+        TEST_CHECK( frame_scheduler_present( &scheduler, fb ) != STATUS_NO_CHANGE );    // first frame at once
+        ticks += 99;
+        TEST_CHECK( frame_scheduler_present( &scheduler, fb ) == STATUS_NO_CHANGE );
+        ticks += 1;                                                                     // wraps
+        TEST_CHECK( frame_scheduler_present( &scheduler, fb ) != STATUS_NO_CHANGE );
+        ticks += 350;
+        TEST_CHECK( frame_scheduler_present( &scheduler, fb ) != STATUS_NO_CHANGE );
+        TEST_CHECK( scheduler.stats.frames_dropped == 2 );
+        ticks += 49;
+        TEST_CHECK( frame_scheduler_present( &scheduler, fb ) == STATUS_NO_CHANGE );
+        ticks += 1;
+        TEST_CHECK( frame_scheduler_present( &scheduler, fb ) != STATUS_NO_CHANGE );
+        TEST_CHECK( scheduler.stats.frames_flushed == 4 );
+        
+        fb->destroy( fb );
+}
+
+/**
+ * \brief A frame more than half the range of the clock late is still due
+ */
+static void test_very_late (
+  void
+){
+        struct Framebuffer *fb = setup( 0 );
+        
+        TEST_CHECK( frame_scheduler_present( &scheduler, fb ) != STATUS_NO_CHANGE );
+        ticks += 0x80000000u + 100;
+        TEST_CHECK( frame_scheduler_present( &scheduler, fb ) != STATUS_NO_CHANGE );
+        TEST_CHECK( scheduler.stats.frames_flushed == 2 );
+        TEST_CHECK( frame_scheduler_present( &scheduler, fb ) == STATUS_NO_CHANGE );
+        
+        fb->destroy( fb );
+}
+
+int main (
+  void
+){
+        test_grid();
+        test_very_late();
+        
+        return TEST_RESULT();
+}
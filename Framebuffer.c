@@ -0,0 +1,404 @@
+/**     \file   Framebuffer.c
+
+        \brief  Generic framebuffer operations, falling back to per pixel access where a framebuffer has no better implementation.
+
+        \license 
+                MIT: The MIT License (https://opensource.org/licenses/MIT)
+                .
+                Permission is hereby granted, free of charge, to any person obtaining a copy of this software 
+                and associated documentation files (the "Software"), to deal in the Software without restriction, 
+                including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+                and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, 
+                subject to the following conditions:
+                .
+                The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+                .
+                THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+                INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. 
+                IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+                WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR 
+                THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ 
+        \copyright
+                DIT: 2026; Drechsler Information Technologies; www.drechsler-it.de
+ 
+        \authors
+                jrgdre: Joerg Drechsler; DIT
+ 
+        \versions
+                1.0.0: 2026-10-17 initial release
+
+ */
+#include "Framebuffer.h"                // generic framebuffer interface
+
+// ===========================================================================
+//  private
+// ===========================================================================
+
+/**
+ * \brief Clip a run of \ref length pixels starting at \ref start to \ref limit.
+ *
+ * \return Number of pixels of the run inside the limit.
+ */
+static inline uint32_t clip_length (
+  uint32_t const start          //< first pixel of the run
+, uint32_t const length         //< number of pixels in the run
+, uint32_t const limit          //< number of pixels available (width or height of the framebuffer)
+){
+        if( start >= limit ){
+                return 0;
+        }
+        if( length > limit - start ){
+                return limit - start;
+        }
+        return length;
+};
+
+// ===========================================================================
+//  public
+// ===========================================================================
+
+/**
+ * \brief Select the raster operation used for drawing.
+ */
+enum Framebuffer_Raster_Op framebuffer_set_raster_op(
+  struct Framebuffer         *framebuffer       //< framebuffer to draw to
+, enum Framebuffer_Raster_Op  raster_op         //< raster operation to use
+){
+        enum Framebuffer_Raster_Op raster_op_prev = FRAMEBUFFER_RASTER_OP_SET;
+        
+        if( framebuffer != NULL ){
+                raster_op_prev         = framebuffer->raster_op;
+                framebuffer->raster_op = raster_op;
+        }
+        return raster_op_prev;
+}
+
+/**
+ * \brief Set pixel_value for a horizontal run of pixels.
+ */
+enum status_code framebuffer_fill_hspan(
+  struct Framebuffer *framebuffer       //< framebuffer to draw to
+,           uint32_t  x                 //< x position of the left most pixel
+,           uint32_t  y                 //< y position of the span
+,           uint32_t  width             //< number of pixels in the span
+,           uint32_t  pixel_value       //< value to set for the pixels
+){
+        if( framebuffer == NULL ){
+                return STATUS_ERR_INVALID_ARG;
+        }
+        if( framebuffer->fill_hspan != NULL ){
+                return framebuffer->fill_hspan( framebuffer, x, y, width, pixel_value );
+        }
+        
+        return framebuffer_fill_rect( framebuffer, x, y, width, 1, pixel_value );
+}
+
+/**
+ * \brief Set pixel_value for a vertical run of pixels.
+ */
+enum status_code framebuffer_fill_vspan(
+  struct Framebuffer *framebuffer       //< framebuffer to draw to
+,           uint32_t  x                 //< x position of the span
+,           uint32_t  y                 //< y position of the top most pixel
+,           uint32_t  height            //< number of pixels in the span
+,           uint32_t  pixel_value       //< value to set for the pixels
+){
+        if( framebuffer == NULL ){
+                return STATUS_ERR_INVALID_ARG;
+        }
+        if( framebuffer->fill_vspan != NULL ){
+                return framebuffer->fill_vspan( framebuffer, x, y, height, pixel_value );
+        }
+        
+        return framebuffer_fill_rect( framebuffer, x, y, 1, height, pixel_value );
+}
+
+/**
+ * \brief Set pixel_value for all pixels of a rectangle.
+ */
+enum status_code framebuffer_fill_rect(
+  struct Framebuffer *framebuffer       //< framebuffer to draw to
+,           uint32_t  x                 //< x position of the upper left corner
+,           uint32_t  y                 //< y position of the upper left corner
+,           uint32_t  width             //< width  of the rectangle in pixels
+,           uint32_t  height            //< height of the rectangle in pixels
+,           uint32_t  pixel_value       //< value to set for the pixels
+){
+        if( framebuffer == NULL ){
+                return STATUS_ERR_INVALID_ARG;
+        }
+        if( framebuffer->fill_rect != NULL ){
+                return framebuffer->fill_rect( framebuffer, x, y, width, height, pixel_value );
+        }
+        if( framebuffer->set_pixel == NULL ){
+                return STATUS_ERR_INVALID_ARG;
+        }
+        
+        Framebuffer_Set_Pixel *set_pixel = framebuffer->set_pixel;
+        
+        width  = clip_length( x, width , framebuffer->width  );
+        height = clip_length( y, height, framebuffer->height );
+        
+        for( uint32_t row = y; row < y + height; row++ ){
+                for( uint32_t column = x; column < x + width; column++ ){
+                        set_pixel( framebuffer, column, row, pixel_value );
+                }
+        }
+        
+        return STATUS_OK;
+}
+
+/**
+ * \brief Draw a 1bpp bitmap.
+ */
+enum status_code framebuffer_blit(
+  struct Framebuffer *framebuffer       //< framebuffer to draw to
+,           uint32_t  x                 //< x position of the upper left corner
+,           uint32_t  y                 //< y position of the upper left corner
+,           uint32_t  width             //< width  of the bitmap in pixels
+,           uint32_t  height            //< height of the bitmap in pixels
+,      uint8_t const *bitmap            //< bitmap to draw
+,           uint32_t  stride            //< number of bytes per bitmap row
+,           uint32_t  pixel_value       //< value to set for the pixels of set bits
+,               bool  opaque            //< if true, pixels of cleared bits are set to 0x00
+){
+        if(( framebuffer == NULL )
+        || ( bitmap      == NULL )
+        ){
+                return STATUS_ERR_INVALID_ARG;
+        }
+        if( framebuffer->blit != NULL ){
+                return framebuffer->blit( framebuffer, x, y, width, height, bitmap, stride, pixel_value, opaque );
+        }
+        if( framebuffer->set_pixel == NULL ){
+                return STATUS_ERR_INVALID_ARG;
+        }
+        
+        Framebuffer_Set_Pixel *set_pixel = framebuffer->set_pixel;
+        
+        width  = clip_length( x, width , framebuffer->width  );
+        height = clip_length( y, height, framebuffer->height );
+        
+        for( uint32_t row = 0; row < height; row++ ){
+                uint8_t const *scanline = &bitmap[ row * stride ];
+                for( uint32_t column = 0; column < width; column++ ){
+                        if( scanline[ column >> 3 ] & ( 0x80 >> ( column & 0x07 ) ) ){
+                                set_pixel( framebuffer, x + column, y + row, pixel_value );
+                        } else if( opaque ){
+                                set_pixel( framebuffer, x + column, y + row, 0x00 );
+                        }
+                }
+        }
+        
+        return STATUS_OK;
+}
+
+/**
+ * \brief Draw a column major 1bpp bitmap of up to 8 pixel rows.
+ */
+enum status_code framebuffer_blit_columns(
+  struct Framebuffer *framebuffer       //< framebuffer to draw to
+,           uint32_t  x                 //< x position of the upper left corner
+,           uint32_t  y                 //< y position of the upper left corner
+,           uint32_t  width             //< width  of the bitmap in pixels (number of columns)
+,           uint32_t  height            //< height of the bitmap in pixels (1..8)
+,      uint8_t const *columns           //< bitmap to draw, one byte per column
+,           uint32_t  pixel_value       //< value to set for the pixels of set bits
+,               bool  opaque            //< if true, pixels of cleared bits are set to 0x00
+){
+        if(( framebuffer == NULL )
+        || ( columns     == NULL )
+        || ( height      >  8    )
+        ){
+                return STATUS_ERR_INVALID_ARG;
+        }
+        if( framebuffer->blit_columns != NULL ){
+                return framebuffer->blit_columns( framebuffer, x, y, width, height, columns, pixel_value, opaque );
+        }
+        if( framebuffer->set_pixel == NULL ){
+                return STATUS_ERR_INVALID_ARG;
+        }
+        
+        Framebuffer_Set_Pixel *set_pixel = framebuffer->set_pixel;
+        
+        width  = clip_length( x, width , framebuffer->width  );
+        height = clip_length( y, height, framebuffer->height );
+        
+        for( uint32_t column = 0; column < width; column++ ){
+                for( uint32_t row = 0; row < height; row++ ){
+                        if( columns[ column ] & ( 0x01 << row ) ){
+                                set_pixel( framebuffer, x + column, y + row, pixel_value );
+                        } else if( opaque ){
+                                set_pixel( framebuffer, x + column, y + row, 0x00 );
+                        }
+                }
+        }
+        
+        return STATUS_OK;
+}
+
+/**
+ * \brief Count the pixels of a horizontal run (not) having a value.
+ */
+enum status_code framebuffer_scan_hspan(
+  struct Framebuffer *framebuffer       //< framebuffer to read from
+,           uint32_t  x                 //< x position of the first pixel of the run
+,           uint32_t  y                 //< y position of the run
+,           uint32_t  x_end             //< x position of the last pixel the run may include
+,           uint32_t  pixel_value       //< value to compare the pixels with
+,               bool  equal             //< if true, count pixels having pixel_value, otherwise pixels not having it
+,           uint32_t *length            //< [out] number of pixels in the run
+){
+        if(( framebuffer == NULL )
+        || ( length      == NULL )
+        ){
+                return STATUS_ERR_INVALID_ARG;
+        }
+        if( framebuffer->scan_hspan != NULL ){
+                return framebuffer->scan_hspan( framebuffer, x, y, x_end, pixel_value, equal, length );
+        }
+        if( framebuffer->get_pixel == NULL ){
+                return STATUS_ERR_INVALID_ARG;
+        }
+        
+        Framebuffer_Get_Pixel *get_pixel = framebuffer->get_pixel;
+        
+        *length = 0;
+        if(( x >= framebuffer->width  )
+        || ( y >= framebuffer->height )
+        ){
+                return STATUS_OK;
+        }
+        if( x_end >= framebuffer->width ){
+                x_end = framebuffer->width - 1;
+        }
+        
+        int32_t  const step  = x_end >= x ? 1 : -1;
+        uint32_t const count = x_end >= x ? x_end - x + 1 : x - x_end + 1;
+        uint32_t       value;
+        
+        for( ; *length < count; (*length)++, x += step ){
+                get_pixel( framebuffer, x, y, &value );
+                if(( value == pixel_value ) != equal ){
+                        break;
+                }
+        }
+        
+        return STATUS_OK;
+}
+
+/**
+ * \brief Copy a rectangle of pixels inside the framebuffer.
+ */
+enum status_code framebuffer_copy_rect(
+  struct Framebuffer *framebuffer       //< framebuffer to copy in
+,           uint32_t  x_src             //< x position of the upper left corner of the source
+,           uint32_t  y_src             //< y position of the upper left corner of the source
+,           uint32_t  width             //< width  of the rectangle in pixels
+,           uint32_t  height            //< height of the rectangle in pixels
+,           uint32_t  x_dst             //< x position of the upper left corner of the destination
+,           uint32_t  y_dst             //< y position of the upper left corner of the destination
+){
+        if( framebuffer == NULL ){
+                return STATUS_ERR_INVALID_ARG;
+        }
+        
+        // source and destination both have to be inside the framebuffer
+        width  = clip_length( x_dst, clip_length( x_src, width , framebuffer->width  ), framebuffer->width  );
+        height = clip_length( y_dst, clip_length( y_src, height, framebuffer->height ), framebuffer->height );
+        if(( width  < 1 )
+        || ( height < 1 )
+        || (( x_src == x_dst ) && ( y_src == y_dst ) && ( framebuffer->raster_op == FRAMEBUFFER_RASTER_OP_SET ))
+        ){
+                return STATUS_OK; // nothing to do
+        }
+        
+        if( framebuffer->copy_rect != NULL ){
+                return framebuffer->copy_rect( framebuffer, x_src, y_src, width, height, x_dst, y_dst );
+        }
+        if(( framebuffer->get_pixel == NULL )
+        || ( framebuffer->set_pixel == NULL )
+        ){
+                return STATUS_ERR_INVALID_ARG;
+        }
+        
+        Framebuffer_Get_Pixel *get_pixel = framebuffer->get_pixel;
+        Framebuffer_Set_Pixel *set_pixel = framebuffer->set_pixel;
+        
+        // like memmove(), walk away from the destination, so no source pixel is overwritten before it is read
+        bool     const up    = ( y_dst <= y_src );
+        bool     const left  = ( x_dst <= x_src );
+        uint32_t       value;
+        
+        for( uint32_t r = 0; r < height; r++ ){
+                uint32_t row = up ? r : height - 1 - r;
+                
+                for( uint32_t c = 0; c < width; c++ ){
+                        uint32_t column = left ? c : width - 1 - c;
+                        
+                        get_pixel( framebuffer, x_src + column, y_src + row, &value );
+                        set_pixel( framebuffer, x_dst + column, y_dst + row,  value );
+                }
+        }
+        
+        return STATUS_OK;
+}
+
+/**
+ * \brief Move the content of a rectangle, setting the area uncovered to pixel_value.
+ */
+enum status_code framebuffer_scroll_rect(
+  struct Framebuffer *framebuffer       //< framebuffer to scroll in
+,           uint32_t  x                 //< x position of the upper left corner
+,           uint32_t  y                 //< y position of the upper left corner
+,           uint32_t  width             //< width  of the rectangle in pixels
+,           uint32_t  height            //< height of the rectangle in pixels
+,            int32_t  dx                //< pixels to move the content to the right (< 0: to the left)
+,            int32_t  dy                //< pixels to move the content down (< 0: up)
+,           uint32_t  pixel_value       //< value to set for the pixels uncovered
+){
+        if( framebuffer == NULL ){
+                return STATUS_ERR_INVALID_ARG;
+        }
+        
+        width  = clip_length( x, width , framebuffer->width  );
+        height = clip_length( y, height, framebuffer->height );
+        
+        uint32_t const dx_abs = dx < 0 ? 0u - (uint32_t)dx : (uint32_t)dx;    // no overflow for INT32_MIN
+        uint32_t const dy_abs = dy < 0 ? 0u - (uint32_t)dy : (uint32_t)dy;
+        
+        enum status_code           status    = STATUS_OK;
+        enum Framebuffer_Raster_Op raster_op = framebuffer->raster_op;
+        
+        if(( dx_abs >= width  )
+        || ( dy_abs >= height )
+        ){
+                // all content moved out
+                framebuffer_set_raster_op( framebuffer, FRAMEBUFFER_RASTER_OP_SET );
+                status = framebuffer_fill_rect( framebuffer, x, y, width, height, pixel_value );
+                framebuffer_set_raster_op( framebuffer, raster_op );
+                return status;
+        }
+        
+        uint32_t const width_kept  = width  - dx_abs;
+        uint32_t const height_kept = height - dy_abs;
+        uint32_t const y_kept      = dy > 0 ? y + dy_abs : y;   // upper edge of the rows keeping content
+        
+        status = framebuffer_copy_rect( framebuffer, 
+                                        dx < 0 ? x + dx_abs : x, dy < 0 ? y + dy_abs : y, width_kept, height_kept, 
+                                        dx > 0 ? x + dx_abs : x, y_kept );
+        
+        // uncovered rows across the whole width, uncovered columns next to the content,
+        // set to pixel_value whatever the raster op of the framebuffer is
+        framebuffer_set_raster_op( framebuffer, FRAMEBUFFER_RASTER_OP_SET );
+        if(( status == STATUS_OK ) && ( dy_abs > 0 )){
+                status = framebuffer_fill_rect( framebuffer, x, dy > 0 ? y : y + height_kept, width, dy_abs, pixel_value );
+        }
+        if(( status == STATUS_OK ) && ( dx_abs > 0 )){
+                status = framebuffer_fill_rect( framebuffer, dx > 0 ? x : x + width_kept, y_kept, dx_abs, height_kept, pixel_value );
+        }
+        framebuffer_set_raster_op( framebuffer, raster_op );
+        
+        return status;
+}
@@ -37,25 +37,240 @@
 
 struct Framebuffer;
 
-typedef enum status_code Framebuffer_Clear     ( struct Framebuffer *framebuffer );                                                //< reset framebuffer content to clear state
-typedef enum status_code Framebuffer_Destroy   ( struct Framebuffer *framebuffer );                                                //< release all framebuffer allocated resources
-typedef enum status_code Framebuffer_Get_Pixel ( struct Framebuffer *framebuffer, uint32_t x, uint32_t y, uint32_t *pixel_value ); //< get the value of a pixel
-typedef enum status_code Framebuffer_Set_Pixel ( struct Framebuffer *framebuffer, uint32_t x, uint32_t y, uint32_t  pixel_value ); //< set the value of a pixel
+/**
+ * \brief How a pixel drawn to a framebuffer is combined with the pixel it replaces
+ *
+ * All drawing operations of a framebuffer (set_pixel(), the fills and blits) apply its \ref raster_op to
+ * every pixel they touch. clear() is not affected.
+ */
+enum Framebuffer_Raster_Op {
+        FRAMEBUFFER_RASTER_OP_SET    = 0x00,    //< pixel = pixel_value (default)
+        FRAMEBUFFER_RASTER_OP_CLEAR  = 0x01,    //< pixel = 0, pixel_value is ignored
+        FRAMEBUFFER_RASTER_OP_XOR    = 0x02,    //< pixel = pixel ^ pixel_value, drawing the same thing twice restores the pixels
+        FRAMEBUFFER_RASTER_OP_INVERT = 0x03     //< pixel = ~pixel, pixel_value is ignored
+};
+
+typedef enum status_code Framebuffer_Clear      ( struct Framebuffer *framebuffer );                                                  //< reset framebuffer content to clear state
+typedef enum status_code Framebuffer_Destroy    ( struct Framebuffer *framebuffer );                                                  //< release all framebuffer allocated resources
+typedef enum status_code Framebuffer_Get_Pixel  ( struct Framebuffer *framebuffer, uint32_t x, uint32_t y, uint32_t *pixel_value );   //< get the value of a pixel
+typedef enum status_code Framebuffer_Set_Pixel  ( struct Framebuffer *framebuffer, uint32_t x, uint32_t y, uint32_t  pixel_value );   //< set the value of a pixel
+typedef enum status_code Framebuffer_Fill_HSpan ( struct Framebuffer *framebuffer, uint32_t x, uint32_t y, uint32_t width , uint32_t pixel_value ); //< set the value of a horizontal run of pixels
+typedef enum status_code Framebuffer_Fill_VSpan ( struct Framebuffer *framebuffer, uint32_t x, uint32_t y, uint32_t height, uint32_t pixel_value ); //< set the value of a vertical run of pixels
+typedef enum status_code Framebuffer_Fill_Rect  ( struct Framebuffer *framebuffer, uint32_t x, uint32_t y, uint32_t width, uint32_t height, uint32_t pixel_value ); //< set the value of a rectangle of pixels
+typedef enum status_code Framebuffer_Blit       ( struct Framebuffer *framebuffer, uint32_t x, uint32_t y, uint32_t width, uint32_t height, 
+                                                  uint8_t const *bitmap, uint32_t stride, uint32_t pixel_value, bool opaque );        //< draw a 1bpp bitmap
+typedef enum status_code Framebuffer_Blit_Columns ( struct Framebuffer *framebuffer, uint32_t x, uint32_t y, uint32_t width, uint32_t height, 
+                                                  uint8_t const *columns, uint32_t pixel_value, bool opaque );                        //< draw a column major 1bpp bitmap of up to 8 pixel rows
+typedef enum status_code Framebuffer_Scan_HSpan   ( struct Framebuffer *framebuffer, uint32_t x, uint32_t y, uint32_t x_end, 
+                                                  uint32_t pixel_value, bool equal, uint32_t *length );                               //< count a horizontal run of pixels (not) having a value
+typedef enum status_code Framebuffer_Copy_Rect    ( struct Framebuffer *framebuffer, uint32_t x_src, uint32_t y_src, uint32_t width, uint32_t height, 
+                                                  uint32_t x_dst, uint32_t y_dst );                                                   //< copy a rectangle of pixels inside the framebuffer
 
 /**
         \brief Generic Framebuffer data type
         
         This data type should be used in all functions that want to access a framebuffer independent of it's specific characteristics.
         
+        The span and rectangle operations are optional. A framebuffer implementation sets them, if it can do better than 
+        setting pixel by pixel, otherwise they are NULL. Drawing code should call them through \ref framebuffer_fill_hspan() etc.,
+        which fall back to \ref set_pixel for framebuffers not implementing them.
+        
+        \ref raster_op selects how drawn pixels are combined with the framebuffer content. Every framebuffer
+        implementation has to honor it in set_pixel() and all the optional operations it implements.
+        
  */
 struct Framebuffer {
-        uint32_t               width    ; //< width  of the framebuffer in pixel
-        uint32_t               height   ; //< height of the framebuffer in pixel
-        Framebuffer_Clear     *clear    ; //< pointer to clear    () implementation to use for a specific framebuffer instance
-        Framebuffer_Destroy   *destroy  ; //< pointer to destroy  () implementation to use for a specific framebuffer instance
-        Framebuffer_Get_Pixel *get_pixel; //< pointer to get_pixel() implementation to use for a specific framebuffer instance
-        Framebuffer_Set_Pixel *set_pixel; //< pointer to set_pixel() implementation to use for a specific framebuffer instance
-        void                  *user_data; //< pointer to user defined data or data structure                
+        uint32_t                 width        ; //< width  of the framebuffer in pixel
+        uint32_t                 height       ; //< height of the framebuffer in pixel
+        Framebuffer_Clear        *clear       ; //< pointer to clear    () implementation to use for a specific framebuffer instance
+        Framebuffer_Destroy      *destroy     ; //< pointer to destroy  () implementation to use for a specific framebuffer instance
+        Framebuffer_Get_Pixel    *get_pixel   ; //< pointer to get_pixel() implementation to use for a specific framebuffer instance
+        Framebuffer_Set_Pixel    *set_pixel   ; //< pointer to set_pixel() implementation to use for a specific framebuffer instance
+        void                     *user_data   ; //< pointer to user defined data or data structure                
+        Framebuffer_Fill_HSpan   *fill_hspan  ; //< pointer to fill_hspan() implementation (optional, NULL: per pixel fallback)
+        Framebuffer_Fill_VSpan   *fill_vspan  ; //< pointer to fill_vspan() implementation (optional, NULL: per pixel fallback)
+        Framebuffer_Fill_Rect    *fill_rect   ; //< pointer to fill_rect () implementation (optional, NULL: per pixel fallback)
+        Framebuffer_Blit         *blit        ; //< pointer to blit      () implementation (optional, NULL: per pixel fallback)
+        Framebuffer_Blit_Columns *blit_columns; //< pointer to blit_columns() implementation (optional, NULL: per pixel fallback)
+        Framebuffer_Scan_HSpan   *scan_hspan  ; //< pointer to scan_hspan  () implementation (optional, NULL: per pixel fallback)
+        Framebuffer_Copy_Rect    *copy_rect   ; //< pointer to copy_rect   () implementation (optional, NULL: per pixel fallback)
+        enum Framebuffer_Raster_Op raster_op  ; //< how drawn pixels are combined with the framebuffer content
 };
 
+/**
+ * \brief Select how pixels drawn from now on are combined with the framebuffer content.
+ *
+ * \return The raster operation used before, to restore it when done.
+ */
+enum Framebuffer_Raster_Op framebuffer_set_raster_op(
+  struct Framebuffer         *framebuffer       //< framebuffer to draw to
+, enum Framebuffer_Raster_Op  raster_op         //< raster operation to use
+);
+
+/**
+ * \brief Set \ref pixel_value for a horizontal run of \ref width pixels starting at [\ref x,\ref y].
+ *
+ * Pixels outside the framebuffer are ignored.
+ *
+ * \return Status of operation.
+ * \retval STATUS_OK               If operation was successfully
+ * \retval STATUS_ERR_INVALID_ARG  If \ref framebuffer is not assigned
+ */
+enum status_code framebuffer_fill_hspan(
+  struct Framebuffer *framebuffer       //< framebuffer to draw to
+,           uint32_t  x                 //< x position of the left most pixel
+,           uint32_t  y                 //< y position of the span
+,           uint32_t  width             //< number of pixels in the span
+,           uint32_t  pixel_value       //< value to set for the pixels
+);
+
+/**
+ * \brief Set \ref pixel_value for a vertical run of \ref height pixels starting at [\ref x,\ref y].
+ *
+ * Pixels outside the framebuffer are ignored.
+ *
+ * \return Status of operation.
+ * \retval STATUS_OK               If operation was successfully
+ * \retval STATUS_ERR_INVALID_ARG  If \ref framebuffer is not assigned
+ */
+enum status_code framebuffer_fill_vspan(
+  struct Framebuffer *framebuffer       //< framebuffer to draw to
+,           uint32_t  x                 //< x position of the span
+,           uint32_t  y                 //< y position of the top most pixel
+,           uint32_t  height            //< number of pixels in the span
+,           uint32_t  pixel_value       //< value to set for the pixels
+);
+
+/**
+ * \brief Set \ref pixel_value for all pixels of the \ref width x \ref height rectangle with the upper left corner at [\ref x,\ref y].
+ *
+ * Pixels outside the framebuffer are ignored.
+ *
+ * \return Status of operation.
+ * \retval STATUS_OK               If operation was successfully
+ * \retval STATUS_ERR_INVALID_ARG  If \ref framebuffer is not assigned
+ */
+enum status_code framebuffer_fill_rect(
+  struct Framebuffer *framebuffer       //< framebuffer to draw to
+,           uint32_t  x                 //< x position of the upper left corner
+,           uint32_t  y                 //< y position of the upper left corner
+,           uint32_t  width             //< width  of the rectangle in pixels
+,           uint32_t  height            //< height of the rectangle in pixels
+,           uint32_t  pixel_value       //< value to set for the pixels
+);
+
+/**
+ * \brief Draw a 1bpp \ref bitmap with the upper left corner at [\ref x,\ref y].
+ *
+ * The bitmap is stored row by row, \ref stride bytes per row, the left most pixel of a row in bit 7 of the first byte.
+ * Pixels of set bits get \ref pixel_value. Pixels of cleared bits are set to 0x00 if \ref opaque, otherwise they are kept.
+ * Pixels outside the framebuffer are ignored.
+ *
+ * \return Status of operation.
+ * \retval STATUS_OK               If operation was successfully
+ * \retval STATUS_ERR_INVALID_ARG  If \ref framebuffer or \ref bitmap is not assigned
+ */
+enum status_code framebuffer_blit(
+  struct Framebuffer *framebuffer       //< framebuffer to draw to
+,           uint32_t  x                 //< x position of the upper left corner
+,           uint32_t  y                 //< y position of the upper left corner
+,           uint32_t  width             //< width  of the bitmap in pixels
+,           uint32_t  height            //< height of the bitmap in pixels
+,      uint8_t const *bitmap            //< bitmap to draw
+,           uint32_t  stride            //< number of bytes per bitmap row
+,           uint32_t  pixel_value       //< value to set for the pixels of set bits
+,               bool  opaque            //< if true, pixels of cleared bits are set to 0x00
+);
+
+/**
+ * \brief Draw a column major 1bpp bitmap of up to 8 pixel rows with the upper left corner at [\ref x,\ref y].
+ *
+ * The bitmap is stored column by column, one byte per column, the top most pixel of a column in bit 0.
+ * This is the memory layout of a page aligned SSD1306 tile, so a framebuffer of that kind can write a column 
+ * with one or two masked byte stores. Fonts use it to render glyphs.
+ * Pixels of set bits get \ref pixel_value. Pixels of cleared bits are set to 0x00 if \ref opaque, otherwise they are kept.
+ * Pixels outside the framebuffer are ignored.
+ *
+ * \return Status of operation.
+ * \retval STATUS_OK               If operation was successfully
+ * \retval STATUS_ERR_INVALID_ARG  If \ref framebuffer or \ref columns is not assigned, or \ref height is above 8
+ */
+enum status_code framebuffer_blit_columns(
+  struct Framebuffer *framebuffer       //< framebuffer to draw to
+,           uint32_t  x                 //< x position of the upper left corner
+,           uint32_t  y                 //< y position of the upper left corner
+,           uint32_t  width             //< width  of the bitmap in pixels (number of columns)
+,           uint32_t  height            //< height of the bitmap in pixels (1..8)
+,      uint8_t const *columns           //< bitmap to draw, one byte per column
+,           uint32_t  pixel_value       //< value to set for the pixels of set bits
+,               bool  opaque            //< if true, pixels of cleared bits are set to 0x00
+);
+
+/**
+ * \brief Count the pixels of a horizontal run starting at [\ref x,\ref y] and going towards \ref x_end.
+ *
+ * The run goes to the right if \ref x_end >= \ref x, otherwise to the left, and includes \ref x_end.
+ * If \ref equal, it ends in front of the first pixel with a value other than \ref pixel_value, otherwise 
+ * in front of the first pixel with \ref pixel_value. The run also ends at the framebuffer border.
+ * Fill algorithms use it to find the extent of an area without reading pixel by pixel.
+ *
+ * \return Status of operation.
+ * \retval STATUS_OK               If operation was successfully, \ref length is 0 if [\ref x,\ref y] is outside the framebuffer
+ * \retval STATUS_ERR_INVALID_ARG  If \ref framebuffer or \ref length is not assigned
+ */
+enum status_code framebuffer_scan_hspan(
+  struct Framebuffer *framebuffer       //< framebuffer to read from
+,           uint32_t  x                 //< x position of the first pixel of the run
+,           uint32_t  y                 //< y position of the run
+,           uint32_t  x_end             //< x position of the last pixel the run may include
+,           uint32_t  pixel_value       //< value to compare the pixels with
+,               bool  equal             //< if true, count pixels having pixel_value, otherwise pixels not having it
+,           uint32_t *length            //< [out] number of pixels in the run
+);
+
+/**
+ * \brief Copy the \ref width x \ref height rectangle at [\ref x_src,\ref y_src] to [\ref x_dst,\ref y_dst].
+ *
+ * Source and destination may overlap, the destination gets the source as it was before the copy.
+ * The pixels are written with the framebuffer's \ref raster_op, the source pixel values taking the place of pixel_value.
+ * The rectangle is clipped, so that source and destination are both inside the framebuffer, 
+ * before it is handed to \ref copy_rect, which gets only rectangles it can copy completely.
+ *
+ * \return Status of operation.
+ * \retval STATUS_OK               If operation was successfully
+ * \retval STATUS_ERR_INVALID_ARG  If \ref framebuffer is not assigned
+ */
+enum status_code framebuffer_copy_rect(
+  struct Framebuffer *framebuffer       //< framebuffer to copy in
+,           uint32_t  x_src             //< x position of the upper left corner of the source
+,           uint32_t  y_src             //< y position of the upper left corner of the source
+,           uint32_t  width             //< width  of the rectangle in pixels
+,           uint32_t  height            //< height of the rectangle in pixels
+,           uint32_t  x_dst             //< x position of the upper left corner of the destination
+,           uint32_t  y_dst             //< y position of the upper left corner of the destination
+);
+
+/**
+ * \brief Move the content of the \ref width x \ref height rectangle at [\ref x,\ref y] by [\ref dx,\ref dy] pixels.
+ *
+ * Content moved out of the rectangle is dropped, the area it uncovers is set to \ref pixel_value,
+ * regardless of the framebuffer's \ref raster_op (the moved content is copied with it).
+ * Pixels outside the rectangle are not touched. Scrolling a chart by a sample is one call 
+ * and the drawing of the new sample, instead of redrawing the chart.
+ *
+ * \return Status of operation.
+ * \retval STATUS_OK               If operation was successfully
+ * \retval STATUS_ERR_INVALID_ARG  If \ref framebuffer is not assigned
+ */
+enum status_code framebuffer_scroll_rect(
+  struct Framebuffer *framebuffer       //< framebuffer to scroll in
+,           uint32_t  x                 //< x position of the upper left corner
+,           uint32_t  y                 //< y position of the upper left corner
+,           uint32_t  width             //< width  of the rectangle in pixels
+,           uint32_t  height            //< height of the rectangle in pixels
+,            int32_t  dx                //< pixels to move the content to the right (< 0: to the left)
+,            int32_t  dy                //< pixels to move the content down (< 0: up)
+,           uint32_t  pixel_value       //< value to set for the pixels uncovered
+);
+
 #endif // FRAMEBUFFER_H
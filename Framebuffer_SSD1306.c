@@ -61,8 +61,7 @@ static enum status_code framebuffer_ssd1306_clear (
         Assert( fb_ssd1306->tiles_dirty != NULL );
 
         memset( (void *)fb_ssd1306->tiles      , 0x00, fb_ssd1306->bytes      );        // reset all pixel to 0x00
-        memset( (void *)fb_ssd1306->tiles_dirty, 0xFF, fb_ssd1306->bytes >> 3 );        // mark all tiles as dirty
-        fb_ssd1306->tiles_dirty_count = fb_ssd1306->bytes;                              // set the dirty tiles count to the number of tiles
+        framebuffer_ssd1306_mark_dirty_range( fb_ssd1306, 0, fb_ssd1306->bytes );       // mark all tiles as dirty
         
         return STATUS_OK;
 };
@@ -81,13 +80,22 @@ static enum status_code framebuffer_ssd1306_destroy (
                 
                 struct Framebuffer_SSD1306 *fb_ssd1306 = (struct Framebuffer_SSD1306 *)fb->user_data;
                 
+                if( fb_ssd1306->storage_static ){
+                        goto done;                                                                      // memory is owned by the caller
+                }
+                
                 if( fb_ssd1306->tiles != NULL ){
                         memset( (void *)fb_ssd1306->tiles      , 0x00, fb_ssd1306->bytes      );        // wipe pixel memory
                         free( fb_ssd1306->tiles );                                                      // release pixel memory
                 }
                 
+                if( fb_ssd1306->tiles_shadow != NULL ){
+                        memset( (void *)fb_ssd1306->tiles_shadow, 0x00, fb_ssd1306->bytes );     // wipe shadow memory
+                        free( fb_ssd1306->tiles_shadow );                                       // release shadow memory
+                }
+                
                 if( fb_ssd1306->tiles_dirty != NULL ){
-                        memset( (void *)fb_ssd1306->tiles_dirty, 0x00, fb_ssd1306->bytes >> 3 );        // wipe dirty tiles memory
+                        memset( (void *)fb_ssd1306->tiles_dirty, 0x00, fb_ssd1306->tiles_dirty_words * sizeof( framebuffer_ssd1306_dirty_t ) ); // wipe dirty tiles memory
                         free( fb_ssd1306->tiles_dirty );                                                // release dirty tiles memory
                 }
                 
@@ -107,6 +115,9 @@ done:
 /**
  * \brief Initialize a SSD1306 framebuffer structure
  *
+ * Memory for the tiles and the dirty tiles index is allocated, unless the structure uses static storage 
+ * (see \ref framebuffer_SSD1306_init_static()), in which case it has to be set up by the caller.
+ *
  * \asserts fb_ssd1306 != NULL
  */
 static enum status_code framebuffer_ssd1306_init (
@@ -120,10 +131,18 @@ static enum status_code framebuffer_ssd1306_init (
         fb_ssd1306->bits_per_tile     = sizeof( framebuffer_ssd1306_tile_t ) << 3;                      // in bits
         fb_ssd1306->pages             = height / fb_ssd1306->bits_per_tile;                             // number of pages, depending on display height and tile height
         fb_ssd1306->bytes             = fb_ssd1306->columns * fb_ssd1306->pages;                        // overall number of bytes for the fb_ssd1306
-        fb_ssd1306->tiles             = (framebuffer_ssd1306_tile_t *)malloc( fb_ssd1306->bytes      ); // allocate a new fb_ssd1306 bitmap (1 bit per pixel)
-        fb_ssd1306->tiles_dirty       = (                   uint8_t *)malloc( fb_ssd1306->bytes >> 3 ); // allocate a new dirty tiles index  (1 bit per tile in an 8 bit bitmap)
+        fb_ssd1306->tiles_dirty_words = FRAMEBUFFER_SSD1306_DIRTY_WORDS( fb_ssd1306->bytes );          // 1 bit per tile in 32 bit words
         fb_ssd1306->tiles_dirty_count = 0;
         
+        if( fb_ssd1306->storage_static ){
+                memset( (void *)fb_ssd1306->tiles_dirty, 0x00, fb_ssd1306->tiles_dirty_words * sizeof( framebuffer_ssd1306_dirty_t ) ); // clean dirty tiles index
+                return STATUS_OK;
+        }
+        
+        fb_ssd1306->tiles             = (framebuffer_ssd1306_tile_t  *)malloc( fb_ssd1306->bytes );    // allocate a new fb_ssd1306 bitmap (1 bit per pixel)
+        fb_ssd1306->tiles_dirty       = (framebuffer_ssd1306_dirty_t *)calloc( fb_ssd1306->tiles_dirty_words, sizeof( framebuffer_ssd1306_dirty_t ) ); // allocate a new, clean dirty tiles index
+        fb_ssd1306->tiles_shadow      = NULL;                                                          // no shadow, until asked for
+        
         if(( fb_ssd1306->tiles       == NULL ) 
         || ( fb_ssd1306->tiles_dirty == NULL ) 
         ){
@@ -133,6 +152,63 @@ static enum status_code framebuffer_ssd1306_init (
         return STATUS_OK;
 };
 
+/**
+ * \brief Mark a tile as dirty and keep the dirty tiles count up to date
+ */
+static inline void tile_mark_dirty (
+  struct Framebuffer_SSD1306 *const fb_ssd1306  //< SSD1306 framebuffer the tile is in
+,                   uint32_t  const tile_idx    //< index of the tile to mark
+){
+        framebuffer_ssd1306_dirty_t *tiles_dirty    = &fb_ssd1306->tiles_dirty[ tile_idx >> 5 ];                // 1 bit per tile in tiles_dirty
+        framebuffer_ssd1306_dirty_t  tiles_dirty_bit = (framebuffer_ssd1306_dirty_t)0x1 << ( tile_idx & 0x1F ); // bit of tile in its tiles_dirty word
+        
+        if( !( *tiles_dirty & tiles_dirty_bit ) ){ // tile not already marked as dirty
+                *tiles_dirty |= tiles_dirty_bit;                                                        // mark tile as dirty
+                fb_ssd1306->tiles_dirty_count++;                                                        // increase dirty tiles count
+        }
+};
+
+/**
+ * \brief Write the bits selected by \ref mask to a tile using \ref raster_op, marking the tile dirty if it changed
+ */
+static inline void tile_write_masked (
+  struct Framebuffer_SSD1306 *const fb_ssd1306  //< SSD1306 framebuffer the tile is in
+,                   uint32_t  const tile_idx    //< index of the tile to write to
+, framebuffer_ssd1306_tile_t  const mask        //< bits of the tile to write
+, framebuffer_ssd1306_tile_t  const bits        //< new values of the bits selected by mask
+, enum Framebuffer_Raster_Op  const raster_op   //< how to combine the bits with the tile
+){
+        framebuffer_ssd1306_tile_t tile_org = fb_ssd1306->tiles[ tile_idx ];
+        framebuffer_ssd1306_tile_t tile_new;
+        
+        switch( raster_op ){
+        case FRAMEBUFFER_RASTER_OP_CLEAR : tile_new =   tile_org & ~mask                  ; break;
+        case FRAMEBUFFER_RASTER_OP_XOR   : tile_new =   tile_org ^ ( bits & mask )        ; break;
+        case FRAMEBUFFER_RASTER_OP_INVERT: tile_new =   tile_org ^ mask                   ; break;
+        default                          : tile_new = ( tile_org & ~mask ) | ( bits & mask ); break;
+        }
+        
+        if( tile_new != tile_org ){
+                fb_ssd1306->tiles[ tile_idx ] = tile_new;
+                tile_mark_dirty( fb_ssd1306, tile_idx );
+        }
+};
+
+/**
+ * \brief Get the mask of the bits of \ref page that lie in the pixel rows [\ref y_start, \ref y_end)
+ */
+static inline framebuffer_ssd1306_tile_t page_mask (
+  uint32_t const page           //< page to get the mask for
+, uint32_t const y_start        //< first pixel row
+, uint32_t const y_end          //< pixel row behind the last pixel row
+){
+        uint32_t page_top = page << 3;
+        uint32_t bit_lo   = y_start > page_top       ? y_start - page_top : 0;
+        uint32_t bit_hi   = y_end   < page_top + 8   ? y_end   - page_top : 8;
+        
+        return (framebuffer_ssd1306_tile_t)( ( 0xFF << bit_lo ) & ( 0xFF >> ( 8 - bit_hi ) ) );
+};
+
 /**
  * Get the tile and bit index for for a pixel in the framebuffer 
  * based on the x,y coordinates of that pixel.
@@ -226,7 +302,6 @@ static enum status_code framebuffer_ssd1306_set_pixel (
         Assert( fb_ssd1306->tiles );
 
                  uint8_t  bit_idx     ; // bit index of the pixel within a tile
-                uint32_t  curr_pix_val; // current pixel value
         enum status_code  status      ; // return value of an operation
                 uint32_t  tile_idx    ; // tile the pixel is in
         
@@ -234,33 +309,10 @@ static enum status_code framebuffer_ssd1306_set_pixel (
         if( status != STATUS_OK ){
                 goto done;
         }
-         
-        status = framebuffer_ssd1306_get_pixel( fb, x, y, &curr_pix_val );
-        if( status != STATUS_OK ){
-                goto done;
-        }
-                       
-        // set pixel value
-        if( curr_pix_val == pixel_value ){
-                status = STATUS_OK;  // nothing to do
-                goto done;
-        };
-
-        if( pixel_value > 0x00 ){
-                fb_ssd1306->tiles[ tile_idx ] |=  ( 0x1 << bit_idx ); // set pixel
-        } else {
-                fb_ssd1306->tiles[ tile_idx ] &= ~( 0x1 << bit_idx ); // clear pixel
-        };
         
-        // update dirty tiles index and count
-        uint16_t  tiles_dirty_byte_idx = tile_idx >> 3;                                                  // 1 bit per tile in tiles_dirty
-         uint8_t  tiles_dirty_bit_idx  = tile_idx % (tiles_dirty_byte_idx << 3);                         // bit position of tile in tiles_dirty index byte
-            bool  tile_is_dirty        = ( fb_ssd1306->tiles_dirty[ tiles_dirty_byte_idx ] & ( 0x1 << tiles_dirty_bit_idx ) ) >> tiles_dirty_bit_idx; // current value
+        framebuffer_ssd1306_tile_t mask = (framebuffer_ssd1306_tile_t)( 0x1 << bit_idx );
         
-        if( !tile_is_dirty ){ // tile not already marked as dirty
-                fb_ssd1306->tiles_dirty[ tiles_dirty_byte_idx ] |= ( 0x1 << tiles_dirty_bit_idx );      // mark tile as dirty
-                fb_ssd1306->tiles_dirty_count++;                                                        // increase dirty tiles count
-        }
+        tile_write_masked( fb_ssd1306, tile_idx, mask, pixel_value > 0x00 ? mask : 0x00, fb->raster_op ); // marks the tile dirty if the pixel changed
         
         status = STATUS_OK;
         
@@ -268,6 +320,424 @@ done:
         return status;
 };
 
+/**
+ * \brief Set pixel_value for all pixels of a rectangle in framebuffer
+ *
+ * Works page by page, writing the bits of all rows of the rectangle inside a page with one masked tile write per column.
+ *
+ * \asserts ( fb            != NULL )
+ * \asserts ( fb->user_data != NULL );
+ */
+static enum status_code framebuffer_ssd1306_fill_rect (
+        struct Framebuffer *fb          //< framebuffer to draw to
+,                 uint32_t  x           //< x position of the upper left corner
+,                 uint32_t  y           //< y position of the upper left corner
+,                 uint32_t  width       //< width  of the rectangle in pixels
+,                 uint32_t  height      //< height of the rectangle in pixels
+,                 uint32_t  pixel_value //< value to set for the pixels
+){
+        Assert( fb            != NULL );
+        Assert( fb->user_data != NULL );
+        
+        struct Framebuffer_SSD1306 *fb_ssd1306 = (struct Framebuffer_SSD1306 *)fb->user_data;
+        
+        Assert( fb_ssd1306->tiles );
+        
+        uint32_t const height_max = fb_ssd1306->pages * fb_ssd1306->bits_per_tile;
+        
+        // clip the rectangle to the framebuffer
+        if(( x >= fb_ssd1306->columns )
+        || ( y >= height_max          )
+        ){
+                return STATUS_OK;
+        }
+        if( width  > fb_ssd1306->columns - x ){
+                width  = fb_ssd1306->columns - x;
+        }
+        if( height > height_max - y ){
+                height = height_max - y;
+        }
+        if(( width < 1 ) || ( height < 1 )){
+                return STATUS_OK;
+        }
+        
+        uint32_t const y_end      = y + height;
+        uint32_t const page_first = y >> 3;
+        uint32_t const page_last  = ( y_end - 1 ) >> 3;
+        
+        for( uint32_t page = page_first; page <= page_last; page++ ){
+                framebuffer_ssd1306_tile_t mask = page_mask( page, y, y_end );
+                framebuffer_ssd1306_tile_t bits = pixel_value > 0x00 ? mask : 0x00;
+                uint32_t                   tile_idx = ( page * fb_ssd1306->columns ) + x;
+                
+                for( uint32_t column = 0; column < width; column++, tile_idx++ ){
+                        tile_write_masked( fb_ssd1306, tile_idx, mask, bits, fb->raster_op );
+                }
+        }
+        
+        return STATUS_OK;
+};
+
+/**
+ * \brief Set pixel_value for a horizontal run of pixels in framebuffer
+ */
+static enum status_code framebuffer_ssd1306_fill_hspan (
+        struct Framebuffer *fb          //< framebuffer to draw to
+,                 uint32_t  x           //< x position of the left most pixel
+,                 uint32_t  y           //< y position of the span
+,                 uint32_t  width       //< number of pixels in the span
+,                 uint32_t  pixel_value //< value to set for the pixels
+){
+        return framebuffer_ssd1306_fill_rect( fb, x, y, width, 1, pixel_value );
+};
+
+/**
+ * \brief Set pixel_value for a vertical run of pixels in framebuffer
+ */
+static enum status_code framebuffer_ssd1306_fill_vspan (
+        struct Framebuffer *fb          //< framebuffer to draw to
+,                 uint32_t  x           //< x position of the span
+,                 uint32_t  y           //< y position of the top most pixel
+,                 uint32_t  height      //< number of pixels in the span
+,                 uint32_t  pixel_value //< value to set for the pixels
+){
+        return framebuffer_ssd1306_fill_rect( fb, x, y, 1, height, pixel_value );
+};
+
+/**
+ * \brief Draw a 1bpp bitmap to framebuffer
+ *
+ * Assembles the bits of a bitmap column inside a page and writes them with one masked tile write.
+ *
+ * \asserts ( fb            != NULL )
+ * \asserts ( fb->user_data != NULL );
+ * \asserts ( bitmap        != NULL );
+ */
+static enum status_code framebuffer_ssd1306_blit (
+        struct Framebuffer *fb          //< framebuffer to draw to
+,                 uint32_t  x           //< x position of the upper left corner
+,                 uint32_t  y           //< y position of the upper left corner
+,                 uint32_t  width       //< width  of the bitmap in pixels
+,                 uint32_t  height      //< height of the bitmap in pixels
+,            uint8_t const *bitmap      //< bitmap to draw
+,                 uint32_t  stride      //< number of bytes per bitmap row
+,                 uint32_t  pixel_value //< value to set for the pixels of set bits
+,                     bool  opaque      //< if true, pixels of cleared bits are set to 0x00
+){
+        Assert( fb            != NULL );
+        Assert( fb->user_data != NULL );
+        Assert( bitmap        != NULL );
+        
+        struct Framebuffer_SSD1306 *fb_ssd1306 = (struct Framebuffer_SSD1306 *)fb->user_data;
+        
+        Assert( fb_ssd1306->tiles );
+        
+        uint32_t const height_max = fb_ssd1306->pages * fb_ssd1306->bits_per_tile;
+        
+        // clip the bitmap to the framebuffer
+        if(( x >= fb_ssd1306->columns )
+        || ( y >= height_max          )
+        ){
+                return STATUS_OK;
+        }
+        if( width  > fb_ssd1306->columns - x ){
+                width  = fb_ssd1306->columns - x;
+        }
+        if( height > height_max - y ){
+                height = height_max - y;
+        }
+        if(( width < 1 ) || ( height < 1 )){
+                return STATUS_OK;
+        }
+        
+        uint32_t const y_end      = y + height;
+        uint32_t const page_first = y >> 3;
+        uint32_t const page_last  = ( y_end - 1 ) >> 3;
+        
+        for( uint32_t page = page_first; page <= page_last; page++ ){
+                uint32_t row_first = ( page << 3 ) > y ? ( page << 3 ) : y;             // first pixel row of the bitmap in this page
+                uint32_t row_end   = ( page << 3 ) + 8 < y_end ? ( page << 3 ) + 8 : y_end;
+                uint32_t tile_idx  = ( page * fb_ssd1306->columns ) + x;
+                
+                for( uint32_t column = 0; column < width; column++, tile_idx++ ){
+                        framebuffer_ssd1306_tile_t mask = 0x00;
+                        framebuffer_ssd1306_tile_t bits = 0x00;
+                        uint8_t const              src_mask = 0x80 >> ( column & 0x07 );
+                        uint8_t const             *src      = &bitmap[ ( ( row_first - y ) * stride ) + ( column >> 3 ) ];
+                        
+                        for( uint32_t row = row_first; row < row_end; row++, src += stride ){
+                                framebuffer_ssd1306_tile_t bit = 0x1 << ( row & 0x07 );
+                                if( *src & src_mask ){
+                                        mask |= bit;
+                                        if( pixel_value > 0x00 ){
+                                                bits |= bit;
+                                        }
+                                } else if( opaque ){
+                                        mask |= bit;
+                                }
+                        }
+                        if( mask != 0x00 ){
+                                tile_write_masked( fb_ssd1306, tile_idx, mask, bits, fb->raster_op );
+                        }
+                }
+        }
+        
+        return STATUS_OK;
+};
+
+/**
+ * \brief Draw a column major 1bpp bitmap of up to 8 pixel rows to framebuffer
+ *
+ * A bitmap column has the bit layout of a tile. It is written with one masked tile write if \ref y is page aligned, 
+ * otherwise it is shifted into the two tiles it straddles.
+ *
+ * \asserts ( fb            != NULL )
+ * \asserts ( fb->user_data != NULL );
+ * \asserts ( columns       != NULL );
+ * \asserts ( height        <= 8    );
+ */
+static enum status_code framebuffer_ssd1306_blit_columns (
+        struct Framebuffer *fb          //< framebuffer to draw to
+,                 uint32_t  x           //< x position of the upper left corner
+,                 uint32_t  y           //< y position of the upper left corner
+,                 uint32_t  width       //< width  of the bitmap in pixels (number of columns)
+,                 uint32_t  height      //< height of the bitmap in pixels (1..8)
+,            uint8_t const *columns     //< bitmap to draw, one byte per column
+,                 uint32_t  pixel_value //< value to set for the pixels of set bits
+,                     bool  opaque      //< if true, pixels of cleared bits are set to 0x00
+){
+        Assert( fb            != NULL );
+        Assert( fb->user_data != NULL );
+        Assert( columns       != NULL );
+        Assert( height        <= 8    );
+        
+        struct Framebuffer_SSD1306 *fb_ssd1306 = (struct Framebuffer_SSD1306 *)fb->user_data;
+        
+        Assert( fb_ssd1306->tiles );
+        
+        uint32_t const height_max = fb_ssd1306->pages * fb_ssd1306->bits_per_tile;
+        
+        // clip the bitmap to the framebuffer
+        if(( x >= fb_ssd1306->columns )
+        || ( y >= height_max          )
+        ){
+                return STATUS_OK;
+        }
+        if( width  > fb_ssd1306->columns - x ){
+                width  = fb_ssd1306->columns - x;
+        }
+        if( height > height_max - y ){
+                height = height_max - y;
+        }
+        if(( width < 1 ) || ( height < 1 )){
+                return STATUS_OK;
+        }
+        
+        uint32_t const shift      = y & 0x07;                                   // bit of the bitmap's top row in its first tile
+        uint32_t       tile_idx   = ( ( y >> 3 ) * fb_ssd1306->columns ) + x;   // tile of the bitmap's top row
+        uint32_t const rows       = ( 0x1 << height ) - 1;                      // bitmap rows inside the framebuffer
+        uint32_t const rows_mask  = opaque ? rows << shift : 0x00;              // bits written independent of the bitmap
+        
+        // bits 8..15 of a column belong to the tile below, clipping keeps that tile inside the framebuffer
+        for( uint32_t column = 0; column < width; column++, tile_idx++ ){
+                uint32_t const set  = ( columns[ column ] & rows ) << shift;     // set bits of the column at their framebuffer rows
+                uint32_t const mask = rows_mask | set;
+                uint32_t const bits = pixel_value > 0x00 ? set : 0x00;
+                
+                if( mask & 0xFF ){
+                        tile_write_masked( fb_ssd1306, tile_idx, (framebuffer_ssd1306_tile_t)mask, (framebuffer_ssd1306_tile_t)bits, fb->raster_op );
+                }
+                if( mask >> 8 ){
+                        tile_write_masked( fb_ssd1306, tile_idx + fb_ssd1306->columns, (framebuffer_ssd1306_tile_t)( mask >> 8 ), (framebuffer_ssd1306_tile_t)( bits >> 8 ), fb->raster_op );
+                }
+        }
+        
+        return STATUS_OK;
+};
+
+/**
+ * \brief Count the pixels of a horizontal run (not) having a value
+ *
+ * Reads the pixel bits straight from the tiles of the run's page.
+ *
+ * \asserts ( fb            != NULL )
+ * \asserts ( fb->user_data != NULL );
+ * \asserts ( length        != NULL );
+ */
+static enum status_code framebuffer_ssd1306_scan_hspan (
+        struct Framebuffer *fb          //< framebuffer to read from
+,                 uint32_t  x           //< x position of the first pixel of the run
+,                 uint32_t  y           //< y position of the run
+,                 uint32_t  x_end       //< x position of the last pixel the run may include
+,                 uint32_t  pixel_value //< value to compare the pixels with
+,                     bool  equal       //< if true, count pixels having pixel_value, otherwise pixels not having it
+,                 uint32_t *length      //< [out] number of pixels in the run
+){
+        Assert( fb            != NULL );
+        Assert( fb->user_data != NULL );
+        Assert( length        != NULL );
+        
+        struct Framebuffer_SSD1306 *fb_ssd1306 = (struct Framebuffer_SSD1306 *)fb->user_data;
+        
+        Assert( fb_ssd1306->tiles );
+        
+        uint32_t const height_max = fb_ssd1306->pages * fb_ssd1306->bits_per_tile;
+        
+        *length = 0;
+        if(( x >= fb_ssd1306->columns )
+        || ( y >= height_max          )
+        ){
+                return STATUS_OK;
+        }
+        if( x_end >= fb_ssd1306->columns ){
+                x_end = fb_ssd1306->columns - 1;
+        }
+        
+        int32_t                    const  step  = x_end >= x ? 1 : -1;
+        uint32_t                   const  count = x_end >= x ? x_end - x + 1 : x - x_end + 1;
+        framebuffer_ssd1306_tile_t const  bit   = 0x1 << ( y & 0x07 );
+        framebuffer_ssd1306_tile_t const *tile  = &fb_ssd1306->tiles[ ( ( y >> 3 ) * fb_ssd1306->columns ) + x ];
+        
+        if( pixel_value > 0x01 ){
+                // no pixel has this value
+                *length = equal ? 0 : count;
+                return STATUS_OK;
+        }
+        
+        framebuffer_ssd1306_tile_t const bits = ( pixel_value == 0x01 ) == equal ? bit : 0x00; // bit of the pixels counted
+        
+        while(( *length < count ) && ( ( *tile & bit ) == bits )){
+                (*length)++;
+                tile += step;
+        }
+        
+        return STATUS_OK;
+};
+
+/**
+ * \brief Copy a rectangle of pixels inside framebuffer
+ *
+ * Works page by page of the destination. The bits of a destination tile come from at most two tiles of the source column,
+ * shifted by the vertical offset. Whole pages moved by whole pages are copied with memmove(), which moves words.
+ * Pages and columns are walked away from the destination, so no source tile is overwritten before it is read.
+ * framebuffer_copy_rect() hands only rectangles with source and destination inside the framebuffer.
+ *
+ * \asserts ( fb            != NULL )
+ * \asserts ( fb->user_data != NULL );
+ */
+static enum status_code framebuffer_ssd1306_copy_rect (
+        struct Framebuffer *fb          //< framebuffer to copy in
+,                 uint32_t  x_src       //< x position of the upper left corner of the source
+,                 uint32_t  y_src       //< y position of the upper left corner of the source
+,                 uint32_t  width       //< width  of the rectangle in pixels
+,                 uint32_t  height      //< height of the rectangle in pixels
+,                 uint32_t  x_dst       //< x position of the upper left corner of the destination
+,                 uint32_t  y_dst       //< y position of the upper left corner of the destination
+){
+        Assert( fb            != NULL );
+        Assert( fb->user_data != NULL );
+        
+        struct Framebuffer_SSD1306 *fb_ssd1306 = (struct Framebuffer_SSD1306 *)fb->user_data;
+        
+        Assert( fb_ssd1306->tiles );
+        
+        framebuffer_ssd1306_tile_t *const tiles      = fb_ssd1306->tiles;
+        uint32_t                    const columns    = fb_ssd1306->columns;
+        uint32_t                    const pages      = fb_ssd1306->pages;
+        uint32_t                    const y_end      = y_dst + height;
+        uint32_t                    const page_first = y_dst >> 3;
+        uint32_t                    const page_last  = ( y_end - 1 ) >> 3;
+        bool                        const down       = ( y_dst > y_src );       // walk the pages bottom up
+        bool                        const right      = ( x_dst > x_src );       // walk the columns right to left
+        
+        for( uint32_t p = 0; p <= page_last - page_first; p++ ){
+                uint32_t                    page       = down ? page_last - p : page_first + p;
+                framebuffer_ssd1306_tile_t  mask       = page_mask( page, y_dst, y_end );
+                
+                // the source rows of the page start at page * 8 + y_src - y_dst, which is >= -7, so count them from -8
+                uint32_t                    row_biased = ( page << 3 ) + y_src + 8 - y_dst;
+                uint32_t                    shift      = row_biased & 0x07;
+                int32_t                     page_src   = (int32_t)( row_biased >> 3 ) - 1;
+                framebuffer_ssd1306_tile_t *tile_dst   = &tiles[ ( page * columns ) + x_dst ];
+                
+                if(( shift == 0 ) && ( mask == 0xFF ) && ( fb->raster_op == FRAMEBUFFER_RASTER_OP_SET )){
+                        framebuffer_ssd1306_tile_t const *tile_src = &tiles[ ( page_src * columns ) + x_src ];
+                        
+                        // mark the tiles, that are going to change, before the move changes the source
+                        for( uint32_t column = 0; column < width; column++ ){
+                                if( tile_dst[ column ] != tile_src[ column ] ){
+                                        tile_mark_dirty( fb_ssd1306, ( page * columns ) + x_dst + column );
+                                }
+                        }
+                        memmove( tile_dst, tile_src, width );
+                        continue;
+                }
+                
+                // source pages above or below the framebuffer only hold bits masked out
+                framebuffer_ssd1306_tile_t const *tile_lo = page_src     >= 0              ? &tiles[ ( page_src       * columns ) + x_src ] : NULL;
+                framebuffer_ssd1306_tile_t const *tile_hi = page_src + 1 <  (int32_t)pages ? &tiles[ ( ( page_src + 1 ) * columns ) + x_src ] : NULL;
+                
+                for( uint32_t c = 0; c < width; c++ ){
+                        uint32_t column = right ? width - 1 - c : c;
+                        uint32_t window = ( tile_lo ? tile_lo[ column ] : 0x00 ) | ( tile_hi ? tile_hi[ column ] << 8 : 0x00 );
+                        
+                        tile_write_masked( fb_ssd1306, ( page * columns ) + x_dst + column, mask, 
+                                           (framebuffer_ssd1306_tile_t)( window >> shift ), fb->raster_op );
+                }
+        }
+        
+        return STATUS_OK;
+};
+
+/**
+ * \brief Get the mask of the bits of a dirty tiles map word, that lie in the tiles [\ref tile_start, \ref tile_end)
+ */
+static inline framebuffer_ssd1306_dirty_t dirty_word_mask (
+  uint32_t const word_idx       //< index of the dirty tiles map word
+, uint32_t const tile_start     //< first tile
+, uint32_t const tile_end       //< tile behind the last tile
+){
+        uint32_t word_first = word_idx << 5;
+        uint32_t bit_lo     = tile_start > word_first      ? tile_start - word_first : 0;
+        uint32_t bit_hi     = tile_end   < word_first + 32 ? tile_end   - word_first : 32;
+        
+        framebuffer_ssd1306_dirty_t mask = ~(framebuffer_ssd1306_dirty_t)0x0;
+        
+        mask  = bit_hi < 32 ? mask >> ( 32 - bit_hi ) : mask;
+        mask &= ~( ( (framebuffer_ssd1306_dirty_t)0x1 << bit_lo ) - 1 );
+        
+        return mask;
+};
+
+/**
+ * \brief Set up the generic part of a SSD1306 framebuffer
+ *
+ * \asserts fb != NULL
+ */
+static void framebuffer_ssd1306_setup (
+  struct Framebuffer *const fb          //< framebuffer to set up
+,           uint32_t  const width       //< framebuffer width  in pixel
+,           uint32_t  const height      //< framebuffer height in pixel
+){
+        Assert( fb != NULL );
+        
+        fb->width        = width ;
+        fb->height       = height;
+        fb->clear        = &framebuffer_ssd1306_clear       ;
+        fb->destroy      = &framebuffer_ssd1306_destroy     ;
+        fb->get_pixel    = &framebuffer_ssd1306_get_pixel   ;
+        fb->set_pixel    = &framebuffer_ssd1306_set_pixel   ;
+        fb->fill_hspan   = &framebuffer_ssd1306_fill_hspan  ;
+        fb->fill_vspan   = &framebuffer_ssd1306_fill_vspan  ;
+        fb->fill_rect    = &framebuffer_ssd1306_fill_rect   ;
+        fb->blit         = &framebuffer_ssd1306_blit        ;
+        fb->blit_columns = &framebuffer_ssd1306_blit_columns;
+        fb->scan_hspan   = &framebuffer_ssd1306_scan_hspan  ;
+        fb->copy_rect    = &framebuffer_ssd1306_copy_rect   ;
+        fb->raster_op    = FRAMEBUFFER_RASTER_OP_SET;
+        fb->user_data    = NULL;
+};
+
 // ===========================================================================
 //  public
 // ===========================================================================
@@ -292,18 +762,14 @@ struct Framebuffer *framebuffer_SSD1306_create (
         if( fb == NULL ){
                 goto done;
         }                
-        fb->width     = width ;
-        fb->height    = height;
-        fb->clear     = &framebuffer_ssd1306_clear    ;
-        fb->destroy   = &framebuffer_ssd1306_destroy  ;
-        fb->get_pixel = &framebuffer_ssd1306_get_pixel;
-        fb->set_pixel = &framebuffer_ssd1306_set_pixel;
+        framebuffer_ssd1306_setup( fb, width, height );
         
         struct Framebuffer_SSD1306 *fb_SSD1306;
         
-        fb_SSD1306 = (struct Framebuffer_SSD1306 *) malloc( sizeof ( struct Framebuffer_SSD1306 ) );    // create a new Framebuffer_SSD1306 instance
+        fb_SSD1306 = (struct Framebuffer_SSD1306 *) calloc( 1, sizeof ( struct Framebuffer_SSD1306 ) ); // create a new Framebuffer_SSD1306 instance
         if ( fb_SSD1306 == NULL ){
                 framebuffer_ssd1306_destroy( fb );
+                fb = NULL;
                 goto done;
         }
         fb->user_data = fb_SSD1306;
@@ -311,9 +777,373 @@ struct Framebuffer *framebuffer_SSD1306_create (
         status = framebuffer_ssd1306_init( fb_SSD1306, width, height );
         if( status != STATUS_OK ){
                 framebuffer_ssd1306_destroy( fb );
+                fb = NULL;
                 goto done;
         }
         
 done:
         return fb;
 };
+
+/**
+ * \brief Initialize a framebuffer instance for a SSD1306 OLED controlled display in caller provided storage
+ * 
+ * \asserts height      > 0
+ * \asserts width       > 0 
+ * \asserts fb          != NULL
+ * \asserts fb_ssd1306  != NULL
+ * \asserts tiles       != NULL
+ * \asserts tiles_dirty != NULL
+ */
+enum status_code framebuffer_SSD1306_init_static ( 
+  struct Framebuffer          *const fb           //< caller owned generic framebuffer instance
+, struct Framebuffer_SSD1306  *const fb_ssd1306   //< caller owned SSD1306 framebuffer instance
+, framebuffer_ssd1306_tile_t  *const tiles        //< caller owned tiles, FRAMEBUFFER_SSD1306_TILES( width, height ) tiles, word aligned
+, framebuffer_ssd1306_dirty_t *const tiles_dirty  //< caller owned dirty tiles index, FRAMEBUFFER_SSD1306_TILES_DIRTY_WORDS( width, height ) words
+, framebuffer_ssd1306_tile_t  *const tiles_shadow //< caller owned shadow, like \ref tiles (NULL: no shadow)
+,                    uint32_t  const width        //< framebuffer width  in pixel
+,                    uint32_t  const height       //< framebuffer height in pixel
+){
+        Assert( height      >  0    );
+        Assert( width       >  0    );
+        Assert( fb          != NULL );
+        Assert( fb_ssd1306  != NULL );
+        Assert( tiles       != NULL );
+        Assert( tiles_dirty != NULL );
+        
+        if(( ( (uintptr_t)tiles        & ( sizeof( uint32_t ) - 1 ) ) != 0 )        // tiles are compared in 32 bit words
+        || ( ( (uintptr_t)tiles_shadow & ( sizeof( uint32_t ) - 1 ) ) != 0 )
+        ){
+                return STATUS_ERR_INVALID_ARG;
+        }
+        
+        framebuffer_ssd1306_setup( fb, width, height );
+        fb->user_data = fb_ssd1306;
+        
+        fb_ssd1306->storage_static = true;
+        fb_ssd1306->tiles          = tiles;
+        fb_ssd1306->tiles_dirty    = tiles_dirty;
+        fb_ssd1306->tiles_shadow   = tiles_shadow;
+        
+        enum status_code status = framebuffer_ssd1306_init( fb_ssd1306, width, height );
+        
+        if( tiles_shadow != NULL ){
+                framebuffer_ssd1306_shadow_enable( fb, true );                  // what's on the display is unknown
+        }
+        
+        return status;
+};
+
+/**
+ * \brief Mark a range of tiles as dirty.
+ *
+ * \asserts fb_ssd1306              != NULL
+ * \asserts fb_ssd1306->tiles_dirty != NULL
+ */
+void framebuffer_ssd1306_mark_dirty_range (
+  struct Framebuffer_SSD1306 *const fb_ssd1306  //< SSD1306 framebuffer the tiles are in
+,                   uint32_t  const tile_idx    //< index of the first tile of the range
+,                   uint32_t  const length      //< number of tiles in the range
+){
+        Assert( fb_ssd1306              != NULL );
+        Assert( fb_ssd1306->tiles_dirty != NULL );
+        
+        if(( tile_idx >= fb_ssd1306->bytes )
+        || ( length   <  1                 )
+        ){
+                return;
+        }
+        
+        uint32_t tile_end = ( length > fb_ssd1306->bytes - tile_idx ) ? fb_ssd1306->bytes : tile_idx + length;
+        
+        for( uint32_t word_idx = tile_idx >> 5; word_idx <= ( tile_end - 1 ) >> 5; word_idx++ ){
+                framebuffer_ssd1306_dirty_t mask = dirty_word_mask( word_idx, tile_idx, tile_end ) & ~fb_ssd1306->tiles_dirty[ word_idx ]; // tiles getting dirty
+                
+                fb_ssd1306->tiles_dirty[ word_idx ] |= mask;
+                fb_ssd1306->tiles_dirty_count       += __builtin_popcount( mask );
+        }
+};
+
+/**
+ * \brief Mark a range of tiles as clean.
+ *
+ * \asserts fb_ssd1306              != NULL
+ * \asserts fb_ssd1306->tiles_dirty != NULL
+ */
+void framebuffer_ssd1306_mark_clean_range (
+  struct Framebuffer_SSD1306 *const fb_ssd1306  //< SSD1306 framebuffer the tiles are in
+,                   uint32_t  const tile_idx    //< index of the first tile of the range
+,                   uint32_t  const length      //< number of tiles in the range
+){
+        Assert( fb_ssd1306              != NULL );
+        Assert( fb_ssd1306->tiles_dirty != NULL );
+        
+        if(( tile_idx >= fb_ssd1306->bytes )
+        || ( length   <  1                 )
+        ){
+                return;
+        }
+        
+        uint32_t tile_end = ( length > fb_ssd1306->bytes - tile_idx ) ? fb_ssd1306->bytes : tile_idx + length;
+        
+        for( uint32_t word_idx = tile_idx >> 5; word_idx <= ( tile_end - 1 ) >> 5; word_idx++ ){
+                framebuffer_ssd1306_dirty_t mask = dirty_word_mask( word_idx, tile_idx, tile_end ) & fb_ssd1306->tiles_dirty[ word_idx ]; // tiles getting clean
+                
+                fb_ssd1306->tiles_dirty[ word_idx ] &= ~mask;
+                fb_ssd1306->tiles_dirty_count       -= __builtin_popcount( mask );
+        }
+};
+
+/**
+ * \brief Switch the shadow buffer of a SSD1306 framebuffer on or off.
+ *
+ * \asserts fb            != NULL
+ * \asserts fb->user_data != NULL
+ */
+enum status_code framebuffer_ssd1306_shadow_enable (
+  struct Framebuffer *const fb          //< SSD1306 framebuffer to switch the shadow of
+,               bool  const enable      //< true: allocate the shadow; false: release it
+){
+        Assert( fb            != NULL );
+        Assert( fb->user_data != NULL );
+        
+        struct Framebuffer_SSD1306 *fb_ssd1306 = (struct Framebuffer_SSD1306 *)fb->user_data;
+        
+        if( fb_ssd1306->storage_static ){
+                if( fb_ssd1306->tiles_shadow == NULL ){
+                        return enable ? STATUS_ERR_NO_MEMORY : STATUS_OK;       // no shadow storage provided
+                }
+                if( !enable ){
+                        return STATUS_ERR_DENIED;                               // can't give back caller owned memory
+                }
+        }
+        
+        if( !enable ){
+                free( fb_ssd1306->tiles_shadow );
+                fb_ssd1306->tiles_shadow = NULL;
+                return STATUS_OK;
+        }
+        
+        if( fb_ssd1306->tiles_shadow == NULL ){
+                fb_ssd1306->tiles_shadow = (framebuffer_ssd1306_tile_t *)malloc( fb_ssd1306->bytes );
+                if( fb_ssd1306->tiles_shadow == NULL ){
+                        return STATUS_ERR_NO_MEMORY;
+                }
+        }
+        
+        // what's on the display is unknown, make sure no dirty tile equals its shadow
+        for( uint32_t idx = 0; idx < fb_ssd1306->bytes; idx++ ){
+                fb_ssd1306->tiles_shadow[idx] = ~fb_ssd1306->tiles[idx];
+        }
+        
+        return STATUS_OK;
+};
+
+/**
+ * \brief Mark dirty tiles, that are equal to their shadow, as clean.
+ *
+ * \asserts fb_ssd1306 != NULL
+ */
+uint32_t framebuffer_ssd1306_shadow_filter (
+  struct Framebuffer_SSD1306 *const fb_ssd1306  //< SSD1306 framebuffer to filter the dirty tiles of
+){
+        Assert( fb_ssd1306 != NULL );
+        
+        if(( fb_ssd1306->tiles_shadow      == NULL )
+        || ( fb_ssd1306->tiles_dirty_count <  1    )
+        ){
+                return 0;
+        }
+        
+        uint32_t tiles_cleaned = 0;
+        
+        for( uint32_t word_idx = 0; word_idx < fb_ssd1306->tiles_dirty_words; word_idx++ ){
+                framebuffer_ssd1306_dirty_t tiles_dirty = fb_ssd1306->tiles_dirty[ word_idx ];
+                framebuffer_ssd1306_dirty_t tiles_equal = 0x0;
+                
+                if( tiles_dirty == 0x0 ){
+                        continue;                                       // 32 clean tiles
+                }
+                
+                // 4 tiles per compare, memcmp() of a word compiles to a single 32 bit compare, without breaking aliasing
+                for( uint32_t quad = 0; quad < FRAMEBUFFER_SSD1306_DIRTY_BITS; quad += 4 ){
+                        uint32_t tile_idx = ( word_idx << 5 ) + quad;
+                        
+                        if(( ( tiles_dirty >> quad ) & 0xF ) == 0x0 ){
+                                continue;                               // 4 clean tiles
+                        }
+                        if(( tile_idx + 4 <= fb_ssd1306->bytes )
+                        && ( memcmp( &fb_ssd1306->tiles[ tile_idx ], &fb_ssd1306->tiles_shadow[ tile_idx ], 4 ) == 0 )
+                        ){
+                                tiles_equal |= (framebuffer_ssd1306_dirty_t)0xF << quad;
+                                continue;
+                        }
+                        for( uint32_t bit = quad; ( bit < quad + 4 ) && ( tile_idx < fb_ssd1306->bytes ); bit++, tile_idx++ ){
+                                if( fb_ssd1306->tiles[ tile_idx ] == fb_ssd1306->tiles_shadow[ tile_idx ] ){
+                                        tiles_equal |= (framebuffer_ssd1306_dirty_t)0x1 << bit;
+                                }
+                        }
+                }
+                
+                tiles_equal                         &= tiles_dirty;
+                fb_ssd1306->tiles_dirty[ word_idx ] &= ~tiles_equal;
+                tiles_cleaned                       += __builtin_popcount( tiles_equal );
+        }
+        
+        fb_ssd1306->tiles_dirty_count -= tiles_cleaned;
+        
+        return tiles_cleaned;
+};
+
+/**
+ * \brief Remember tiles as sent to the display in the shadow.
+ *
+ * \asserts fb_ssd1306 != NULL
+ * \asserts tiles_sent != NULL
+ */
+void framebuffer_ssd1306_shadow_update (
+  struct Framebuffer_SSD1306       *const fb_ssd1306  //< SSD1306 framebuffer the tiles are in
+,                   uint32_t        const tile_idx    //< index of the first tile sent
+, framebuffer_ssd1306_tile_t const *const tiles_sent  //< content of the tiles sent
+,                   uint32_t        const length      //< number of tiles sent
+){
+        Assert( fb_ssd1306 != NULL );
+        Assert( tiles_sent != NULL );
+        
+        if(( fb_ssd1306->tiles_shadow == NULL              )
+        || ( tile_idx                 >= fb_ssd1306->bytes )
+        ){
+                return;
+        }
+        
+        memcpy( (void *)&fb_ssd1306->tiles_shadow[ tile_idx ], (void const *)tiles_sent, 
+                ( length > fb_ssd1306->bytes - tile_idx ) ? fb_ssd1306->bytes - tile_idx : length );
+};
+
+/**
+ * \brief Find the next tile in a dirty tiles map, that is dirty (or clean).
+ *
+ * \asserts tiles_dirty != NULL
+ */
+uint32_t framebuffer_ssd1306_dirty_find (
+  framebuffer_ssd1306_dirty_t const *const tiles_dirty  //< dirty tiles map to search
+,                         uint32_t  const tiles         //< number of tiles in the map
+,                         uint32_t  const tile_idx      //< tile to start the search at
+,                             bool  const dirty         //< true: find a dirty tile; false: find a clean tile
+){
+        Assert( tiles_dirty != NULL );
+        
+        framebuffer_ssd1306_dirty_t const invert = dirty ? 0x0 : ~(framebuffer_ssd1306_dirty_t)0x0; // search for set bits only
+        
+        if( tile_idx >= tiles ){
+                return tiles;
+        }
+        
+        uint32_t                    word_idx = tile_idx >> 5;
+        framebuffer_ssd1306_dirty_t word     = ( tiles_dirty[ word_idx ] ^ invert ) & ( ~(framebuffer_ssd1306_dirty_t)0x0 << ( tile_idx & 0x1F ) ); // ignore the tiles in front of tile_idx
+        
+        while( word == 0x0 ){                                           // skip 32 tiles at once
+                word_idx++;
+                if( ( word_idx << 5 ) >= tiles ){
+                        return tiles;
+                }
+                word = tiles_dirty[ word_idx ] ^ invert;
+        }
+        
+        uint32_t result = ( word_idx << 5 ) + __builtin_ctz( word );
+        
+        return result < tiles ? result : tiles;                         // clean search may hit the bits behind the last tile
+};
+
+/**
+ * \brief Mark a range of tiles to be sent with the next update, whatever the shadow says.
+ *
+ * \asserts fb_ssd1306 != NULL
+ */
+void framebuffer_ssd1306_resend_range (
+  struct Framebuffer_SSD1306 *const fb_ssd1306  //< SSD1306 framebuffer the tiles are in
+,                   uint32_t  const tile_idx    //< index of the first tile of the range
+,                   uint32_t  const length      //< number of tiles in the range
+){
+        Assert( fb_ssd1306 != NULL );
+        
+        if( tile_idx >= fb_ssd1306->bytes ){
+                return;
+        }
+        
+        uint32_t tile_end = ( length > fb_ssd1306->bytes - tile_idx ) ? fb_ssd1306->bytes : tile_idx + length;
+        
+        if( fb_ssd1306->tiles_shadow != NULL ){
+                // what's on the display is unknown, make sure the tiles don't equal their shadow
+                for( uint32_t idx = tile_idx; idx < tile_end; idx++ ){
+                        fb_ssd1306->tiles_shadow[idx] = ~fb_ssd1306->tiles[idx];
+                }
+        }
+        framebuffer_ssd1306_mark_dirty_range( fb_ssd1306, tile_idx, tile_end - tile_idx );
+};
+
+/**
+ * \brief Move the content of a SSD1306 framebuffer up or down by whole pages, as the display does when its start line moves.
+ *
+ * \asserts fb            != NULL
+ * \asserts fb->user_data != NULL
+ */
+enum status_code framebuffer_ssd1306_scroll_pages (
+  struct Framebuffer *const fb          //< SSD1306 framebuffer to scroll
+,            int32_t  const pages       //< pages to move the content up (< 0: down)
+){
+        Assert( fb            != NULL );
+        Assert( fb->user_data != NULL );
+        
+        struct Framebuffer_SSD1306 *fb_ssd1306 = (struct Framebuffer_SSD1306 *)fb->user_data;
+        
+        Assert( fb_ssd1306->tiles       != NULL );
+        Assert( fb_ssd1306->tiles_dirty != NULL );
+        
+        if( fb_ssd1306->columns % FRAMEBUFFER_SSD1306_DIRTY_BITS != 0 ){
+                return STATUS_ERR_INVALID_ARG;          // the dirty state of a page has to be whole dirty tiles map words
+        }
+        if( pages == 0 ){
+                return STATUS_OK;
+        }
+        
+        uint32_t const page_count = (uint32_t)( pages < 0 ? -pages : pages );
+        
+        if( page_count >= fb_ssd1306->pages ){
+                memset( (void *)fb_ssd1306->tiles, 0x00, fb_ssd1306->bytes );
+                framebuffer_ssd1306_resend_range( fb_ssd1306, 0, fb_ssd1306->bytes );
+                return STATUS_OK;
+        }
+        
+        uint32_t const words_per_page = fb_ssd1306->columns / FRAMEBUFFER_SSD1306_DIRTY_BITS;
+        uint32_t const tiles_moved    = ( fb_ssd1306->pages - page_count ) * fb_ssd1306->columns;
+        uint32_t const tiles_dropped  = page_count * fb_ssd1306->columns;
+        uint32_t const words_moved    = ( fb_ssd1306->pages - page_count ) * words_per_page;
+        uint32_t const words_dropped  = page_count * words_per_page;
+        
+        // the part of the content moved, the part dropped and the part uncovered
+        uint32_t const tile_from      = pages > 0 ? tiles_dropped : 0;
+        uint32_t const tile_to        = pages > 0 ? 0             : tiles_dropped;
+        uint32_t const tile_uncovered = pages > 0 ? tiles_moved   : 0;
+        uint32_t const word_from      = pages > 0 ? words_dropped : 0;
+        uint32_t const word_to        = pages > 0 ? 0             : words_dropped;
+        uint32_t const word_dropped   = pages > 0 ? 0             : words_moved;
+        
+        // the tiles moved are on the display already, they keep their dirty state and shadow
+        memmove( (void *)&fb_ssd1306->tiles[ tile_to ], (void const *)&fb_ssd1306->tiles[ tile_from ], tiles_moved );
+        if( fb_ssd1306->tiles_shadow != NULL ){
+                memmove( (void *)&fb_ssd1306->tiles_shadow[ tile_to ], (void const *)&fb_ssd1306->tiles_shadow[ tile_from ], tiles_moved );
+        }
+        for( uint32_t idx = 0; idx < words_dropped; idx++ ){
+                fb_ssd1306->tiles_dirty_count -= __builtin_popcount( fb_ssd1306->tiles_dirty[ word_dropped + idx ] );
+        }
+        memmove( (void *)&fb_ssd1306->tiles_dirty[ word_to ], (void const *)&fb_ssd1306->tiles_dirty[ word_from ], 
+                 words_moved * sizeof( framebuffer_ssd1306_dirty_t ) );
+        memset ( (void *)&fb_ssd1306->tiles_dirty[ pages > 0 ? words_moved : 0 ], 0x00, words_dropped * sizeof( framebuffer_ssd1306_dirty_t ) );
+        
+        // the pages uncovered show what was in the display RAM, clear them
+        memset( (void *)&fb_ssd1306->tiles[ tile_uncovered ], 0x00, tiles_dropped );
+        framebuffer_ssd1306_resend_range( fb_ssd1306, tile_uncovered, tiles_dropped );
+        
+        return STATUS_OK;
+};
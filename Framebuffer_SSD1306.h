@@ -37,6 +37,14 @@
 
 typedef uint8_t framebuffer_ssd1306_tile_t; //< SSD1306 framebuffer is formed by bit-blocks -> a.k.a. "tiles", 8 pixels (=bits) per tile
 
+typedef uint32_t framebuffer_ssd1306_dirty_t; //< word of the dirty tiles map, 1 bit per tile
+
+#define FRAMEBUFFER_SSD1306_DIRTY_BITS          32      //< number of tiles per dirty tiles map word
+#define FRAMEBUFFER_SSD1306_DIRTY_WORDS(tiles)  ( ( (tiles) + FRAMEBUFFER_SSD1306_DIRTY_BITS - 1 ) / FRAMEBUFFER_SSD1306_DIRTY_BITS ) //< number of dirty tiles map words for a number of tiles
+
+#define FRAMEBUFFER_SSD1306_TILES(width, height)                ( (width) * ( (height) >> 3 ) )                                         //< number of tiles of a framebuffer
+#define FRAMEBUFFER_SSD1306_TILES_DIRTY_WORDS(width, height)    FRAMEBUFFER_SSD1306_DIRTY_WORDS( FRAMEBUFFER_SSD1306_TILES( width, height ) ) //< number of dirty tiles map words of a framebuffer
+
 /**
  * \brief Internal Data structure for managing a SSD1306 framebuffer.
  *
@@ -55,24 +63,21 @@ typedef uint8_t framebuffer_ssd1306_tile_t; //< SSD1306 framebuffer is formed by
  * \ref tiles_dirty
  *  In one bit per tile, we remember the tiles that have been changed in the framebuffer 
  *  but not send to the display yet (are dirty), to later be able to optimize the screen update.
+ *  Tile n is bit (n % 32) of word (n / 32), so clean regions can be skipped a word at a time 
+ *  (see \ref framebuffer_ssd1306_dirty_find()). Bits behind the last tile are always 0.
+ *
+ * \ref tiles_shadow
+ *  Optional copy of the tiles as they have last been sent to the display (see \ref framebuffer_ssd1306_shadow_enable()).
+ *  A tile that is dirty, but equal to its shadow, has been changed and changed back before the update, 
+ *  so the display driver doesn't have to send it (see \ref framebuffer_ssd1306_shadow_filter()).
  *
  * \ref tiles_dirty_count
- *  Updating a tile in random access mode requires:
- *  - sending the page   start/end address command (5 bytes on the wire: i2c address + 3 byte command + getting 1 byte acknowledge back)
- *  - sending the column start/end address command (5 bytes on the wire: i2c address + 3 byte command + getting 1 byte acknowledge back)
- *  - sending the data                             (4 bytes on the wire: i2c address + 2 byte command + getting 1 byte acknowledge back)
- *  - That's 14 bytes in total.
- *  .
- *  Sending the whole framebuffer of e.g. the FeatherWing_OLED (512 tiles) over requires:
- *  - sending the page   start/end address command (  1 x 5 bytes on the wire: i2c address + 3 byte command + getting 1 byte acknowledge back)
- *  - sending the column start/end address command (  1 x 5 bytes on the wire: i2c address + 3 byte command + getting 1 byte acknowledge back)
- *  - sending the data                             (512 x 4 bytes on the wire: i2c address + 2 byte command + getting 1 byte acknowledge back)
- *  - That's 2058 bytes in total.
- *  .
- *  So for the FeatherWing_OLED it is faster to send the whole framebuffer over if more than 147 tiles have to be updated (are dirty).
- *  This threshold depends on the number of tiles the display area is made of.
- *  .
- *  To make the decision which way to go fast and effortless we count the number of tiles in \ref tiles_dirty_count.
+ *  The number of dirty tiles allows the display driver to find out fast and effortless, if there is anything to update at all.
+ *  How the dirty tiles are best sent to the display (tile runs to address, clean tiles to send along) is up to the display driver,
+ *  since it depends on the bus and protocol used (see \ref ssd1306_update_plan()).
+ *
+ * \ref storage_static
+ *  Set, if the memory of the framebuffer is owned by the caller (see \ref framebuffer_SSD1306_init_static()).
  */
 struct Framebuffer_SSD1306 {
                           uint16_t  columns;            //< number of columns (tiles side-by-side in one page)
@@ -80,10 +85,152 @@ struct Framebuffer_SSD1306 {
                           uint32_t  bytes;              //< size of this framebuffer in bytes
                            uint8_t  bits_per_tile;      //< number of bits that make up a tile
         framebuffer_ssd1306_tile_t *tiles;              //< this is the pixmap that we draw to and send to the display eventually
-                           uint8_t *tiles_dirty;        //< 1 bit per tile,  set if tile was changed
+       framebuffer_ssd1306_dirty_t *tiles_dirty;        //< 1 bit per tile,  set if tile was changed
+                          uint16_t  tiles_dirty_words;  //< number of words of tiles_dirty
                           uint32_t  tiles_dirty_count;  //< number of dirty tiles
+        framebuffer_ssd1306_tile_t *tiles_shadow;       //< tiles last sent to the display (NULL: no shadow)
+                              bool  storage_static;     //< memory provided by the caller, destroy() doesn't release it
 };
 
 struct Framebuffer *framebuffer_SSD1306_create( uint32_t width, uint32_t height ); // create a new framebuffer instance for a SSD1306 OLED controlled display
 
+/**
+ * \brief Initialize a framebuffer instance for a SSD1306 OLED controlled display in caller provided storage.
+ *
+ * No heap is used, so all the memory of the framebuffer can live in .bss and shows up in the map file.
+ * The sizes of the buffers follow from the display geometry at compile time, e.g. for 128x32:
+ * \code
+ *  static struct Framebuffer          fb;
+ *  static struct Framebuffer_SSD1306  fb_ssd1306;
+ *  static framebuffer_ssd1306_tile_t  tiles      [FRAMEBUFFER_SSD1306_TILES            ( 128, 32 )] COMPILER_WORD_ALIGNED;
+ *  static framebuffer_ssd1306_dirty_t tiles_dirty[FRAMEBUFFER_SSD1306_TILES_DIRTY_WORDS( 128, 32 )];
+ *
+ *  status = framebuffer_SSD1306_init_static( &fb, &fb_ssd1306, tiles, tiles_dirty, NULL, 128, 32 );
+ * \endcode
+ * destroy() is a no-op for such an instance, the shadow can't be switched off.
+ *
+ * \return Status of operation.
+ * \retval STATUS_OK                    If the framebuffer was initialized
+ * \retval STATUS_ERR_INVALID_ARG       If \ref tiles or \ref tiles_shadow are not word aligned
+ */
+enum status_code framebuffer_SSD1306_init_static ( 
+  struct Framebuffer          *const fb           //< caller owned generic framebuffer instance
+, struct Framebuffer_SSD1306  *const fb_ssd1306   //< caller owned SSD1306 framebuffer instance
+, framebuffer_ssd1306_tile_t  *const tiles        //< caller owned tiles, FRAMEBUFFER_SSD1306_TILES( width, height ) tiles, word aligned
+, framebuffer_ssd1306_dirty_t *const tiles_dirty  //< caller owned dirty tiles index, FRAMEBUFFER_SSD1306_TILES_DIRTY_WORDS( width, height ) words
+, framebuffer_ssd1306_tile_t  *const tiles_shadow //< caller owned shadow, like \ref tiles (NULL: no shadow)
+,                    uint32_t  const width        //< framebuffer width  in pixel
+,                    uint32_t  const height       //< framebuffer height in pixel
+);
+
+/**
+ * \brief Mark a range of tiles as dirty, e.g. after writing a span of tiles directly.
+ *
+ * The range is clipped to the framebuffer, \ref tiles_dirty_count is kept up to date.
+ */
+void framebuffer_ssd1306_mark_dirty_range (
+  struct Framebuffer_SSD1306 *const fb_ssd1306  //< SSD1306 framebuffer the tiles are in
+,                   uint32_t  const tile_idx    //< index of the first tile of the range
+,                   uint32_t  const length      //< number of tiles in the range
+);
+
+/**
+ * \brief Mark a range of tiles as clean, e.g. after sending them to the display.
+ *
+ * The range is clipped to the framebuffer, \ref tiles_dirty_count is kept up to date.
+ */
+void framebuffer_ssd1306_mark_clean_range (
+  struct Framebuffer_SSD1306 *const fb_ssd1306  //< SSD1306 framebuffer the tiles are in
+,                   uint32_t  const tile_idx    //< index of the first tile of the range
+,                   uint32_t  const length      //< number of tiles in the range
+);
+
+/**
+ * \brief Switch the shadow buffer of a SSD1306 framebuffer on or off.
+ *
+ * The shadow doubles the RAM used for the pixels (e.g. 1 KB more for 128x64), 
+ * but keeps tiles, that have been redrawn with the same content, off the bus.
+ * Switched on, the shadow starts out as the inverse of the tiles, so every dirty tile is sent once.
+ *
+ * A framebuffer in caller provided storage only has the shadow passed to \ref framebuffer_SSD1306_init_static().
+ *
+ * \return Status of operation.
+ * \retval STATUS_OK                    If the shadow was switched
+ * \retval STATUS_ERR_NO_MEMORY         If the shadow could not be allocated
+ * \retval STATUS_ERR_DENIED            If the shadow is caller owned and can't be switched off
+ */
+enum status_code framebuffer_ssd1306_shadow_enable (
+  struct Framebuffer *const fb          //< SSD1306 framebuffer to switch the shadow of
+,               bool  const enable      //< true: allocate the shadow; false: release it
+);
+
+/**
+ * \brief Mark dirty tiles, that are equal to their shadow, as clean.
+ *
+ * Compares 4 tiles at once with 32 bit word compares. Does nothing, if there is no shadow.
+ * Display drivers call this at the start of an update.
+ *
+ * \return Number of tiles marked clean.
+ */
+uint32_t framebuffer_ssd1306_shadow_filter (
+  struct Framebuffer_SSD1306 *const fb_ssd1306  //< SSD1306 framebuffer to filter the dirty tiles of
+);
+
+/**
+ * \brief Remember tiles as sent to the display in the shadow.
+ *
+ * Display drivers call this once the tiles made it to the display.
+ * \ref tiles_sent is what was actually sent, which may differ from the tiles, 
+ * if they have been drawn to in the meantime. Does nothing, if there is no shadow.
+ */
+void framebuffer_ssd1306_shadow_update (
+  struct Framebuffer_SSD1306       *const fb_ssd1306  //< SSD1306 framebuffer the tiles are in
+,                   uint32_t        const tile_idx    //< index of the first tile sent
+, framebuffer_ssd1306_tile_t const *const tiles_sent  //< content of the tiles sent
+,                   uint32_t        const length      //< number of tiles sent
+);
+
+/**
+ * \brief Find the next tile in a dirty tiles map, that is dirty (or clean).
+ *
+ * Skips words of the opposite state at once and uses count-trailing-zeros inside a word.
+ * Works on any map laid out like \ref tiles_dirty, e.g. a snapshot of it.
+ *
+ * \return Index of the first tile at or behind \ref tile_idx with the state \ref dirty, \ref tiles if there is none.
+ */
+uint32_t framebuffer_ssd1306_dirty_find (
+  framebuffer_ssd1306_dirty_t const *const tiles_dirty  //< dirty tiles map to search
+,                         uint32_t  const tiles         //< number of tiles in the map
+,                         uint32_t  const tile_idx      //< tile to start the search at
+,                             bool  const dirty         //< true: find a dirty tile; false: find a clean tile
+);
+
+/**
+ * \brief Mark a range of tiles to be sent with the next update, whatever the shadow says.
+ *
+ * For tiles, whose content on the display is unknown, e.g. after the display RAM has been scrolled by the controller.
+ * The range is clipped to the framebuffer.
+ */
+void framebuffer_ssd1306_resend_range (
+  struct Framebuffer_SSD1306 *const fb_ssd1306  //< SSD1306 framebuffer the tiles are in
+,                   uint32_t  const tile_idx    //< index of the first tile of the range
+,                   uint32_t  const length      //< number of tiles in the range
+);
+
+/**
+ * \brief Move the content of a SSD1306 framebuffer up or down by whole pages, as the display does when its start line moves.
+ *
+ * This keeps the framebuffer in sync with a display scrolled in hardware (see \ref ssd1306_scroll_pages()).
+ * The tiles moved keep their dirty state, since the display moved them too.
+ * The pages uncovered are cleared and sent with the next update. Content moved out is dropped.
+ *
+ * \return Status of operation.
+ * \retval STATUS_OK                    If the content was moved
+ * \retval STATUS_ERR_INVALID_ARG       If the framebuffer's width is not a multiple of \ref FRAMEBUFFER_SSD1306_DIRTY_BITS
+ */
+enum status_code framebuffer_ssd1306_scroll_pages (
+  struct Framebuffer *const fb          //< SSD1306 framebuffer to scroll
+,            int32_t  const pages       //< pages to move the content up (< 0: down)
+);
+
 #endif // FRAMEBUFFER_SSD1306_H
\ No newline at end of file
@@ -0,0 +1,964 @@
+/**     \file   Framebuffer_Wall.c
+
+        \brief  Implementation of a framebuffer spanning several SSD1306 controlled panels
+ 
+        \license 
+                MIT: The MIT License (https://opensource.org/licenses/MIT)
+                .
+                Permission is hereby granted, free of charge, to any person obtaining a copy of this software 
+                and associated documentation files (the "Software"), to deal in the Software without restriction, 
+                including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+                and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, 
+                subject to the following conditions:
+                .
+                The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+                .
+                THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+                INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. 
+                IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+                WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR 
+                THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ 
+        \copyright
+                DIT: 2026; Drechsler Information Technologies; www.drechsler-it.de
+ 
+        \authors
+                jrgdre: Joerg Drechsler; DIT
+ 
+        \versions
+                1.0.0: 2026-10-17 jrgdre initial release
+
+ */
+#include <string.h>                     // memset
+#include "Framebuffer_Wall.h"           // wall framebuffer interface
+#include "Framebuffer_SSD1306.h"        // the panels have SSD1306 framebuffers
+
+// ===========================================================================
+//  private
+// ===========================================================================
+
+/**
+ * \brief Number of columns a column major bitmap is shifted by at once, if it has to be split at a panel's upper edge.
+ */
+#define FRAMEBUFFER_WALL_SHIFT_COLUMNS                  16
+
+/**
+ * \brief Part of a rectangle on a panel
+ */
+struct Framebuffer_Wall_Clip {
+        uint32_t                         x                 ; //< x position of the part on the panel
+        uint32_t                         y                 ; //< y position of the part on the panel
+        uint32_t                         width             ; //< width  of the part in pixels
+        uint32_t                         height            ; //< height of the part in pixels
+        uint32_t                         dx                ; //< x position of the part in the rectangle
+        uint32_t                         dy                ; //< y position of the part in the rectangle
+};
+
+/**
+ * \brief Clip a run of \ref length pixels starting at \ref start to the run of \ref limit pixels starting at \ref limit_start.
+ *
+ * \return Number of pixels of the run inside the limit, \ref first is the first of them.
+ */
+static inline uint32_t clip_run (
+  uint32_t const  start         //< first pixel of the run
+, uint32_t const  length        //< number of pixels in the run
+, uint32_t const  limit_start   //< first pixel available
+, uint32_t const  limit         //< number of pixels available
+, uint32_t       *first         //< [out] first pixel of the run inside the limit
+){
+        *first = start > limit_start ? start : limit_start;
+        
+        if(( *first - limit_start >= limit  )
+        || ( *first - start       >= length )
+        ){
+                return 0;
+        }
+        
+        uint32_t const length_left = length - ( *first - start );       // of the run
+        uint32_t const limit_left  = limit  - ( *first - limit_start ); // of the limit
+        
+        return length_left < limit_left ? length_left : limit_left;
+};
+
+/**
+ * \brief Find the part of a rectangle on a panel.
+ *
+ * \return true, if the rectangle has pixels on the panel.
+ */
+static bool panel_clip (
+  struct Framebuffer_Wall_Panel const *const panel     //< panel to clip to
+,                           uint32_t  const x         //< x position of the upper left corner of the rectangle on the wall
+,                           uint32_t  const y         //< y position of the upper left corner of the rectangle on the wall
+,                           uint32_t  const width     //< width  of the rectangle in pixels
+,                           uint32_t  const height    //< height of the rectangle in pixels
+,       struct Framebuffer_Wall_Clip *const clip      //< [out] part of the rectangle on the panel
+){
+        uint32_t left;
+        uint32_t top;
+        
+        clip->width  = clip_run( x, width , panel->x, panel->framebuffer->width , &left );
+        clip->height = clip_run( y, height, panel->y, panel->framebuffer->height, &top  );
+        clip->x      = left - panel->x;
+        clip->y      = top  - panel->y;
+        clip->dx     = left - x;
+        clip->dy     = top  - y;
+        
+        return ( clip->width > 0 ) && ( clip->height > 0 );
+};
+
+/**
+ * \brief Find the panel a pixel of the wall is on.
+ *
+ * \return Panel of the pixel, NULL if no panel covers it.
+ */
+static struct Framebuffer_Wall_Panel *panel_at (
+  struct Framebuffer_Wall *const wall   //< wall to look at
+,                uint32_t  const x      //< x position of the pixel on the wall
+,                uint32_t  const y      //< y position of the pixel on the wall
+){
+        for( uint8_t idx = 0; idx < wall->panels_count; idx++ ){
+                struct Framebuffer_Wall_Panel *panel = &wall->panels[idx];
+                
+                if(( x - panel->x < panel->framebuffer->width  )        // wraps around for x < panel->x
+                && ( y - panel->y < panel->framebuffer->height )
+                ){
+                        return panel;
+                }
+        }
+        return NULL;
+};
+
+/**
+ * \brief Get the framebuffer of a panel, ready to draw to the way the wall is drawn to.
+ */
+static inline struct Framebuffer *panel_framebuffer (
+  struct Framebuffer_Wall_Panel const *const panel      //< panel to draw to
+, struct Framebuffer            const *const fb         //< wall framebuffer drawn to
+){
+        panel->framebuffer->raster_op = fb->raster_op;
+        
+        return panel->framebuffer;
+};
+
+/**
+ * \brief Keep the first status failing of the panels
+ */
+static inline enum status_code status_first (
+  enum status_code const status         //< status so far
+, enum status_code const status_panel   //< status of the panel drawn to last
+){
+        return ( status == STATUS_OK ) ? status_panel : status;
+};
+
+/**
+ * \brief Clear every panel
+ *
+ * \asserts fb            != NULL
+ * \asserts fb->user_data != NULL
+ */
+static enum status_code framebuffer_wall_clear (
+        struct Framebuffer *fb                  //< framebuffer to clear
+){
+        Assert( fb            != NULL );
+        Assert( fb->user_data != NULL );
+        
+        struct Framebuffer_Wall *wall   = (struct Framebuffer_Wall *)fb->user_data;
+        enum status_code         status = STATUS_OK;
+        
+        for( uint8_t idx = 0; idx < wall->panels_count; idx++ ){
+                struct Framebuffer *panel_fb = wall->panels[idx].framebuffer;
+                
+                status = status_first( status, panel_fb->clear( panel_fb ) );
+        }
+        
+        return status;
+};
+
+/**
+ * \brief Nothing to release, the wall and the framebuffers of its panels are owned by the caller
+ */
+static enum status_code framebuffer_wall_destroy (
+        struct Framebuffer *fb
+){
+        UNUSED( fb );
+        
+        return STATUS_OK;
+};
+
+/**
+ * \brief Get the value of a pixel from the panel it is on
+ *
+ * \asserts fb            != NULL
+ * \asserts fb->user_data != NULL
+ */
+static enum status_code framebuffer_wall_get_pixel (
+        struct Framebuffer *fb          //< framebuffer to read the pixel from
+,           uint32_t const  x           //< pixel x position
+,           uint32_t const  y           //< pixel y position
+,           uint32_t       *pixel_value //< value of the pixel
+){
+        Assert( fb            != NULL );
+        Assert( fb->user_data != NULL );
+        
+        struct Framebuffer_Wall       *wall  = (struct Framebuffer_Wall *)fb->user_data;
+        struct Framebuffer_Wall_Panel *panel;
+        
+        *pixel_value = 0x00;
+        
+        if(( x >= fb->width  )
+        || ( y >= fb->height )
+        ){
+                return STATUS_ERR_INVALID_ARG;
+        }
+        
+        panel = panel_at( wall, x, y );
+        if( panel == NULL ){
+                return STATUS_OK;       // not covered by a panel
+        }
+        
+        return panel->framebuffer->get_pixel( panel->framebuffer, x - panel->x, y - panel->y, pixel_value );
+};
+
+/**
+ * \brief Set the value of a pixel on the panel it is on
+ *
+ * \asserts fb            != NULL
+ * \asserts fb->user_data != NULL
+ */
+static enum status_code framebuffer_wall_set_pixel (
+        struct Framebuffer *fb          //< framebuffer to write the pixel to
+,           uint32_t const  x           //< pixel x position
+,           uint32_t const  y           //< pixel y position
+,           uint32_t        pixel_value //< value to set for the pixel
+){
+        Assert( fb            != NULL );
+        Assert( fb->user_data != NULL );
+        
+        struct Framebuffer_Wall       *wall  = (struct Framebuffer_Wall *)fb->user_data;
+        struct Framebuffer_Wall_Panel *panel;
+        
+        if(( x >= fb->width  )
+        || ( y >= fb->height )
+        ){
+                return STATUS_ERR_INVALID_ARG;
+        }
+        
+        panel = panel_at( wall, x, y );
+        if( panel == NULL ){
+                return STATUS_OK;       // not covered by a panel, dropped
+        }
+        
+        struct Framebuffer *panel_fb = panel_framebuffer( panel, fb );
+        
+        return panel_fb->set_pixel( panel_fb, x - panel->x, y - panel->y, pixel_value );
+};
+
+/**
+ * \brief Fill the parts of a rectangle on the panels
+ *
+ * \asserts fb            != NULL
+ * \asserts fb->user_data != NULL
+ */
+static enum status_code framebuffer_wall_fill_rect (
+        struct Framebuffer *fb          //< framebuffer to draw to
+,           uint32_t const  x           //< x position of the upper left corner
+,           uint32_t const  y           //< y position of the upper left corner
+,           uint32_t const  width       //< width  of the rectangle in pixels
+,           uint32_t const  height      //< height of the rectangle in pixels
+,           uint32_t const  pixel_value //< value to set for the pixels
+){
+        Assert( fb            != NULL );
+        Assert( fb->user_data != NULL );
+        
+        struct Framebuffer_Wall      *wall   = (struct Framebuffer_Wall *)fb->user_data;
+        struct Framebuffer_Wall_Clip  clip;
+        enum status_code              status = STATUS_OK;
+        
+        for( uint8_t idx = 0; idx < wall->panels_count; idx++ ){
+                struct Framebuffer_Wall_Panel *panel = &wall->panels[idx];
+                
+                if( panel_clip( panel, x, y, width, height, &clip ) ){
+                        status = status_first( status, framebuffer_fill_rect( panel_framebuffer( panel, fb ), clip.x, clip.y, clip.width, clip.height, pixel_value ) );
+                }
+        }
+        
+        return status;
+};
+
+/**
+ * \brief Fill the parts of a horizontal run of pixels on the panels
+ */
+static enum status_code framebuffer_wall_fill_hspan (
+        struct Framebuffer *fb          //< framebuffer to draw to
+,           uint32_t const  x           //< x position of the left most pixel
+,           uint32_t const  y           //< y position of the span
+,           uint32_t const  width       //< number of pixels in the span
+,           uint32_t const  pixel_value //< value to set for the pixels
+){
+        return framebuffer_wall_fill_rect( fb, x, y, width, 1, pixel_value );
+};
+
+/**
+ * \brief Fill the parts of a vertical run of pixels on the panels
+ */
+static enum status_code framebuffer_wall_fill_vspan (
+        struct Framebuffer *fb          //< framebuffer to draw to
+,           uint32_t const  x           //< x position of the span
+,           uint32_t const  y           //< y position of the top most pixel
+,           uint32_t const  height      //< number of pixels in the span
+,           uint32_t const  pixel_value //< value to set for the pixels
+){
+        return framebuffer_wall_fill_rect( fb, x, y, 1, height, pixel_value );
+};
+
+/**
+ * \brief Draw the parts of a 1bpp bitmap on the panels
+ *
+ * A part starting on a byte boundary of the bitmap is handed to the panel as is,
+ * other parts are drawn pixel by pixel.
+ *
+ * \asserts fb            != NULL
+ * \asserts fb->user_data != NULL
+ */
+static enum status_code framebuffer_wall_blit (
+        struct Framebuffer *fb          //< framebuffer to draw to
+,           uint32_t const  x           //< x position of the upper left corner
+,           uint32_t const  y           //< y position of the upper left corner
+,           uint32_t const  width       //< width  of the bitmap in pixels
+,           uint32_t const  height      //< height of the bitmap in pixels
+,      uint8_t const       *bitmap      //< bitmap to draw
+,           uint32_t const  stride      //< number of bytes per bitmap row
+,           uint32_t const  pixel_value //< value to set for the pixels of set bits
+,               bool const  opaque      //< if true, pixels of cleared bits are set to 0x00
+){
+        Assert( fb            != NULL );
+        Assert( fb->user_data != NULL );
+        
+        struct Framebuffer_Wall      *wall   = (struct Framebuffer_Wall *)fb->user_data;
+        struct Framebuffer_Wall_Clip  clip;
+        enum status_code              status = STATUS_OK;
+        
+        for( uint8_t idx = 0; idx < wall->panels_count; idx++ ){
+                struct Framebuffer_Wall_Panel *panel = &wall->panels[idx];
+                
+                if( !panel_clip( panel, x, y, width, height, &clip ) ){
+                        continue;
+                }
+                
+                struct Framebuffer *panel_fb = panel_framebuffer( panel, fb );
+                uint8_t const      *part     = &bitmap[ clip.dy * stride + ( clip.dx >> 3 ) ];
+                
+                if(( clip.dx & 0x07 ) == 0 ){
+                        status = status_first( status, framebuffer_blit( panel_fb, clip.x, clip.y, clip.width, clip.height, part, stride, pixel_value, opaque ) );
+                        continue;
+                }
+                
+                for( uint32_t row = 0; row < clip.height; row++ ){
+                        uint8_t const *scanline = &part[ row * stride ];
+                        for( uint32_t column = 0; column < clip.width; column++ ){
+                                uint32_t bit = ( clip.dx & 0x07 ) + column;
+                                
+                                if( scanline[ bit >> 3 ] & ( 0x80 >> ( bit & 0x07 ) ) ){
+                                        status = status_first( status, panel_fb->set_pixel( panel_fb, clip.x + column, clip.y + row, pixel_value ) );
+                                } else if( opaque ){
+                                        status = status_first( status, panel_fb->set_pixel( panel_fb, clip.x + column, clip.y + row, 0x00 ) );
+                                }
+                        }
+                }
+        }
+        
+        return status;
+};
+
+/**
+ * \brief Draw the parts of a column major 1bpp bitmap on the panels
+ *
+ * A part cut at the upper edge of a panel is shifted into place in small chunks.
+ *
+ * \asserts fb            != NULL
+ * \asserts fb->user_data != NULL
+ */
+static enum status_code framebuffer_wall_blit_columns (
+        struct Framebuffer *fb          //< framebuffer to draw to
+,           uint32_t const  x           //< x position of the upper left corner
+,           uint32_t const  y           //< y position of the upper left corner
+,           uint32_t const  width       //< width  of the bitmap in pixels (number of columns)
+,           uint32_t const  height      //< height of the bitmap in pixels (1..8)
+,      uint8_t const       *columns     //< bitmap to draw, one byte per column
+,           uint32_t const  pixel_value //< value to set for the pixels of set bits
+,               bool const  opaque      //< if true, pixels of cleared bits are set to 0x00
+){
+        Assert( fb            != NULL );
+        Assert( fb->user_data != NULL );
+        
+        struct Framebuffer_Wall      *wall   = (struct Framebuffer_Wall *)fb->user_data;
+        struct Framebuffer_Wall_Clip  clip;
+        enum status_code              status = STATUS_OK;
+        uint8_t                       shifted[FRAMEBUFFER_WALL_SHIFT_COLUMNS];
+        
+        for( uint8_t idx = 0; idx < wall->panels_count; idx++ ){
+                struct Framebuffer_Wall_Panel *panel = &wall->panels[idx];
+                
+                if( !panel_clip( panel, x, y, width, height, &clip ) ){
+                        continue;
+                }
+                
+                struct Framebuffer *panel_fb = panel_framebuffer( panel, fb );
+                
+                if( clip.dy == 0 ){
+                        status = status_first( status, framebuffer_blit_columns( panel_fb, clip.x, clip.y, clip.width, clip.height, &columns[ clip.dx ], pixel_value, opaque ) );
+                        continue;
+                }
+                
+                for( uint32_t column = 0; column < clip.width; column += FRAMEBUFFER_WALL_SHIFT_COLUMNS ){
+                        uint32_t count = clip.width - column;
+                        
+                        if( count > FRAMEBUFFER_WALL_SHIFT_COLUMNS ){
+                                count = FRAMEBUFFER_WALL_SHIFT_COLUMNS;
+                        }
+                        for( uint32_t i = 0; i < count; i++ ){
+                                shifted[i] = columns[ clip.dx + column + i ] >> clip.dy;
+                        }
+                        status = status_first( status, framebuffer_blit_columns( panel_fb, clip.x + column, clip.y, count, clip.height, shifted, pixel_value, opaque ) );
+                }
+        }
+        
+        return status;
+};
+
+/**
+ * \brief Count the pixels of a horizontal run, panel by panel
+ *
+ * \asserts fb            != NULL
+ * \asserts fb->user_data != NULL
+ */
+static enum status_code framebuffer_wall_scan_hspan (
+        struct Framebuffer *fb          //< framebuffer to read from
+,           uint32_t        x           //< x position of the first pixel of the run
+,           uint32_t const  y           //< y position of the run
+,           uint32_t        x_end       //< x position of the last pixel the run may include
+,           uint32_t const  pixel_value //< value to compare the pixels with
+,               bool const  equal       //< if true, count pixels having pixel_value, otherwise pixels not having it
+,           uint32_t       *length      //< [out] number of pixels in the run
+){
+        Assert( fb            != NULL );
+        Assert( fb->user_data != NULL );
+        
+        struct Framebuffer_Wall *wall = (struct Framebuffer_Wall *)fb->user_data;
+        
+        *length = 0;
+        if(( x >= fb->width  )
+        || ( y >= fb->height )
+        ){
+                return STATUS_OK;
+        }
+        if( x_end >= fb->width ){
+                x_end = fb->width - 1;
+        }
+        
+        bool     const right = ( x_end >= x );
+        uint32_t const count = right ? x_end - x + 1 : x - x_end + 1;
+        
+        while( *length < count ){
+                struct Framebuffer_Wall_Panel *panel = panel_at( wall, x, y );
+                
+                if( panel == NULL ){    // not covered by a panel, reads as 0
+                        if(( pixel_value == 0x00 ) != equal ){
+                                break;
+                        }
+                        (*length)++;
+                        x = right ? x + 1 : x - 1;
+                        continue;
+                }
+                
+                // the rest of the run, as far as it is on this panel
+                uint32_t const edge     = right ? panel->x + panel->framebuffer->width - 1 : panel->x;
+                uint32_t const run_end  = right ? ( x_end < edge ? x_end : edge ) : ( x_end > edge ? x_end : edge );
+                uint32_t const span     = right ? run_end - x + 1 : x - run_end + 1;
+                uint32_t       run;
+                enum status_code status;
+                
+                status = framebuffer_scan_hspan( panel->framebuffer, x - panel->x, y - panel->y, run_end - panel->x, pixel_value, equal, &run );
+                if( status != STATUS_OK ){
+                        return status;
+                }
+                
+                *length += run;
+                if( run < span ){
+                        break;          // the run ends on this panel
+                }
+                x = right ? x + span : x - span;
+        }
+        
+        return STATUS_OK;
+};
+
+/**
+ * \brief Copy a rectangle of pixels inside the wall
+ *
+ * If source and destination are on the same panel, the panel copies them itself,
+ * otherwise they are copied pixel by pixel from panel to panel.
+ *
+ * \asserts fb            != NULL
+ * \asserts fb->user_data != NULL
+ */
+static enum status_code framebuffer_wall_copy_rect (
+        struct Framebuffer *fb          //< framebuffer to copy in
+,           uint32_t const  x_src       //< x position of the upper left corner of the source
+,           uint32_t const  y_src       //< y position of the upper left corner of the source
+,           uint32_t const  width       //< width  of the rectangle in pixels
+,           uint32_t const  height      //< height of the rectangle in pixels
+,           uint32_t const  x_dst       //< x position of the upper left corner of the destination
+,           uint32_t const  y_dst       //< y position of the upper left corner of the destination
+){
+        Assert( fb            != NULL );
+        Assert( fb->user_data != NULL );
+        
+        struct Framebuffer_Wall      *wall = (struct Framebuffer_Wall *)fb->user_data;
+        struct Framebuffer_Wall_Clip  clip_src;
+        struct Framebuffer_Wall_Clip  clip_dst;
+        
+        for( uint8_t idx = 0; idx < wall->panels_count; idx++ ){
+                struct Framebuffer_Wall_Panel *panel = &wall->panels[idx];
+                
+                if(( panel_clip( panel, x_src, y_src, width, height, &clip_src ) )
+                && ( panel_clip( panel, x_dst, y_dst, width, height, &clip_dst ) )
+                && ( clip_src.width == width ) && ( clip_src.height == height )
+                && ( clip_dst.width == width ) && ( clip_dst.height == height )
+                ){
+                        return framebuffer_copy_rect( panel_framebuffer( panel, fb ), clip_src.x, clip_src.y, width, height, clip_dst.x, clip_dst.y );
+                }
+        }
+        
+        // like memmove(), walk away from the destination, so no source pixel is overwritten before it is read
+        bool             const up     = ( y_dst <= y_src );
+        bool             const left   = ( x_dst <= x_src );
+        enum status_code       status = STATUS_OK;
+        uint32_t               value;
+        
+        for( uint32_t r = 0; r < height; r++ ){
+                uint32_t row = up ? r : height - 1 - r;
+                
+                for( uint32_t c = 0; c < width; c++ ){
+                        uint32_t column = left ? c : width - 1 - c;
+                        
+                        status = status_first( status, framebuffer_wall_get_pixel( fb, x_src + column, y_src + row, &value ) );
+                        status = status_first( status, framebuffer_wall_set_pixel( fb, x_dst + column, y_dst + row,  value ) );
+                }
+        }
+        
+        return status;
+};
+
+/**
+ * \brief Get the wall of a wall framebuffer
+ */
+static inline struct Framebuffer_Wall *get_wall (
+  struct Framebuffer const *const fb    //< wall framebuffer
+){
+        Assert( fb            != NULL );
+        Assert( fb->user_data != NULL );
+        
+        return (struct Framebuffer_Wall *)fb->user_data;
+};
+
+/**
+ * \brief Get the bus a panel is on, panels on one bus have to take turns
+ */
+static inline void *panel_bus (
+  struct Framebuffer_Wall_Panel const *const panel      //< panel to look at
+){
+        return panel->ssd1306->com_driver.bus;
+};
+
+/**
+ * \brief Take a panel out of the asynchronous update, remembering the first status failing.
+ */
+static void panel_update_async_finish (
+  struct Framebuffer_Wall_Panel *const panel    //< panel done
+,              enum status_code  const status   //< status of the update of the panel
+){
+        struct Framebuffer_Wall *wall = panel->wall;
+        
+        system_interrupt_enter_critical_section();      // panels on other buses finish from other interrupts
+        
+        if(( status       != STATUS_OK        )
+        && ( status       != STATUS_NO_CHANGE )
+        && ( wall->status == STATUS_OK        )
+        ){
+                wall->status = status;
+        }
+        panel->pending = false;
+        
+        system_interrupt_leave_critical_section();
+};
+
+/**
+ * \brief Check if the asynchronous update of a wall is done.
+ *
+ * \return true only once per update, when no panel is pending anymore.
+ */
+static bool wall_update_async_done (
+  struct Framebuffer_Wall *const wall   //< wall to check
+){
+        bool done = false;
+        
+        system_interrupt_enter_critical_section();
+        
+        if( wall->busy ){
+                done = true;
+                for( uint8_t idx = 0; idx < wall->panels_count; idx++ ){
+                        if( wall->panels[idx].pending ){
+                                done = false;
+                                break;
+                        }
+                }
+                wall->busy = !done;
+        }
+        
+        system_interrupt_leave_critical_section();
+        
+        return done;
+};
+
+static void panel_update_async_on_done( void *const user_data, enum status_code const status );
+
+/**
+ * \brief Start the update of the first pending panel on a bus.
+ *
+ * Panels with nothing to send or failing to start are finished right away.
+ *
+ * \return true, if an update is in flight on the bus.
+ */
+static bool bus_update_async_next (
+  struct Framebuffer_Wall *const wall           //< wall the panels are part of
+,                    void *const bus            //< bus to continue
+){
+        for( uint8_t idx = 0; idx < wall->panels_count; idx++ ){
+                struct Framebuffer_Wall_Panel *panel = &wall->panels[idx];
+                enum status_code               status;
+                
+                if(( !panel->pending            )
+                || ( panel_bus( panel ) != bus )
+                ){
+                        continue;
+                }
+                
+                status = ssd1306_display_update_async( panel->ssd1306, panel->framebuffer, panel->update_async, &panel_update_async_on_done, panel );
+                if( status == STATUS_OK ){
+                        return true;    // panel_update_async_on_done() continues with the next panel on the bus
+                }
+                panel_update_async_finish( panel, status );
+        }
+        return false;
+};
+
+/**
+ * \brief Continue the bus of a panel, that finished its update, and report the update of the wall, once all panels are done.
+ */
+static void panel_update_async_on_done (
+        void             *const user_data       //< panel done
+, enum status_code        const status          //< status of the update of the panel
+){
+        struct Framebuffer_Wall_Panel *panel = (struct Framebuffer_Wall_Panel *)user_data;
+        struct Framebuffer_Wall       *wall  = panel->wall;
+        
+        panel_update_async_finish( panel, status );
+        bus_update_async_next    ( wall, panel_bus( panel ) );
+        
+        if(( wall_update_async_done( wall ) )
+        && ( wall->on_done != NULL          )
+        ){
+                wall->on_done( wall->user_data, wall->status );
+        }
+};
+
+/**
+ * \brief Set up a generic framebuffer for a wall
+ */
+static void framebuffer_wall_setup (
+  struct Framebuffer *const fb          //< framebuffer to set up
+,           uint32_t  const width       //< framebuffer width  in pixel
+,           uint32_t  const height      //< framebuffer height in pixel
+){
+        Assert( fb != NULL );
+        
+        fb->width        = width ;
+        fb->height       = height;
+        fb->clear        = &framebuffer_wall_clear       ;
+        fb->destroy      = &framebuffer_wall_destroy     ;
+        fb->get_pixel    = &framebuffer_wall_get_pixel   ;
+        fb->set_pixel    = &framebuffer_wall_set_pixel   ;
+        fb->fill_hspan   = &framebuffer_wall_fill_hspan  ;
+        fb->fill_vspan   = &framebuffer_wall_fill_vspan  ;
+        fb->fill_rect    = &framebuffer_wall_fill_rect   ;
+        fb->blit         = &framebuffer_wall_blit        ;
+        fb->blit_columns = &framebuffer_wall_blit_columns;
+        fb->scan_hspan   = &framebuffer_wall_scan_hspan  ;
+        fb->copy_rect    = &framebuffer_wall_copy_rect   ;
+        fb->raster_op    = FRAMEBUFFER_RASTER_OP_SET;
+        fb->user_data    = NULL;
+};
+
+// ===========================================================================
+//  public
+// ===========================================================================
+
+/**
+ * \asserts fb     != NULL
+ * \asserts wall   != NULL
+ * \asserts width  >  0
+ * \asserts height >  0
+ */
+enum status_code framebuffer_wall_init_static (
+  struct Framebuffer      *const fb             //< caller owned generic framebuffer instance
+, struct Framebuffer_Wall *const wall           //< caller owned wall instance
+,                uint32_t  const width          //< framebuffer width  in pixel
+,                uint32_t  const height         //< framebuffer height in pixel
+){
+        Assert( fb     != NULL );
+        Assert( wall   != NULL );
+        Assert( width  >  0    );
+        Assert( height >  0    );
+        
+        framebuffer_wall_setup( fb, width, height );
+        fb->user_data = wall;
+        
+        memset( (void *)wall, 0x00, sizeof( *wall ) );
+        wall->status = STATUS_OK;
+        
+        return STATUS_OK;
+};
+
+/**
+ * \asserts fb                  != NULL
+ * \asserts fb->user_data       != NULL
+ * \asserts ssd1306             != NULL
+ * \asserts panel_fb            != NULL
+ * \asserts panel_fb->user_data != NULL
+ */
+enum status_code framebuffer_wall_add_panel (
+  struct Framebuffer          *const fb         //< wall framebuffer to add the panel to
+, struct SSD1306              *const ssd1306    //< controller of the panel
+, struct Framebuffer          *const panel_fb   //< SSD1306 framebuffer of the panel, of the size of the panel
+,                    uint32_t  const x          //< x position of the upper left corner of the panel on the wall
+,                    uint32_t  const y          //< y position of the upper left corner of the panel on the wall
+, enum Framebuffer_Wall_Mount  const mount      //< how the panel is mounted
+){
+        Assert( ssd1306             != NULL );
+        Assert( panel_fb            != NULL );
+        Assert( panel_fb->user_data != NULL );
+        
+        struct Framebuffer_Wall *wall = get_wall( fb );
+        
+        if( wall->panels_count >= FRAMEBUFFER_WALL_PANELS_MAX ){
+                return STATUS_ERR_NO_MEMORY;
+        }
+        if(( x >= fb->width  ) || ( panel_fb->width  > fb->width  - x )
+        || ( y >= fb->height ) || ( panel_fb->height > fb->height - y )
+        ){
+                return STATUS_ERR_INVALID_ARG;
+        }
+        
+        struct Framebuffer_Wall_Clip clip;
+        
+        for( uint8_t idx = 0; idx < wall->panels_count; idx++ ){
+                if( panel_clip( &wall->panels[idx], x, y, panel_fb->width, panel_fb->height, &clip ) ){
+                        return STATUS_ERR_INVALID_ARG;  // overlaps
+                }
+        }
+        
+        struct Framebuffer_Wall_Panel *panel = &wall->panels[ wall->panels_count++ ];
+        
+        panel->wall         = wall;
+        panel->ssd1306      = ssd1306;
+        panel->framebuffer  = panel_fb;
+        panel->update_async = NULL;
+        panel->x            = x;
+        panel->y            = y;
+        panel->mount        = mount;
+        panel->pending      = false;
+        
+        return STATUS_OK;
+};
+
+/**
+ * \asserts fb != NULL
+ */
+enum status_code framebuffer_wall_set_update_async (
+  struct Framebuffer          *const fb           //< wall framebuffer the panel is part of
+,                     uint8_t  const panel_idx    //< index of the panel, in the order the panels were added
+, struct SSD1306_Update_Async *const update_async //< state of the asynchronous updates of the panel
+){
+        struct Framebuffer_Wall *wall = get_wall( fb );
+        
+        if( panel_idx >= wall->panels_count ){
+                return STATUS_ERR_INVALID_ARG;
+        }
+        
+        wall->panels[panel_idx].update_async = update_async;
+        
+        return STATUS_OK;
+};
+
+/**
+ * \asserts fb != NULL
+ */
+enum status_code framebuffer_wall_init_panels (
+  struct Framebuffer *const fb                  //< wall framebuffer to initialize the panels of
+){
+        struct Framebuffer_Wall *wall   = get_wall( fb );
+        enum status_code         status = STATUS_OK;
+        uint32_t                 pixels = 0;
+        
+        // the panels don't overlap, so they cover the wall, if they have as many pixels
+        for( uint8_t idx = 0; idx < wall->panels_count; idx++ ){
+                pixels += wall->panels[idx].framebuffer->width * wall->panels[idx].framebuffer->height;
+        }
+        if( pixels != fb->width * fb->height ){
+                return STATUS_ERR_INVALID_ARG;
+        }
+        
+        for( uint8_t idx = 0; idx < wall->panels_count; idx++ ){
+                struct Framebuffer_Wall_Panel *panel           = &wall->panels[idx];
+                struct SSD1306                *ssd1306         = panel->ssd1306;
+                bool                    const  flip_horizontal = ssd1306->flip_horizontal;
+                bool                    const  flip_vertical   = ssd1306->flip_vertical;
+                enum status_code               panel_status;
+                
+                // the segment remap mirrors the columns, the COM remap the rows
+                ssd1306->flip_vertical   = flip_vertical   != ( ( panel->mount & FRAMEBUFFER_WALL_MOUNT_MIRROR_X ) != 0 );
+                ssd1306->flip_horizontal = flip_horizontal != ( ( panel->mount & FRAMEBUFFER_WALL_MOUNT_MIRROR_Y ) != 0 );
+                
+                panel_status = ssd1306_init( ssd1306 );
+                
+                ssd1306->flip_vertical   = flip_vertical;
+                ssd1306->flip_horizontal = flip_horizontal;
+                
+                if( status == STATUS_OK ){
+                        status = panel_status;
+                }
+        }
+        
+        return status;
+};
+
+/**
+ * \asserts fb != NULL
+ */
+enum status_code framebuffer_wall_update (
+  struct Framebuffer *const fb                  //< wall framebuffer to update the panels of
+){
+        struct Framebuffer_Wall *wall   = get_wall( fb );
+        enum status_code         status = STATUS_OK;
+        
+        if( wall->busy ){
+                return STATUS_BUSY;
+        }
+        
+        for( uint8_t idx = 0; idx < wall->panels_count; idx++ ){
+                struct Framebuffer_Wall_Panel *panel        = &wall->panels[idx];
+                enum status_code               panel_status = ssd1306_display_update( panel->ssd1306, panel->framebuffer );
+                
+                if( status == STATUS_OK ){
+                        status = panel_status;
+                }
+        }
+        
+        return status;
+};
+
+/**
+ * \asserts fb != NULL
+ */
+enum status_code framebuffer_wall_update_next (
+  struct Framebuffer *const fb                  //< wall framebuffer to update a panel of
+){
+        struct Framebuffer_Wall *wall = get_wall( fb );
+        
+        if( wall->busy ){
+                return STATUS_BUSY;
+        }
+        
+        for( uint8_t i = 0; i < wall->panels_count; i++ ){
+                uint8_t                        idx   = ( wall->panel_next + i ) % wall->panels_count;
+                struct Framebuffer_Wall_Panel *panel = &wall->panels[idx];
+                
+                if( ((struct Framebuffer_SSD1306 *)panel->framebuffer->user_data)->tiles_dirty_count < 1 ){
+                        continue;
+                }
+                
+                wall->panel_next = ( idx + 1 ) % wall->panels_count;    // the others come first next time
+                
+                return ssd1306_display_update( panel->ssd1306, panel->framebuffer );
+        }
+        
+        return STATUS_NO_CHANGE;
+};
+
+/**
+ * \asserts fb != NULL
+ */
+enum status_code framebuffer_wall_update_async (
+  struct Framebuffer          *const fb          //< wall framebuffer to update the panels of
+,        SSD1306_Update_Done  *const on_done     //< called with the status of the first panel failing or STATUS_OK, when all panels are done (may be NULL)
+,                       void  *const user_data   //< user data to pass to on_done
+){
+        struct Framebuffer_Wall *wall    = get_wall( fb );
+        bool                     started = false;
+        
+        if( wall->busy ){
+                return STATUS_BUSY;
+        }
+        
+        wall->on_done   = on_done;
+        wall->user_data = user_data;
+        wall->status    = STATUS_OK;
+        
+        // panels without asynchronous state first, they may share a bus with the others
+        for( uint8_t idx = 0; idx < wall->panels_count; idx++ ){
+                struct Framebuffer_Wall_Panel *panel = &wall->panels[idx];
+                
+                panel->pending = ( panel->update_async != NULL );
+                if( !panel->pending ){
+                        panel_update_async_finish( panel, ssd1306_display_update( panel->ssd1306, panel->framebuffer ) );
+                }
+        }
+        
+        wall->busy = true;
+        
+        // start the first panel of every bus, the following ones are started from the completion of the one before
+        for( uint8_t idx = 0; idx < wall->panels_count; idx++ ){
+                struct Framebuffer_Wall_Panel *panel     = &wall->panels[idx];
+                void                          *bus       = panel_bus( panel );
+                bool                           bus_first = ( panel->update_async != NULL );
+                
+                for( uint8_t before = 0; bus_first && ( before < idx ); before++ ){
+                        bus_first = ( wall->panels[before].update_async == NULL ) || ( panel_bus( &wall->panels[before] ) != bus );
+                }
+                if( bus_first ){
+                        started |= bus_update_async_next( wall, bus );
+                }
+        }
+        
+        // all buses may be done already, if there was little or nothing to send
+        if( wall_update_async_done( wall ) ){
+                if( !started ){
+                        return wall->status != STATUS_OK ? wall->status : STATUS_NO_CHANGE;
+                }
+                if( wall->on_done != NULL ){
+                        wall->on_done( wall->user_data, wall->status );
+                }
+        }
+        
+        return STATUS_OK;
+};
+
+/**
+ * \asserts fb != NULL
+ */
+bool framebuffer_wall_update_async_busy (
+  struct Framebuffer const *const fb            //< wall framebuffer to check
+){
+        return get_wall( fb )->busy;
+};
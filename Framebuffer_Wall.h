@@ -0,0 +1,232 @@
+/**     \file   Framebuffer_Wall.h
+
+        \brief  Declarations of a framebuffer spanning several SSD1306 controlled panels
+ 
+        \license 
+                MIT: The MIT License (https://opensource.org/licenses/MIT)
+                .
+                Permission is hereby granted, free of charge, to any person obtaining a copy of this software 
+                and associated documentation files (the "Software"), to deal in the Software without restriction, 
+                including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+                and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, 
+                subject to the following conditions:
+                .
+                The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+                .
+                THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+                INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. 
+                IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+                WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR 
+                THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ 
+        \copyright
+                DIT: 2026; Drechsler Information Technologies; www.drechsler-it.de
+ 
+        \authors
+                jrgdre: Joerg Drechsler; DIT
+ 
+        \versions
+                1.0.0: 2026-10-17 jrgdre initial release
+
+ */
+#ifndef FRAMEBUFFER_WALL_H
+#define FRAMEBUFFER_WALL_H
+
+#include <asf.h>
+#include "Framebuffer.h"
+#include "SSD1306.h"
+
+/**
+ * \brief Maximum number of panels of a wall.
+ */
+#ifndef FRAMEBUFFER_WALL_PANELS_MAX
+#define FRAMEBUFFER_WALL_PANELS_MAX                     4
+#endif
+
+/**
+ * \brief How a panel is mounted in the wall, relative to the orientation its controller is configured for.
+ *
+ * The SSD1306 mirrors the picture in hardware with its segment and COM remap, 
+ * so a panel mounted the other way round costs nothing when drawing or flushing.
+ */
+enum Framebuffer_Wall_Mount {
+        FRAMEBUFFER_WALL_MOUNT_NORMAL     = 0x00,     //< panel shows the picture like on its own
+        FRAMEBUFFER_WALL_MOUNT_MIRROR_X   = 0x01,     //< panel mirrored left to right
+        FRAMEBUFFER_WALL_MOUNT_MIRROR_Y   = 0x02,     //< panel mirrored top to bottom
+        FRAMEBUFFER_WALL_MOUNT_ROTATE_180 = 0x03      //< panel upside down (mirrored both ways)
+};
+
+struct Framebuffer_Wall;
+
+/**
+ * \brief Panel of a wall
+ *
+ * Every panel has its own SSD1306 framebuffer, so it keeps its own dirty tiles and is updated on its own.
+ */
+struct Framebuffer_Wall_Panel {
+        struct Framebuffer_Wall         *wall              ; //< wall the panel belongs to
+        struct SSD1306                  *ssd1306           ; //< controller of the panel
+        struct Framebuffer              *framebuffer       ; //< SSD1306 framebuffer of the panel
+        struct SSD1306_Update_Async     *update_async      ; //< state of the asynchronous updates of the panel (NULL: synchronous updates only)
+        uint32_t                         x                 ; //< x position of the upper left corner of the panel on the wall
+        uint32_t                         y                 ; //< y position of the upper left corner of the panel on the wall
+        enum Framebuffer_Wall_Mount      mount             ; //< how the panel is mounted
+        volatile bool                    pending           ; //< panel is waiting for or sending its part of an asynchronous update
+};
+
+/**
+ * \brief Framebuffer spanning several SSD1306 controlled panels, e.g. two 128x64 panels side by side forming 256x64 pixels
+ *
+ * Drawing code uses the generic framebuffer of the wall and doesn't know about panels. 
+ * Every drawing operation is clipped to the panels it touches and handed to their framebuffers, 
+ * so spans, rectangles and glyphs keep the fast paths of the SSD1306 framebuffer.
+ * The panels have to cover the wall without gaps, a pixel not on a panel can't be drawn
+ * (e.g. a flood fill of it would never end).
+ *
+ * The panels are updated one at a time (see \ref framebuffer_wall_update_next()), all at once
+ * (see \ref framebuffer_wall_update()) or asynchronously, panels on buses of their own in parallel
+ * (see \ref framebuffer_wall_update_async()).
+ */
+struct Framebuffer_Wall {
+        struct Framebuffer_Wall_Panel    panels[FRAMEBUFFER_WALL_PANELS_MAX]; //< panels of the wall
+        uint8_t                          panels_count      ; //< number of panels of the wall
+        uint8_t                          panel_next        ; //< panel to look at first by the next round robin update
+        SSD1306_Update_Done             *on_done           ; //< called when the asynchronous update is done (may be NULL)
+        void                            *user_data         ; //< user data to pass to on_done
+        volatile bool                    busy              ; //< an asynchronous update is in flight
+        volatile enum status_code        status            ; //< status of the last asynchronous update
+};
+
+/**
+ * \brief Initialize a framebuffer spanning several panels in caller provided storage.
+ *
+ * The wall has no panels yet, add them with \ref framebuffer_wall_add_panel().
+ * destroy() is a no-op, the framebuffers of the panels are owned by the caller.
+ * \code
+ *  static struct Framebuffer       wall_fb;
+ *  static struct Framebuffer_Wall  wall;
+ *
+ *  framebuffer_wall_init_static( &wall_fb, &wall, 256, 64 );
+ *  framebuffer_wall_add_panel  ( &wall_fb, &oled_left , &oled_left_fb ,   0, 0, FRAMEBUFFER_WALL_MOUNT_NORMAL     );
+ *  framebuffer_wall_add_panel  ( &wall_fb, &oled_right, &oled_right_fb, 128, 0, FRAMEBUFFER_WALL_MOUNT_ROTATE_180 );
+ *  framebuffer_wall_init_panels( &wall_fb );
+ * \endcode
+ *
+ * \return Status of operation.
+ * \retval STATUS_OK                    If the framebuffer was initialized
+ */
+enum status_code framebuffer_wall_init_static (
+  struct Framebuffer      *const fb             //< caller owned generic framebuffer instance
+, struct Framebuffer_Wall *const wall           //< caller owned wall instance
+,                uint32_t  const width          //< framebuffer width  in pixel
+,                uint32_t  const height         //< framebuffer height in pixel
+);
+
+/**
+ * \brief Add a panel to a wall.
+ *
+ * The panel must lie inside the wall and must not overlap other panels.
+ *
+ * \return Status of operation.
+ * \retval STATUS_OK                    If the panel was added
+ * \retval STATUS_ERR_NO_MEMORY         If the wall has FRAMEBUFFER_WALL_PANELS_MAX panels already
+ * \retval STATUS_ERR_INVALID_ARG       If the panel doesn't lie inside the wall or overlaps another panel
+ */
+enum status_code framebuffer_wall_add_panel (
+  struct Framebuffer          *const fb         //< wall framebuffer to add the panel to
+, struct SSD1306              *const ssd1306    //< controller of the panel
+, struct Framebuffer          *const panel_fb   //< SSD1306 framebuffer of the panel, of the size of the panel
+,                    uint32_t  const x          //< x position of the upper left corner of the panel on the wall
+,                    uint32_t  const y          //< y position of the upper left corner of the panel on the wall
+, enum Framebuffer_Wall_Mount  const mount      //< how the panel is mounted
+);
+
+/**
+ * \brief Give a panel of a wall the state for asynchronous updates.
+ *
+ * Panels without it are updated synchronously by \ref framebuffer_wall_update_async().
+ *
+ * \return Status of operation.
+ * \retval STATUS_OK                    If the state was set
+ * \retval STATUS_ERR_INVALID_ARG       If there is no panel \ref panel_idx
+ */
+enum status_code framebuffer_wall_set_update_async (
+  struct Framebuffer          *const fb           //< wall framebuffer the panel is part of
+,                     uint8_t  const panel_idx    //< index of the panel, in the order the panels were added
+, struct SSD1306_Update_Async *const update_async //< state of the asynchronous updates of the panel
+);
+
+/**
+ * \brief Initialize the controllers of all panels of a wall, mirroring the panels as they are mounted.
+ *
+ * Calls \ref ssd1306_init() for every panel, with the flips of the controller toggled by the mount of the panel. 
+ * The configuration of the controllers is left as it was.
+ *
+ * \return Status of operation.
+ * \retval STATUS_OK                    If all controllers were initialized
+ * \retval STATUS_ERR_INVALID_ARG       If the panels don't cover the wall, no controller is initialized
+ * \retval any                          Status of the first controller failing
+ */
+enum status_code framebuffer_wall_init_panels (
+  struct Framebuffer *const fb                  //< wall framebuffer to initialize the panels of
+);
+
+/**
+ * \brief Update all panels of a wall, one after the other.
+ *
+ * Every panel sends only its own dirty tiles (see \ref ssd1306_display_update()).
+ *
+ * \return Status of operation.
+ * \retval STATUS_OK                    If all panels were updated
+ * \retval STATUS_BUSY                  If an asynchronous update is in flight
+ * \retval any                          Status of the first panel failing, the other panels are updated anyway
+ */
+enum status_code framebuffer_wall_update (
+  struct Framebuffer *const fb                  //< wall framebuffer to update the panels of
+);
+
+/**
+ * \brief Update the next panel of a wall with dirty tiles, round robin.
+ *
+ * Spreads the update of the wall over several calls, one panel at a time, 
+ * so no panel waits for the others to be sent. Panels without dirty tiles are skipped.
+ *
+ * \return Status of operation.
+ * \retval STATUS_OK                    If a panel was updated
+ * \retval STATUS_NO_CHANGE             If no panel has dirty tiles
+ * \retval STATUS_BUSY                  If an asynchronous update is in flight
+ * \retval any                          Status of the panel
+ */
+enum status_code framebuffer_wall_update_next (
+  struct Framebuffer *const fb                  //< wall framebuffer to update a panel of
+);
+
+/**
+ * \brief Start updating all panels of a wall and return at once.
+ *
+ * Panels on buses of their own (different com modules, e.g. SERCOMs) are sent in parallel,
+ * panels sharing a bus one after the other, each started from the completion of the one before
+ * (see \ref ssd1306_display_update_async()). Panels without state for asynchronous updates 
+ * (see \ref framebuffer_wall_set_update_async()) are updated synchronously right here.
+ * Don't use the buses in any other way, before \ref on_done is called.
+ *
+ * \return Status of operation.
+ * \retval STATUS_OK                    If the update was started, \ref on_done will be called when it is done
+ * \retval STATUS_NO_CHANGE             If there was nothing to send asynchronously, \ref on_done won't be called
+ * \retval STATUS_BUSY                  If an update is still in flight
+ * \retval any                          Status of the first panel failing, if nothing is in flight
+ */
+enum status_code framebuffer_wall_update_async (
+  struct Framebuffer          *const fb          //< wall framebuffer to update the panels of
+,        SSD1306_Update_Done  *const on_done     //< called with the status of the first panel failing or STATUS_OK, when all panels are done (may be NULL)
+,                       void  *const user_data   //< user data to pass to on_done
+);
+
+/**
+ * \brief Check if an asynchronous update of a wall is still in flight.
+ */
+bool framebuffer_wall_update_async_busy (
+  struct Framebuffer const *const fb            //< wall framebuffer to check
+);
+
+#endif // FRAMEBUFFER_WALL_H
@@ -0,0 +1,312 @@
+/**     \file   Framebuffer_Wall_Test.c
+
+        \brief  Host test of the framebuffer spanning several SSD1306 panels.
+ 
+        \license 
+                MIT: The MIT License (https://opensource.org/licenses/MIT)
+                .
+                Permission is hereby granted, free of charge, to any person obtaining a copy of this software 
+                and associated documentation files (the "Software"), to deal in the Software without restriction, 
+                including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+                and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, 
+                subject to the following conditions:
+                .
+                The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+                .
+                THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+                INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. 
+                IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+                WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR 
+                THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ 
+        \copyright
+                DIT: 2026; Drechsler Information Technologies; www.drechsler-it.de
+ 
+        \authors
+                jrgdre: Joerg Drechsler; DIT
+ 
+        \versions
+                1.0.0: 2026-10-17 jrgdre initial release
+
+ */
+#include <string.h>                     // memcmp
+#include "Com_Driver_SSD1306_Emulator.h"// display data RAM of the controllers
+#include "Framebuffer_SSD1306.h"        // framebuffers of the panels and the reference
+#include "Framebuffer_Wall.h"           // wall tested
+#include "SSD1306.h"                    // controllers of the panels
+#include "Test.h"                       // checks
+
+#define PANELS 4                        //< panels of the walls tested, at most
+
+static struct Framebuffer                 wall_fb               ; //< wall framebuffer tested
+static struct Framebuffer_Wall            wall                  ; //< wall tested
+static struct SSD1306                     ssd1306    [PANELS]   ; //< controllers of the panels
+static struct Com_Driver_SSD1306_Emulator emulator   [PANELS]   ; //< execute the traffic of the panels
+static struct Framebuffer                *panel_fb   [PANELS]   ; //< framebuffers of the panels
+static struct SSD1306_Update_Async        update     [PANELS]   ; //< states of the asynchronous updates of the panels
+static uint32_t                           done_calls            ; //< number of calls of on_done
+static enum status_code                   done_status           ; //< status on_done was called with last
+
+/**
+ * \brief Set up a wall of \ref count panels of 128 x \ref panel_height, placed in a row of two, and initialize their controllers
+ */
+static void setup (
+                         uint8_t  const count           //< number of panels
+,                       uint32_t  const panel_height    //< 32 or 64
+, enum Framebuffer_Wall_Mount const *const mounts        //< mount of every panel
+){
+        uint32_t const rows = ( count + 1 ) / 2;
+        
+        TEST_CHECK( framebuffer_wall_init_static( &wall_fb, &wall, 256, rows * panel_height ) == STATUS_OK );
+        
+        for( uint8_t idx = 0; idx < count; idx++ ){
+                memset( &ssd1306[idx], 0x00, sizeof( ssd1306[idx] ) );
+                ssd1306[idx].address            = 0x3C + ( idx & 1 );
+                ssd1306[idx].geometry           = panel_height == 64 ? SSD1306_GEOMETRY_128x64 : SSD1306_GEOMETRY_128x32;
+                ssd1306[idx].charge_pump_source = SSD1306_CHARGE_PUMP_SOURCE_INTERNAL_VCC;
+                
+                com_driver_ssd1306_emulator_init( &ssd1306[idx].com_driver, &emulator[idx] );
+                memset( emulator[idx].ram, 0x00, sizeof( emulator[idx].ram ) );        // like the framebuffers cleared
+                
+                panel_fb[idx] = framebuffer_SSD1306_create( SSD1306_COLUMNS, ssd1306[idx].geometry );
+                panel_fb[idx]->clear( panel_fb[idx] );                                  // the tiles of a new framebuffer are undefined
+                
+                TEST_CHECK( framebuffer_wall_add_panel( &wall_fb, &ssd1306[idx], panel_fb[idx], 
+                                                        ( idx & 1 ) * 128, ( idx / 2 ) * panel_height, mounts[idx] ) == STATUS_OK );
+        }
+        TEST_CHECK( framebuffer_wall_init_panels( &wall_fb ) == STATUS_OK );
+        
+        done_calls  = 0;
+        done_status = STATUS_OK;
+}
+
+/**
+ * \brief Destroy the framebuffers of the panels
+ */
+static void teardown (
+  uint8_t const count                           //< number of panels
+){
+        for( uint8_t idx = 0; idx < count; idx++ ){
+                panel_fb[idx]->destroy( panel_fb[idx] );
+        }
+}
+
+/**
+ * \brief Check whether the display data RAM of a panel shows its framebuffer
+ */
+static bool ram_matches (
+  uint8_t const idx                             //< panel to compare
+){
+        struct Framebuffer_SSD1306 *fb_ssd1306 = (struct Framebuffer_SSD1306 *)panel_fb[idx]->user_data;
+        
+        return memcmp( emulator[idx].ram, fb_ssd1306->tiles, fb_ssd1306->bytes ) == 0;
+}
+
+/**
+ * \brief Count the pixels, that differ between two framebuffers of the same size
+ */
+static uint32_t pixels_different (
+  struct Framebuffer *const fb_a                //< framebuffer to compare
+, struct Framebuffer *const fb_b                //< framebuffer to compare with
+){
+        uint32_t different = 0;
+        uint32_t value_a;
+        uint32_t value_b;
+        
+        for( uint32_t y = 0; y < fb_a->height; y++ ){
+                for( uint32_t x = 0; x < fb_a->width; x++ ){
+                        fb_a->get_pixel( fb_a, x, y, &value_a );
+                        fb_b->get_pixel( fb_b, x, y, &value_b );
+                        different += ( value_a != value_b );
+                }
+        }
+        return different;
+}
+
+/**
+ * \brief Next number of a pseudo random sequence
+ */
+static uint32_t random_next (
+  uint32_t *const seed                          //< state of the sequence
+){
+        *seed = ( *seed * 1103515245 ) + 12345;
+        
+        return *seed >> 8;
+}
+
+/**
+ * \brief Random drawing operations on the wall and on a single framebuffer of its size give the same pixels
+ */
+static void test_draw (
+  void
+){
+        static enum Framebuffer_Wall_Mount const mounts[2] = { FRAMEBUFFER_WALL_MOUNT_NORMAL, FRAMEBUFFER_WALL_MOUNT_ROTATE_180 };
+        static uint8_t                           bitmap[8 * 40];
+        
+        struct Framebuffer *reference = framebuffer_SSD1306_create( 256, SSD1306_GEOMETRY_128x64 );
+        uint32_t            seed      = 3;
+        
+        setup( 2, 64, mounts );
+        reference->clear( reference );
+        
+        for( uint32_t idx = 0; idx < sizeof( bitmap ); idx++ ){
+                bitmap[idx] = (uint8_t)random_next( &seed );
+        }
+        
+        for( uint32_t op = 0; op < 4000; op++ ){
+                enum Framebuffer_Raster_Op raster_op = (enum Framebuffer_Raster_Op)( random_next( &seed ) & 0x03 );
+                uint32_t                   x         = random_next( &seed ) % 270;     // some beyond the edges
+                uint32_t                   y         = random_next( &seed ) % 70;
+                uint32_t                   w         = 1 + random_next( &seed ) % 64;
+                uint32_t                   h         = 1 + random_next( &seed ) % 40;
+                uint32_t                   value     = random_next( &seed ) & 1;
+                bool                       opaque    = random_next( &seed ) & 1;
+                int32_t                    dx        = (int32_t)( random_next( &seed ) % 17 ) - 8;
+                int32_t                    dy        = (int32_t)( random_next( &seed ) % 17 ) - 8;
+                uint32_t                   kind      = random_next( &seed ) % 8;
+                
+                for( uint_fast8_t target = 0; target < 2; target++ ){
+                        struct Framebuffer *fb = target ? reference : &wall_fb;
+                        
+                        framebuffer_set_raster_op( fb, raster_op );
+                        switch( kind ){
+                        case 0: framebuffer_fill_rect   ( fb, x, y, w, h, value );                              break;
+                        case 1: framebuffer_fill_hspan  ( fb, x, y, w, value );                                 break;
+                        case 2: framebuffer_fill_vspan  ( fb, x, y, h, value );                                 break;
+                        case 3: framebuffer_blit        ( fb, x, y, w, h, bitmap, 8, value, opaque );          break;
+                        case 4: framebuffer_blit_columns( fb, x, y, w, 1 + h % 8, bitmap, value, opaque );     break;
+                        case 5: framebuffer_copy_rect   ( fb, x, y, w, h, ( x + dx ) & 0xFF, ( y + dy ) & 0x3F ); break;
+                        case 6: framebuffer_scroll_rect ( fb, x, y, w, h, dx, dy, value );                     break;
+                        default:
+                                if(( x < fb->width ) && ( y < fb->height )){
+                                        fb->set_pixel( fb, x, y, value );
+                                }
+                                break;
+                        }
+                }
+                if(( op % 500 ) == 0 ){
+                        TEST_CHECK( pixels_different( &wall_fb, reference ) == 0 );
+                }
+        }
+        TEST_CHECK( pixels_different( &wall_fb, reference ) == 0 );
+        
+        // what the panels show, is what was drawn to them
+        framebuffer_set_raster_op( &wall_fb, FRAMEBUFFER_RASTER_OP_SET );
+        TEST_CHECK( framebuffer_wall_update( &wall_fb ) == STATUS_OK );
+        TEST_CHECK( ram_matches( 0 ) );
+        TEST_CHECK( ram_matches( 1 ) );
+        
+        teardown( 2 );
+        reference->destroy( reference );
+}
+
+/**
+ * \brief The controllers of the panels mirror them as they are mounted, their configuration is left as it was
+ */
+static void test_mounts (
+  void
+){
+        static enum Framebuffer_Wall_Mount const mounts[4] = { 
+                FRAMEBUFFER_WALL_MOUNT_NORMAL  , FRAMEBUFFER_WALL_MOUNT_MIRROR_X, 
+                FRAMEBUFFER_WALL_MOUNT_MIRROR_Y, FRAMEBUFFER_WALL_MOUNT_ROTATE_180 
+        };
+        
+        setup( 4, 32, mounts );
+        
+        for( uint8_t idx = 0; idx < 4; idx++ ){
+                TEST_CHECK( emulator[idx].segment_remap == ( ( mounts[idx] & FRAMEBUFFER_WALL_MOUNT_MIRROR_X ) != 0 ) );
+                TEST_CHECK( emulator[idx].com_remap     == ( ( mounts[idx] & FRAMEBUFFER_WALL_MOUNT_MIRROR_Y ) != 0 ) );
+                TEST_CHECK( !ssd1306[idx].flip_horizontal );
+                TEST_CHECK( !ssd1306[idx].flip_vertical   );
+        }
+        
+        // a controller configured flipped is flipped back by its mount (ssd1306_init() expects a controller after RESET)
+        ssd1306[3].flip_horizontal = true;
+        ssd1306[3].flip_vertical   = true;
+        for( uint8_t idx = 0; idx < 4; idx++ ){
+                com_driver_ssd1306_emulator_reset( &emulator[idx] );
+        }
+        TEST_CHECK( framebuffer_wall_init_panels( &wall_fb ) == STATUS_OK );
+        TEST_CHECK( !emulator[3].segment_remap );
+        TEST_CHECK( !emulator[3].com_remap     );
+        TEST_CHECK( ssd1306[3].flip_horizontal );
+        
+        teardown( 4 );
+}
+
+/**
+ * \brief Completion handler of the asynchronous updates of the wall: counts its calls
+ */
+static void on_done (
+  void             *const user_data             //< &done_calls
+, enum status_code  const status                //< status of the update
+){
+        TEST_CHECK( user_data == &done_calls );
+        TEST_CHECK( !framebuffer_wall_update_async_busy( &wall_fb ) );
+        
+        done_calls++;
+        done_status = status;
+}
+
+/**
+ * \brief Panels sharing a bus take turns, panels on buses of their own are sent in parallel
+ */
+static void test_update_async (
+  void
+){
+        static enum Framebuffer_Wall_Mount const mounts[2] = { FRAMEBUFFER_WALL_MOUNT_NORMAL, FRAMEBUFFER_WALL_MOUNT_NORMAL };
+        static uint32_t                          bus;      // stands in for the SERCOM of two chip selects
+        
+        for( uint_fast8_t shared = 0; shared < 2; shared++ ){
+                setup( 2, 64, mounts );
+                for( uint8_t idx = 0; idx < 2; idx++ ){
+                        memset( &update[idx], 0x00, sizeof( update[idx] ) );
+                        TEST_CHECK( framebuffer_wall_set_update_async( &wall_fb, idx, &update[idx] ) == STATUS_OK );
+                        if( shared ){
+                                ssd1306[idx].com_driver.bus = &bus;
+                        }
+                }
+                
+                framebuffer_fill_rect( &wall_fb, 100, 10, 60, 40, 1 );        // across both panels
+                
+                TEST_CHECK( framebuffer_wall_update_async( &wall_fb, on_done, &done_calls ) == STATUS_OK );
+                TEST_CHECK( framebuffer_wall_update_async_busy( &wall_fb ) );
+                TEST_CHECK( framebuffer_wall_update( &wall_fb ) == STATUS_BUSY );
+                
+                // complete the writes like the bus interrupts would, checking who is on the bus
+                bool     progress = true;
+                uint32_t both     = 0;          // times both panels had a write in flight
+                
+                while( progress ){
+                        both    += ( emulator[0].pending != NULL ) && ( emulator[1].pending != NULL );
+                        progress = false;
+                        for( uint8_t idx = 0; idx < 2; idx++ ){
+                                progress |= com_driver_ssd1306_emulator_complete( &emulator[idx], STATUS_OK );
+                        }
+                }
+                
+                TEST_CHECK( shared ? ( both == 0 ) : ( both > 0 ) );
+                TEST_CHECK( !framebuffer_wall_update_async_busy( &wall_fb ) );
+                TEST_CHECK( done_calls  == 1 );
+                TEST_CHECK( done_status == STATUS_OK );
+                TEST_CHECK( ram_matches( 0 ) );
+                TEST_CHECK( ram_matches( 1 ) );
+                TEST_CHECK( emulator[0].errors + emulator[1].errors == 0 );
+                
+                // nothing left to send
+                TEST_CHECK( framebuffer_wall_update_async( &wall_fb, on_done, &done_calls ) == STATUS_NO_CHANGE );
+                TEST_CHECK( done_calls == 1 );
+                
+                teardown( 2 );
+        }
+}
+
+int main (
+  void
+){
+        test_draw();
+        test_mounts();
+        test_update_async();
+        
+        return TEST_RESULT();
+}
@@ -0,0 +1,72 @@
+/**     \file   Benchmark_Display_main.c
+
+        \brief  Run the display benchmark on a host.
+ 
+        \license 
+                MIT: The MIT License (https://opensource.org/licenses/MIT)
+                .
+                Permission is hereby granted, free of charge, to any person obtaining a copy of this software 
+                and associated documentation files (the "Software"), to deal in the Software without restriction, 
+                including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+                and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, 
+                subject to the following conditions:
+                .
+                The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+                .
+                THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+                INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. 
+                IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+                WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR 
+                THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ 
+        \copyright
+                DIT: 2026; Drechsler Information Technologies; www.drechsler-it.de
+ 
+        \authors
+                jrgdre: Joerg Drechsler; DIT
+ 
+        \versions
+                1.0.0: 2026-10-17 jrgdre initial release
+
+ */
+#define _POSIX_C_SOURCE 199309L         // clock_gettime
+
+#include <stdio.h>                      // printf
+#include <time.h>                       // clock_gettime
+#include "Benchmark_Display.h"          // benchmark interface
+
+/**
+ * \brief Free running micro second counter of the host
+ */
+static uint32_t host_clock_us (
+  void
+){
+        struct timespec now;
+        
+        clock_gettime( CLOCK_MONOTONIC, &now );
+        
+        return (uint32_t)( ( (uint64_t)now.tv_sec * 1000000 ) + ( now.tv_nsec / 1000 ) );
+}
+
+int main (
+  void
+){
+        static enum SSD1306_Geometry const geometries[] = { SSD1306_GEOMETRY_128x32, SSD1306_GEOMETRY_128x64 };
+        
+        struct Benchmark_Display_Result results[BENCHMARK_DISPLAY_WORKLOADS];
+        
+        for( uint_fast8_t g = 0; g < sizeof( geometries ) / sizeof( geometries[0] ); g++ ){
+                enum status_code status = benchmark_display_run( geometries[g], host_clock_us, results, BENCHMARK_DISPLAY_WORKLOADS );
+                
+                printf( "128x%u\r\n", (unsigned)geometries[g] );    // the geometry is the number of lines
+                if( status != STATUS_OK ){
+                        printf( "benchmark failed: 0x%02x\r\n", status );
+                        return 1;
+                }
+                for( uint_fast8_t r = 0; r < BENCHMARK_DISPLAY_WORKLOADS; r++ ){
+                        benchmark_display_report( &results[r] );
+                }
+        }
+        
+        return 0;
+}
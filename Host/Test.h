@@ -0,0 +1,55 @@
+/**     \file   Test.h
+
+        \brief  Checks of the host tests.
+ 
+        \license 
+                MIT: The MIT License (https://opensource.org/licenses/MIT)
+                .
+                Permission is hereby granted, free of charge, to any person obtaining a copy of this software 
+                and associated documentation files (the "Software"), to deal in the Software without restriction, 
+                including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+                and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, 
+                subject to the following conditions:
+                .
+                The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+                .
+                THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+                INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. 
+                IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+                WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR 
+                THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ 
+        \copyright
+                DIT: 2026; Drechsler Information Technologies; www.drechsler-it.de
+ 
+        \authors
+                jrgdre: Joerg Drechsler; DIT
+ 
+        \versions
+                1.0.0: 2026-10-17 jrgdre initial release
+
+ */
+#ifndef HOST_TEST_H
+#define HOST_TEST_H
+
+#include <stdio.h>                      // printf
+
+static unsigned test_failures; //< number of checks failed, a test includes this header once
+
+/**
+ * \brief Check a condition, print it with its location, if it fails
+ */
+#define TEST_CHECK( expr ) \
+        do { \
+                if( !( expr ) ){ \
+                        printf( "%s:%d: check failed: %s\r\n", __FILE__, __LINE__, #expr ); \
+                        test_failures++; \
+                } \
+        } while( 0 )
+
+/**
+ * \brief Exit code of a test: 0, if all checks passed
+ */
+#define TEST_RESULT() ( test_failures == 0 ? 0 : 1 )
+
+#endif // HOST_TEST_H
@@ -0,0 +1,166 @@
+/**     \file   Queue.h
+
+        \brief  Declaration of typed, bounded ring queues on caller provided storage.
+ 
+        \license 
+                MIT: The MIT License (https://opensource.org/licenses/MIT)
+                .
+                Permission is hereby granted, free of charge, to any person obtaining a copy of this software 
+                and associated documentation files (the "Software"), to deal in the Software without restriction, 
+                including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+                and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, 
+                subject to the following conditions:
+                .
+                The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+                .
+                THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+                INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. 
+                IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+                WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR 
+                THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ 
+        \copyright
+                DIT: 2026; Drechsler Information Technologies; www.drechsler-it.de
+ 
+        \authors
+                jrgdre: Joerg Drechsler; DIT
+ 
+        \versions
+                1.0.0: 2026-10-17 jrgdre initial release
+
+ */
+#ifndef QUEUE_H
+#define QUEUE_H
+
+#include <asf.h>
+
+/**
+ * Declare a first-in first-out ring queue type \ref type_name for entries of \ref entry_type and the functions to use it:
+ *
+ *      prefix_init  ()  use an array as the storage of the queue
+ *      prefix_clear ()  remove all entries, keep the statistics
+ *      prefix_push  ()  append one entry to the queue
+ *      prefix_push_n()  append n entries to the queue, all or none
+ *      prefix_pop   ()  remove the oldest entry from the queue
+ *      prefix_pop_n ()  remove the n oldest entries from the queue, all or none
+ *
+ * Like the stacks of \ref STACK_DECLARE() the queue never allocates memory, records its high-water mark in
+ * \ref count_max and the rejected pushes in \ref overflows. Any capacity works, it doesn't have to be a power of 2.
+ *
+ * \code
+ *      QUEUE_DECLARE( Event_Queue, event_queue, struct Event )
+ *
+ *      static struct Event       event_entries[16];
+ *      static struct Event_Queue events = QUEUE_INITIALIZER( event_entries );
+ * \endcode
+ *
+ * \note The functions are not interrupt safe. If a queue is shared with an interrupt handler, the user has to
+ *       lock out the interrupt around the calls.
+ */
+#define QUEUE_DECLARE( type_name, prefix, entry_type )                                                          \
+                                                                                                                \
+struct type_name {                                                                                              \
+        entry_type *entries;            /*< storage of the queue */                                             \
+          uint32_t  capacity;           /*< number of entries that fit into entries */                          \
+          uint32_t  head;               /*< index of the oldest entry */                                        \
+          uint32_t  count;              /*< number of entries in the queue */                                   \
+          uint32_t  count_max;          /*< most entries ever in the queue (high-water mark) */                 \
+          uint32_t  overflows;          /*< number of pushes rejected, because the queue was full */            \
+};                                                                                                              \
+                                                                                                                \
+static inline enum status_code prefix##_init (                                                                  \
+  struct type_name *const queue                                                                                 \
+,       entry_type *const entries                                                                               \
+,         uint32_t  const capacity                                                                              \
+){                                                                                                              \
+        if(( queue == NULL ) || ( entries == NULL ) || ( capacity < 1 )){                                       \
+                return STATUS_ERR_INVALID_ARG;                                                                  \
+        }                                                                                                       \
+        queue->entries   = entries;                                                                             \
+        queue->capacity  = capacity;                                                                            \
+        queue->head      = 0;                                                                                   \
+        queue->count     = 0;                                                                                   \
+        queue->count_max = 0;                                                                                   \
+        queue->overflows = 0;                                                                                   \
+        return STATUS_OK;                                                                                       \
+}                                                                                                               \
+                                                                                                                \
+static inline void prefix##_clear (                                                                             \
+  struct type_name *const queue                                                                                 \
+){                                                                                                              \
+        queue->head  = 0;                                                                                       \
+        queue->count = 0;                                                                                       \
+}                                                                                                               \
+                                                                                                                \
+static inline enum status_code prefix##_push_n (                                                                \
+  struct type_name *const queue                                                                                 \
+, entry_type const *const entries                                                                               \
+,         uint32_t  const n                                                                                     \
+){                                                                                                              \
+        if(( queue == NULL ) || ( entries == NULL )){                                                           \
+                return STATUS_ERR_INVALID_ARG;                                                                  \
+        }                                                                                                       \
+        if( n > queue->capacity - queue->count ){                                                               \
+                queue->overflows++;                                                                             \
+                return STATUS_ERR_NO_MEMORY;                                                                    \
+        }                                                                                                       \
+        uint32_t tail = queue->head + queue->count; /* index of the next free entry */                          \
+        if( tail >= queue->capacity ){                                                                          \
+                tail -= queue->capacity;                                                                        \
+        }                                                                                                       \
+        for( uint32_t i = 0; i < n; i++ ){                                                                      \
+                queue->entries[tail] = entries[i];                                                              \
+                if( ++tail == queue->capacity ){                                                                \
+                        tail = 0;                                                                               \
+                }                                                                                               \
+        }                                                                                                       \
+        queue->count += n;                                                                                      \
+        if( queue->count > queue->count_max ){                                                                  \
+                queue->count_max = queue->count;                                                                \
+        }                                                                                                       \
+        return STATUS_OK;                                                                                       \
+}                                                                                                               \
+                                                                                                                \
+static inline enum status_code prefix##_push (                                                                  \
+  struct type_name *const queue                                                                                 \
+,       entry_type  const entry                                                                                 \
+){                                                                                                              \
+        return prefix##_push_n( queue, &entry, 1 );                                                             \
+}                                                                                                               \
+                                                                                                                \
+static inline enum status_code prefix##_pop_n (                                                                 \
+  struct type_name *const queue                                                                                 \
+,       entry_type *const entries                                                                               \
+,         uint32_t  const n                                                                                     \
+){                                                                                                              \
+        if(( queue == NULL ) || ( entries == NULL )){                                                           \
+                return STATUS_ERR_INVALID_ARG;                                                                  \
+        }                                                                                                       \
+        if( n > queue->count ){                                                                                 \
+                return STATUS_ERR_NOT_FOUND;                                                                    \
+        }                                                                                                       \
+        for( uint32_t i = 0; i < n; i++ ){                                                                      \
+                entries[i] = queue->entries[queue->head];                                                       \
+                if( ++queue->head == queue->capacity ){                                                         \
+                        queue->head = 0;                                                                        \
+                }                                                                                               \
+        }                                                                                                       \
+        queue->count -= n;                                                                                      \
+        return STATUS_OK;                                                                                       \
+}                                                                                                               \
+                                                                                                                \
+static inline enum status_code prefix##_pop (                                                                   \
+  struct type_name *const queue                                                                                 \
+,       entry_type *const entry                                                                                 \
+){                                                                                                              \
+        return prefix##_pop_n( queue, entry, 1 );                                                               \
+}
+
+/**
+ * Initializer for a queue declared with \ref QUEUE_DECLARE(), that uses the array \ref entries as its storage.
+ *
+ * \ref entries has to be an array (not a pointer), its size is the capacity of the queue.
+ */
+#define QUEUE_INITIALIZER( entries ) { (entries), sizeof( entries ) / sizeof( (entries)[0] ), 0, 0, 0, 0 }
+
+#endif
@@ -34,51 +34,280 @@
 #include "SSD1306.h"
 #include "Framebuffer_SSD1306.h"
 
-/**     
- * \brief  Write a sequence of bytes to the SSD1306
+/**
+ * \brief Check if the SSD1306 expects a control byte in front of every write, i.e. the bus has no data/command line
+ */
+static inline bool has_control_byte (
+  struct SSD1306 const *const ssd1306           //< data structure of the SSD1306 controller to check
+){
+        return ssd1306->com_driver.set_data_command == NULL;
+}
+
+/**
+ * \brief Get the bus cost model of the SSD1306, using the I2C or SPI model if none is configured
+ */
+static inline struct SSD1306_Bus_Cost get_bus_cost (
+  struct SSD1306 const *const ssd1306           //< data structure of the SSD1306 controller to get the cost model for
+){
+        struct SSD1306_Bus_Cost cost = ssd1306->bus_cost;
+        
+        if(( cost.transaction == 0 )
+        && ( cost.byte        == 0 )
+        ){
+                if( has_control_byte( ssd1306 ) ){
+                        cost.transaction = SSD1306_BUS_COST_I2C_TRANSACTION;
+                        cost.byte        = SSD1306_BUS_COST_I2C_BYTE;
+                } else {
+                        cost.transaction = SSD1306_BUS_COST_SPI_TRANSACTION;
+                        cost.byte        = SSD1306_BUS_COST_SPI_BYTE;
+                }
+        }
+        
+        return cost;
+}
+
+/**
+ * \brief Get the max. number of data bytes per bus transaction of the SSD1306
+ */
+static inline uint16_t get_data_burst_length (
+  struct SSD1306 const *const ssd1306           //< data structure of the SSD1306 controller to get the burst length for
+){
+        if(( ssd1306->data_burst_length < 1                             )
+        || ( ssd1306->data_burst_length > SSD1306_DATA_BURST_LENGTH_MAX )
+        ){
+                return SSD1306_DATA_BURST_LENGTH_MAX;
+        }
+        
+        return ssd1306->data_burst_length;
+}
+
+/**
+ * \brief Write a transaction to the SSD1306 and count it in its bus statistics
+ */
+static inline enum status_code bus_write_wait (
+  struct SSD1306 *const ssd1306                 //< data structure of the SSD1306 controller to write to
+,        uint8_t *const buffer                  //< bytes to write
+,       uint16_t  const length                  //< number of bytes to write
+){
+        ssd1306->transactions_written++;
+        ssd1306->bytes_written += length;
+        
+        return ssd1306->com_driver.write_wait( ssd1306->com_driver.com_module, ssd1306->address, buffer, length );
+}
+
+/**
+ * \brief Start an asynchronous write of a transaction to the SSD1306 and count it in its bus statistics
+ */
+static inline enum status_code bus_write_async (
+  struct SSD1306 *const ssd1306                 //< data structure of the SSD1306 controller to write to
+,        uint8_t *const buffer                  //< bytes to write, valid until on_done is called
+,       uint16_t  const length                  //< number of bytes to write
+,     Write_Done *const on_done                 //< called when the write is done
+,           void *const user_data               //< user data to pass to on_done
+){
+        ssd1306->transactions_written++;
+        ssd1306->bytes_written += length;
+        
+        return ssd1306->com_driver.write_async( ssd1306->com_driver.com_module, ssd1306->address, buffer, length, on_done, user_data );
+}
+
+/**
+ * \brief Check if commands in front of data are cheaper sent in the data transaction, than in a transaction of their own
  *
- * \asserts (ssd1306  != NULL)
- * \asserts (sequence != NULL)
+ * In the data transaction every command byte needs a control byte of its own.
  */
-static enum status_code ssd1306_sequence_write (
-         struct SSD1306 *const ssd1306          //< data structure of the SSD1306 controller to write the command sequence to
-, enum SSD1306_Datatype  const datatype         //< type of data to write
-,               uint8_t *const sequence         //< byte sequence to write
-,              uint16_t  const sequence_length  //< length of sequence
-) {
-        enum status_code status;
+static inline bool stream_mix_commands (
+  struct SSD1306_Bus_Cost const cost            //< bus cost model
+,                uint16_t const commands_length //< number of command bytes in front of the data
+){
+        return ( commands_length - 1 ) * cost.byte < cost.transaction;
+}
+
+/**
+ * \brief Put commands in front of a transaction to a SSD1306, that expects control bytes
+ *
+ * \return Number of bytes put into the buffer.
+ */
+static uint16_t stream_encode_commands (
+                  uint8_t       *const buffer           //< [out] transaction to put the commands in front of
+,                 uint8_t const *const commands         //< commands to put
+,                uint16_t        const commands_length  //< number of command bytes
+,                    bool        const mixed            //< true: data follows in the same transaction; false: commands only
+){
+        uint16_t length = 0;
         
-        Assert( ssd1306  != NULL );
-        Assert( sequence != NULL );
+        if( !mixed ){
+                buffer[length++] = SSD1306_COMMAND;     // all following bytes are commands
+                memcpy( &buffer[length], commands, commands_length );
+                
+                return length + commands_length;
+        }
         
-        if ( sequence_length < 1 ){
-                status = STATUS_OK;
-                goto done;
+        for( uint_fast16_t idx = 0; idx < commands_length; idx++ ){
+                buffer[length++] = SSD1306_COMMAND | SSD1306_CONTINUATION;
+                buffer[length++] = commands[idx];
+        }
+        
+        return length;
+}
+
+/**
+ * \brief Send the commands collected by a stream in a transaction of their own
+ *
+ * \asserts stream != NULL
+ */
+static enum status_code stream_commands_flush (
+  struct SSD1306_Stream *const stream           //< stream to send the commands of
+){
+        Assert( stream != NULL );
+        
+        struct SSD1306    *ssd1306         = stream->ssd1306;
+        struct Com_Driver  com_driver      = ssd1306->com_driver;
+        uint16_t           commands_length = stream->commands_length;
+        
+        if(( stream->status  != STATUS_OK )
+        || ( commands_length <  1         )
+        ){
+                return stream->status;
+        }
+        stream->commands_length = 0;
+        
+        if( !has_control_byte( ssd1306 ) ){
+                com_driver.set_data_command( com_driver.com_module, false );
+                stream->status = bus_write_wait( ssd1306, stream->commands, commands_length );
+                
+                return stream->status;
         }
         
-        struct Com_Driver  com_driver    = ssd1306->com_driver;
-        void              *com_module    = com_driver.com_module;
-        bool               send_stop_org = com_driver.get_send_stop( com_module ); // save module's original setting
+        uint8_t  buffer[SSD1306_STREAM_COMMANDS_MAX + 1];
+        uint16_t length = stream_encode_commands( buffer, stream->commands, commands_length, false );
+        
+        stream->status = bus_write_wait( ssd1306, buffer, length );
+        
+        return stream->status;
+};
 
-        com_driver.set_send_stop( com_module, false );  // do not release the i2c bus until finished sending the whole sequence
+/**
+ * \asserts stream  != NULL
+ * \asserts ssd1306 != NULL
+ */
+void ssd1306_stream_begin (
+  struct SSD1306_Stream *const stream           //< stream to start
+, struct SSD1306        *const ssd1306          //< configuration data structure for the controller to send the stream to
+){
+        Assert( stream  != NULL );
+        Assert( ssd1306 != NULL );
+        
+        struct Com_Driver com_driver = ssd1306->com_driver;
+        
+        stream->ssd1306         = ssd1306;
+        stream->status          = STATUS_OK;
+        stream->commands_length = 0;
+        stream->send_stop_org   = com_driver.get_send_stop( com_driver.com_module );    // save module's original setting
+        
+        com_driver.set_send_stop( com_driver.com_module, false );      // do not release the i2c bus until the stream ends
+};
 
-        uint8_t bytes[2];
+/**
+ * \asserts stream   != NULL
+ * \asserts commands != NULL
+ */
+enum status_code ssd1306_stream_command (
+  struct SSD1306_Stream *const stream           //< stream to add the commands to
+,               uint8_t *const commands         //< commands to add
+,              uint16_t  const length           //< number of command bytes
+){
+        Assert( stream   != NULL );
+        Assert( commands != NULL );
         
-        bytes[0] = datatype;
+        for( uint_fast16_t idx = 0; ( idx < length ) && ( stream->status == STATUS_OK ); idx++ ){
+                if( stream->commands_length >= SSD1306_STREAM_COMMANDS_MAX ){
+                        stream_commands_flush( stream );
+                }
+                stream->commands[ stream->commands_length++ ] = commands[idx];
+        }
         
-        // send the command sequence byte by byte
-        for( uint_fast32_t idx = 0; idx < sequence_length; idx++ ) {
-                bytes[1] = sequence[idx];
-                status = com_driver.write_wait( com_module, ssd1306->address, bytes, 2 );
-                if( status != STATUS_OK ) {
-                        goto done;
+        return stream->status;
+};
+
+/**
+ * \asserts stream != NULL
+ * \asserts data   != NULL
+ */
+enum status_code ssd1306_stream_data (
+  struct SSD1306_Stream *const stream           //< stream to send the data in
+,               uint8_t *const data             //< data to send
+,              uint16_t  const length           //< number of data bytes
+){
+        Assert( stream != NULL );
+        Assert( data   != NULL );
+        
+        struct SSD1306    *ssd1306    = stream->ssd1306;
+        struct Com_Driver  com_driver = ssd1306->com_driver;
+        
+        if(( stream->status != STATUS_OK )
+        || ( length         <  1         )
+        ){
+                return stream->status;
+        }
+        
+        if( !has_control_byte( ssd1306 ) ){
+                if( stream_commands_flush( stream ) == STATUS_OK ){
+                        com_driver.set_data_command( com_driver.com_module, true );
+                        stream->status = bus_write_wait( ssd1306, data, length );
+                }
+                return stream->status;
+        }
+        
+        uint8_t  burst[( 2 * SSD1306_STREAM_COMMANDS_MAX ) + 1 + SSD1306_DATA_BURST_LENGTH_MAX];
+        uint16_t burst_length_max = get_data_burst_length( ssd1306 );
+        uint16_t burst_length;
+        uint16_t head_length      = 0;                 // commands going along with the first burst
+        
+        if( stream->commands_length > 0 ){
+                if( stream_mix_commands( get_bus_cost( ssd1306 ), stream->commands_length ) ){
+                        head_length             = stream_encode_commands( burst, stream->commands, stream->commands_length, true );
+                        stream->commands_length = 0;
+                } else if( stream_commands_flush( stream ) != STATUS_OK ){
+                        return stream->status;
+                }
+        }
+        
+        // send the data sequence burst by burst
+        for( uint_fast32_t idx = 0; idx < length; idx += burst_length ) {
+                burst_length = length - idx;
+                if( burst_length > burst_length_max ){
+                        burst_length = burst_length_max;
+                }
+                burst[head_length] = SSD1306_DATA;
+                memcpy( &burst[head_length + 1], &data[idx], burst_length );
+                
+                stream->status = bus_write_wait( ssd1306, burst, head_length + 1 + burst_length );
+                if( stream->status != STATUS_OK ) {
+                        break;
                 }
+                head_length = 0;
         }
+        
+        return stream->status;
+};
 
-done:
-        ssd1306->com_driver.set_send_stop( com_module, send_stop_org ); // restore driver's original setting
-        ssd1306->com_driver.send_stop    ( com_module );                // release the i2c bus
-        return status;
+/**
+ * \asserts stream != NULL
+ */
+enum status_code ssd1306_stream_end (
+  struct SSD1306_Stream *const stream           //< stream to end
+){
+        Assert( stream != NULL );
+        
+        struct Com_Driver com_driver = stream->ssd1306->com_driver;
+        
+        stream_commands_flush( stream );
+        
+        com_driver.send_stop    ( com_driver.com_module );                        // release the i2c bus
+        com_driver.set_send_stop( com_driver.com_module, stream->send_stop_org ); // restore driver's original setting
+        
+        return stream->status;
 };
 
 /**
@@ -93,7 +322,12 @@ enum status_code ssd1306_command_sequence_write (
         Assert( ssd1306  != NULL );
         Assert( command_sequence != NULL );
         
-        return ssd1306_sequence_write( ssd1306, SSD1306_COMMAND, command_sequence, sequence_length );
+        struct SSD1306_Stream stream;
+        
+        ssd1306_stream_begin  ( &stream, ssd1306 );
+        ssd1306_stream_command( &stream, command_sequence, sequence_length );
+        
+        return ssd1306_stream_end( &stream );
 };
 
 /**
@@ -108,7 +342,12 @@ enum status_code ssd1306_data_sequence_write (
         Assert( ssd1306  != NULL );
         Assert( data_sequence != NULL );
         
-        return ssd1306_sequence_write( ssd1306, SSD1306_DATA, data_sequence, sequence_length );
+        struct SSD1306_Stream stream;
+        
+        ssd1306_stream_begin( &stream, ssd1306 );
+        ssd1306_stream_data ( &stream, data_sequence, sequence_length );
+        
+        return ssd1306_stream_end( &stream );
 };
 
 /**
@@ -148,7 +387,7 @@ enum status_code ssd1306_init (
                         break;
         }
         
-        #define SSD1306_INIT_SEQUENCE_LENGTH 25
+        #define SSD1306_INIT_SEQUENCE_LENGTH 26
 
         uint8_t init_sequence[SSD1306_INIT_SEQUENCE_LENGTH] = {
                 // display control
@@ -165,16 +404,18 @@ enum status_code ssd1306_init (
                 SSD1306_SET_MEMORY_ADRESSING_MODE           , SSD1306_ADDR_MODE_HORIZONTAL, // page 0 from col 0 to col 127, than page 1 from col 0 to col127 ->->-> (auto increment col, page)
                 SSD1306_SET_PAGE_ADRESSES                   , 0x00, pages - 1             , // initial page-range to send data to: start 
                 SSD1306_SET_COLUMN_ADRESSES                 , 0x00, width - 1             , // initial column to send data to
+                SSD1306_SET_DISPLAY_START_LINE | 0x00       ,                               // show display data RAM page 0 at the top
                 // fundamentals
                 SSD1306_SET_DISPLAY_RESUME_RAM              ,                               // show GDDRAM content on DISPLAY_ON
                 SSD1306_SET_DISPLAY_NORMAL                  ,                               // normal picture
                 SSD1306_SET_CONTRAST                        , contrast                    , // set an initial contrast value
         };
 
-        status = ssd1306_command_sequence_write( ssd1306, init_sequence, SSD1306_INIT_SEQUENCE_LENGTH );
-        if( status != STATUS_OK ){
-                goto done;
-        }
+        struct SSD1306_Stream stream;
+        
+        // the whole configuration goes out in one transaction
+        ssd1306_stream_begin  ( &stream, ssd1306 );
+        ssd1306_stream_command( &stream, init_sequence, SSD1306_INIT_SEQUENCE_LENGTH );
         
         if( ssd1306->flip_horizontal ){
                 #define SSD1306_HFLIP_SEQUENCE_LENGTH 1
@@ -183,10 +424,7 @@ enum status_code ssd1306_init (
                         SSD1306_SET_COM_OUTPUT_DIRECTION_REMAP
                 };
                 
-                status = ssd1306_command_sequence_write( ssd1306, hflip_sequence, SSD1306_HFLIP_SEQUENCE_LENGTH );
-                if( status != STATUS_OK ){
-                        goto done;
-                }
+                ssd1306_stream_command( &stream, hflip_sequence, SSD1306_HFLIP_SEQUENCE_LENGTH );
         }
         
         if( ssd1306->flip_vertical ){
@@ -196,11 +434,14 @@ enum status_code ssd1306_init (
                         SSD1306_SET_SEGMENT_REMAP
                 };
                 
-                status = ssd1306_command_sequence_write( ssd1306, vflip_sequence, SSD1306_VFLIP_SEQUENCE_LENGTH );
-                if( status != STATUS_OK ){
-                        goto done;
-                }
+                ssd1306_stream_command( &stream, vflip_sequence, SSD1306_VFLIP_SEQUENCE_LENGTH );
         }
+        
+        status = ssd1306_stream_end( &stream );
+        if( status != STATUS_OK ){
+                goto done;
+        }
+        ssd1306->page_origin = 0;
 
 done:        
         return status;
@@ -229,48 +470,246 @@ enum status_code ssd1306_display_on (
 };
 
 /**
- * \brief Send the page and column addresses of the next tile to write data to, to the FeatherWing
+ * \brief Get the display data RAM page a page of the display is shown from (see \ref ssd1306_scroll_pages())
+ */
+static inline uint8_t ram_page (
+  struct SSD1306 const *const ssd1306           //< data structure of the SSD1306 controller
+,              uint32_t const page              //< page of the display
+){
+        return ( page + ssd1306->page_origin ) % SSD1306_RAM_PAGES;
+}
+
+/**
+ * \brief Get the last display data RAM page, that data written from \ref page on may go to without wrapping around in the RAM
+ */
+static inline uint8_t ram_page_end (
+  struct SSD1306 const *const ssd1306           //< data structure of the SSD1306 controller
+,              uint32_t const page              //< page of the display written first
+){
+        uint32_t page_end = ram_page( ssd1306, page ) + ( ssd1306->geometry >> 3 ) - 1 - page;
+        
+        return page_end < SSD1306_RAM_PAGES ? page_end : SSD1306_RAM_PAGES - 1;
+}
+
+/**
+ * \brief Get the first tile shown from display data RAM page 0, if the display is scrolled by pages, otherwise \ref bytes
  *
- * \asserts (ssd1306 != NULL)
+ * The SSD1306 wraps to the start of the page range, not to page 0, so a run of tiles must not go across this tile.
+ */
+static inline uint32_t ram_wrap_tile (
+  struct SSD1306 const *const ssd1306           //< data structure of the SSD1306 controller
+,              uint32_t const columns           //< number of columns per page
+,              uint32_t const bytes             //< number of tiles
+){
+        uint32_t page = ( SSD1306_RAM_PAGES - ssd1306->page_origin ) % SSD1306_RAM_PAGES; // page of the display shown from RAM page 0
+        uint32_t tile = page * columns;
+        
+        return (( page == 0 ) || ( tile >= bytes )) ? bytes : tile;
+}
+
+/**
+ * \brief Add the page and column addresses of the next tile to write data to, to the stream to the FeatherWing
+ *
+ * \asserts (stream != NULL)
  */
 static enum status_code set_tile_next (
-  struct SSD1306 *const ssd1306                 //< data structure of the SSD1306 controller to write the command  to
-,        uint8_t  const page_start              //< first column to write next data byte to
-,        uint8_t  const column_start            //< first column to write next data byte to
+  struct SSD1306_Stream *const stream           //< stream to the SSD1306 controller to add the commands to
+,               uint8_t  const page_start       //< first page of the display to write next data byte to
+,               uint8_t  const column_start     //< first column to write next data byte to
 ){
-        Assert( ssd1306 != NULL );
+        Assert( stream != NULL );
+        
+        #define SSD1306_SET_TILE_NEXT_SEQUENCE_LENGTH 6
         
-        uint8_t page_end   = (ssd1306->geometry >> 3) - 1;
-        uint8_t column_end = 127;
+        uint8_t sequence[SSD1306_SET_TILE_NEXT_SEQUENCE_LENGTH] = {
+                SSD1306_SET_PAGE_ADRESSES  , ram_page( stream->ssd1306, page_start ), ram_page_end( stream->ssd1306, page_start ),
+                SSD1306_SET_COLUMN_ADRESSES, column_start                          , SSD1306_COLUMNS - 1
+        };
         
-        return ssd1306_set_page_range  ( ssd1306, page_start  , page_end   )
-            || ssd1306_set_column_range( ssd1306, column_start, column_end );
+        return ssd1306_stream_command( stream, sequence, SSD1306_SET_TILE_NEXT_SEQUENCE_LENGTH );
 };
 
 /**
- * \brief Returns the tiles dirty threshold base on the display geometry
+ * \brief Send a run of consecutive tiles of the framebuffer to the SSD1306
+ *
+ * The run may span multiple pages, since the SSD1306 wraps to the next page
+ * at the end of the column range in horizontal addressing mode.
+ * It wraps to the start of the column range though, so a run starting in the middle
+ * of a page has its column range reset to the full width, once the first page is done.
+ *
+ * \asserts (ssd1306    != NULL)
+ * \asserts (fb_ssd1306 != NULL)
  */
-inline static uint32_t get_tiles_dirty_threshold( 
-  enum SSD1306_Geometry geometry 
+static enum status_code tile_run_write (
+  struct SSD1306_Stream      *const stream      //< stream to the SSD1306 controller to write the run to
+, struct Framebuffer_SSD1306 *const fb_ssd1306  //< framebuffer holding the tiles to send
+,                   uint32_t  const tile_idx    //< index of the first tile of the run
+,                   uint32_t  const run_length  //< number of tiles in the run
 ){
-        uint32_t result;
+        Assert( stream     != NULL );
+        Assert( fb_ssd1306 != NULL );
         
-        switch ( geometry ) {
-                case SSD1306_GEOMETRY_128x32:
-                        result = 147;
-                        break;
-                case SSD1306_GEOMETRY_128x64:
-                        result = 294;
-                        break;
+        uint32_t tile_wrap    = ram_wrap_tile( stream->ssd1306, fb_ssd1306->columns, fb_ssd1306->bytes );
+        
+        if(( tile_idx              <  tile_wrap )
+        && ( tile_idx + run_length >  tile_wrap )
+        ){
+                // the part of the run shown from the start of the display data RAM has to be addressed on its own
+                enum status_code status = tile_run_write( stream, fb_ssd1306, tile_idx, tile_wrap - tile_idx );
+
+                if( status != STATUS_OK ){
+                        return status;
+                }
+                return tile_run_write( stream, fb_ssd1306, tile_wrap, tile_idx + run_length - tile_wrap );
+        }
+        
+        uint32_t column_start = tile_idx % fb_ssd1306->columns;
+        uint32_t head_length  = fb_ssd1306->columns - column_start;     // tiles of the run up to the end of the first page, or the whole run
+        enum status_code status;
+        
+        status = set_tile_next( stream, tile_idx / fb_ssd1306->columns, column_start ); // tell the ssd1306 which tile comes next
+        if( status != STATUS_OK ){
+                return status;
+        }
+        
+        if(( column_start == 0          )
+        || ( run_length   <= head_length )
+        ){
+                head_length = run_length;
+        }
+        
+        status = ssd1306_stream_data( stream, &fb_ssd1306->tiles[tile_idx], head_length );
+        if( status != STATUS_OK ){
+                return status;
         }
+        framebuffer_ssd1306_shadow_update( fb_ssd1306, tile_idx, &fb_ssd1306->tiles[tile_idx], head_length );
+        
+        if( head_length == run_length ){
+                return STATUS_OK;
+        }
+        
+        // the ssd1306 wraps to the start of the column range, not to column 0,
+        // so the part of the run on the following pages needs the full column range
+        #define SSD1306_COLUMN_RESET_SEQUENCE_LENGTH 3
+        
+        uint8_t sequence[SSD1306_COLUMN_RESET_SEQUENCE_LENGTH] = {
+                SSD1306_SET_COLUMN_ADRESSES, 0, SSD1306_COLUMNS - 1     // page address already points to the next page
+        };
+        
+        status = ssd1306_stream_command( stream, sequence, SSD1306_COLUMN_RESET_SEQUENCE_LENGTH );
+        if( status != STATUS_OK ){
+                return status;
+        }
+        
+        status = ssd1306_stream_data( stream, &fb_ssd1306->tiles[tile_idx + head_length], run_length - head_length );
+        if( status != STATUS_OK ){
+                return status;
+        }
+        framebuffer_ssd1306_shadow_update( fb_ssd1306, tile_idx + head_length, &fb_ssd1306->tiles[tile_idx + head_length], run_length - head_length );
+        
+        return STATUS_OK;
+};
 
-        return result;
+/**
+ * \brief Get the modeled cost of commands sent in front of data, as done by \ref ssd1306_stream_data()
+ *
+ * With control bytes the commands go into the data transaction, if that's cheaper, otherwise they are sent
+ * in a transaction of their own behind one SSD1306_COMMAND control byte.
+ * On a bus with a data/command line they are sent in a write of their own.
+ */
+static inline uint32_t get_cost_commands (
+  struct SSD1306_Bus_Cost const cost            //< bus cost model
+,                    bool const control_byte    //< true: a control byte is sent in front of every write
+,                uint16_t const length          //< number of command bytes
+){
+        if( !control_byte ){
+                return cost.transaction + ( length * cost.byte );
+        }
+        if( stream_mix_commands( cost, length ) ){
+                return 2 * length * cost.byte;
+        }
+        
+        return cost.transaction + (( 1 + length ) * cost.byte );
 }
 
 /**
- * \asserts ssd1306                       != NULL
- * \asserts ssd1306.com_driver            != NULL
- * \asserts ssd1306.com_driver.com_module != NULL
+ * \brief Get the modeled cost of addressing a tile run, as done by \ref set_tile_next()
+ *
+ * Page and column range are 3 byte commands each.
+ */
+static inline uint32_t get_cost_tile_address (
+  struct SSD1306_Bus_Cost const cost            //< bus cost model
+,                    bool const control_byte    //< true: a control byte is sent in front of every write
+){
+        return get_cost_commands( cost, control_byte, 6 );
+}
+
+/**
+ * \brief Get the modeled cost of resetting the column range of a run, that wraps to the next page, as done by \ref tile_run_write()
+ */
+static inline uint32_t get_cost_tile_wrap (
+  struct SSD1306_Bus_Cost const cost            //< bus cost model
+,                    bool const control_byte    //< true: a control byte is sent in front of every write
+){
+        return get_cost_commands( cost, control_byte, 3 );
+}
+
+/**
+ * \brief Check if a run starts in the middle of a page and continues on the next page
+ */
+static inline bool tile_run_wraps (
+                   uint32_t const columns       //< number of columns per page
+,                  uint32_t const tile_idx      //< index of the first tile of the run
+,                  uint32_t const run_length    //< number of tiles in the run
+){
+        uint32_t column_start = tile_idx % columns;
+        
+        return ( column_start != 0 ) && ( run_length > columns - column_start );
+}
+
+/**
+ * \brief Get the modeled cost of sending the data of a tile run, as done by \ref ssd1306_stream_data()
+ */
+static inline uint32_t get_cost_tile_data (
+  struct SSD1306_Bus_Cost const cost            //< bus cost model
+,                    bool const control_byte    //< true: a control byte is sent in front of every write
+,                uint16_t const burst_length    //< max. data bytes per transaction
+,                uint32_t const run_length      //< number of tiles in the run
+){
+        uint32_t bursts = ( run_length + burst_length - 1 ) / burst_length;
+        
+        return ( bursts * ( cost.transaction + ( control_byte ? cost.byte : 0 ) ) ) + ( run_length * cost.byte );
+}
+
+/**
+ * \brief Get the modeled cost of sending a tile run with its addressing, as done by \ref tile_run_write()
+ *
+ * A run wrapping to the next page is sent in two parts, with the column range reset in between.
+ */
+static inline uint32_t get_cost_tile_run (
+  struct SSD1306_Bus_Cost const cost            //< bus cost model
+,                    bool const control_byte    //< true: a control byte is sent in front of every write
+,                uint16_t const burst_length    //< max. data bytes per transaction
+,                uint32_t const columns         //< number of columns per page
+,                uint32_t const tile_idx        //< index of the first tile of the run
+,                uint32_t const run_length      //< number of tiles in the run
+){
+        uint32_t result = get_cost_tile_address( cost, control_byte );
+        
+        if( !tile_run_wraps( columns, tile_idx, run_length ) ){
+                return result + get_cost_tile_data( cost, control_byte, burst_length, run_length );
+        }
+        
+        uint32_t head_length = columns - ( tile_idx % columns );
+        
+        return result + get_cost_tile_data( cost, control_byte, burst_length, head_length )
+                      + get_cost_tile_wrap( cost, control_byte )
+                      + get_cost_tile_data( cost, control_byte, burst_length, run_length - head_length );
+}
+
+/**
+ * \asserts ssd1306                        != NULL
+ * \asserts ssd1306->com_driver.com_module != NULL
  *
  * \asserts framebuffer                          != NULL
  * \asserts framebuffer->user_data               != NULL
@@ -282,12 +721,8 @@ enum status_code ssd1306_display_update_all (
   struct SSD1306     *const ssd1306             //< data structure of the SSD1306 controller to write the update to
 , struct Framebuffer *const framebuffer         //< framebuffer holding the data to display on the OLED
 ){
-        Assert( ssd1306                       != NULL );
-        Assert( ssd1306.com_driver            != NULL );
-        Assert( ssd1306.com_driver.com_module != NULL );
-        
-        struct Com_Driver com_driver = ssd1306->com_driver  ;
-        void             *com_module = com_driver.com_module;
+        Assert( ssd1306                        != NULL );
+        Assert( ssd1306->com_driver.com_module != NULL );
         
         Assert( framebuffer->user_data  != NULL );
         
@@ -297,44 +732,27 @@ enum status_code ssd1306_display_update_all (
         Assert( fb_ssd1306->tiles       != NULL );
         Assert( fb_ssd1306->tiles_dirty != NULL );
         
-                    bool  send_stop_org = com_driver.get_send_stop( com_module );
-        enum status_code  status        = STATUS_ERR_NOT_INITIALIZED;
-                uint32_t  tile_idx      = 0;
+        struct SSD1306_Stream  stream;
+        enum status_code       status   = STATUS_ERR_NOT_INITIALIZED;
 
-        com_driver.set_send_stop( com_module, false );  // do not release the i2c bus until finished sending all the tiles
+        ssd1306_stream_begin( &stream, ssd1306 );       // do not release the i2c bus until finished sending all the tiles
 
-        // we use a while loop to break if there is an error and still be able to perform some cleanup
-        while( status != STATUS_OK ) {
-                // initialize the [page,column] start point for the update
-                status = set_tile_next( ssd1306, 0x00, 0x00 );
-                if( status != STATUS_OK ){
-                        goto done;
-                }
-                // send the fb_ssd1306 byte by byte
-                for( uint_fast16_t page=0; page < fb_ssd1306->pages; page++ ) {
-                        for( uint_fast16_t column=0; column < fb_ssd1306->columns; column++ ) {
-                                tile_idx = (page*fb_ssd1306->columns) + column;
-                                status   = ssd1306_data_sequence_write( ssd1306, &fb_ssd1306->tiles[tile_idx], 1);
-                                if( status != STATUS_OK ) {
-                                        goto done;
-                                }
-                        }
-                }
-                memset( (void *)fb_ssd1306->tiles_dirty, 0x00, fb_ssd1306->bytes >> 3 ); // mark all tiles as clean
-                fb_ssd1306->tiles_dirty_count = 0;
+        // send the whole framebuffer as one run, starting at [page,column] = [0,0]
+        status = tile_run_write( &stream, fb_ssd1306, 0, fb_ssd1306->bytes );
+        if( status != STATUS_OK ){
+                goto done;
         }
+        framebuffer_ssd1306_mark_clean_range( fb_ssd1306, 0, fb_ssd1306->bytes ); // mark all tiles as clean
 
 done:
-        com_driver.send_stop    ( com_module );                 // release i2c bus
-        com_driver.set_send_stop( com_module, send_stop_org );  // restore original setting
+        ssd1306_stream_end( &stream );                  // release i2c bus
         
         return status;
 };
 
 /**
- * \asserts ssd1306                       != NULL
- * \asserts ssd1306.com_driver            != NULL
- * \asserts ssd1306.com_driver.com_module != NULL
+ * \asserts ssd1306                        != NULL
+ * \asserts ssd1306->com_driver.com_module != NULL
  *
  * \asserts framebuffer                          != NULL
  * \asserts framebuffer->user_data               != NULL
@@ -346,12 +764,8 @@ enum status_code ssd1306_display_update_differential (
   struct SSD1306     *const ssd1306             //< data structure of the SSD1306 controller to write the update to
 , struct Framebuffer *const framebuffer         //< framebuffer holding the data to display on the OLED
 ){
-        Assert( ssd1306                       != NULL );
-        Assert( ssd1306.com_driver            != NULL );
-        Assert( ssd1306.com_driver.com_module != NULL );
-        
-        struct Com_Driver com_driver = ssd1306->com_driver  ;
-        void             *com_module = com_driver.com_module;
+        Assert( ssd1306                        != NULL );
+        Assert( ssd1306->com_driver.com_module != NULL );
         
         Assert( framebuffer->user_data   != NULL );
         
@@ -361,66 +775,161 @@ enum status_code ssd1306_display_update_differential (
         Assert( fb_ssd1306->tiles       != NULL );
         Assert( fb_ssd1306->tiles_dirty != NULL );
         
-                    bool  send_stop_org        = com_driver.get_send_stop( com_module );
-        enum status_code  status               = STATUS_ERR_NOT_INITIALIZED;
+        struct SSD1306_Stream  stream;
+        enum status_code       status          = STATUS_OK;
         
-                uint16_t  tiles_dirty_byte_idx = 0;                                             // 1 bit per tile in tiles_dirty
-                 uint8_t  tiles_dirty_bit_idx  = 0;                                             // bit position of tile in tiles_dirty index byte
-                uint32_t  tile_idx             = 0;                                             // tile the pixel is in
-                uint32_t  tile_idx_prev        = 0;                                             // idx of the tile update last
-                    bool  tile_is_dirty        = false;                                         // current value
-                    bool  error                = false;                                         // true if an error occurred during processing
+                uint32_t  run_start            = 0;                                             // first tile of the current run of dirty tiles
+                uint32_t  run_end              = 0;                                             // tile behind the current run of dirty tiles
 
-        com_driver.set_send_stop( com_module, false ); // do not release the i2c bus until finished sending all the tiles
+        framebuffer_ssd1306_shadow_filter( fb_ssd1306 );                                        // don't send tiles the display already shows
+        
+        ssd1306_stream_begin( &stream, ssd1306 );       // do not release the i2c bus until finished sending all the tiles
 
-        // we use a while loop to break if there is an error and still be able to perform some cleanup
-        while( status != STATUS_OK ) {
-                // send the dirty tiles byte by byte
-                for( uint_fast16_t page=0; page < fb_ssd1306->pages; page++ ) {
-                        for( uint_fast16_t column=0; column < fb_ssd1306->columns; column++ ) {
-                                tile_idx             = ( page * fb_ssd1306->columns ) + column; // tile the pixel is in
-                                tiles_dirty_byte_idx = tile_idx >> 3;                           // 1 bit per tile in tiles_dirty
-                                tiles_dirty_bit_idx  = tile_idx % (tiles_dirty_byte_idx << 3);  // bit position of tile in tiles_dirty_idx byte
-                                
-                                tile_is_dirty        = \
-                                        ( fb_ssd1306->tiles_dirty[ tiles_dirty_byte_idx ] & ( 0x1 << tiles_dirty_bit_idx ) ) >> tiles_dirty_bit_idx; // current value
-                                        
-                                if( tile_is_dirty ){                                                    // tile marked as dirty
-                                        if(( tile_idx      == 0          )                              // first tile
-                                        || ( tile_idx_prev != tile_idx-1 )                              // we skipped one or more tiles in the meantime
-                                        ){
-                                                status = set_tile_next( ssd1306, page, column );        // tell the ssd1306 which tile comes next
-                                                if( status != STATUS_OK ){
-                                                        goto done;
-                                                }
-                                        }
-                                        status = ssd1306_data_sequence_write( ssd1306, &fb_ssd1306->tiles[(page*fb_ssd1306->columns) + column], 1);
-                                        if( status != STATUS_OK ) {
-                                                goto done;
-                                        }
-                                        fb_ssd1306->tiles_dirty[ tiles_dirty_byte_idx ] &= ~( 0x1 << tiles_dirty_bit_idx ); // tile is clean now
-                                        fb_ssd1306->tiles_dirty_count--;                                                    // decrease dirty tiles count
-                                        if( fb_ssd1306->tiles_dirty_count < 1 ){
-                                                goto done;                                                                  // nothing left to do
-                                        }
-                                        tile_idx_prev = tile_idx;
-                                }
-                        }
-                        if(( error )
-                        || ( fb_ssd1306->tiles_dirty_count < 1 )        // nothing left to do
-                        ){
-                                break;
-                        }
+        // find runs of consecutive dirty tiles a word of the dirty map at a time and send each run in one data sequence
+        for( run_start = framebuffer_ssd1306_dirty_find( fb_ssd1306->tiles_dirty, fb_ssd1306->bytes, 0, true );
+             run_start < fb_ssd1306->bytes;
+             run_start = framebuffer_ssd1306_dirty_find( fb_ssd1306->tiles_dirty, fb_ssd1306->bytes, run_end, true )
+        ){
+                run_end = framebuffer_ssd1306_dirty_find( fb_ssd1306->tiles_dirty, fb_ssd1306->bytes, run_start, false );
+                
+                status = tile_run_write( &stream, fb_ssd1306, run_start, run_end - run_start );
+                if( status != STATUS_OK ){
+                        // the tiles of this run are lost for the display, make sure the next update resends everything
+                        framebuffer_ssd1306_mark_dirty_range( fb_ssd1306, 0, fb_ssd1306->bytes );
+                        goto done;
                 }
+                framebuffer_ssd1306_mark_clean_range( fb_ssd1306, run_start, run_end - run_start ); // tiles are clean now
         }
 
 done:
-        com_driver.send_stop    ( com_module );                 // release i2c bus
-        com_driver.set_send_stop( com_module , send_stop_org ); // restore original setting
+        ssd1306_stream_end( &stream );                  // release i2c bus
                 
         return status;
 };
   
+/**
+ * \brief Plan the tile runs to send for the dirty tiles of a dirty tiles map
+ *
+ * \see ssd1306_update_plan()
+ */
+static uint16_t update_plan_map (
+  struct SSD1306              const *const ssd1306          //< data structure of the SSD1306 controller to plan the update for
+,                    uint32_t        const columns          //< number of columns per page
+,                    uint32_t        const bytes            //< number of tiles
+, framebuffer_ssd1306_dirty_t const *const tiles_dirty_map  //< dirty tiles map to plan with (1 bit per tile)
+,                    uint32_t       *const tile_idx         //< [in/out] tile to start the scan at, tile to continue the scan at
+, struct SSD1306_Tile_Run           *const runs             //< [out] runs planned
+,                    uint16_t        const runs_max         //< max. number of runs to plan
+){
+        struct SSD1306_Bus_Cost cost    = get_bus_cost( ssd1306 );
+        bool                    control = has_control_byte( ssd1306 );
+        
+        // a gap of clean tiles is sent along, if that is cheaper than starting a new run:
+        // addressing the run and starting a new data transaction
+        uint32_t const cost_run_new = get_cost_tile_address( cost, control ) + cost.transaction + ( control ? cost.byte : 0 );
+        
+        uint16_t runs_count = 0;
+        uint32_t idx        = framebuffer_ssd1306_dirty_find( tiles_dirty_map, bytes, *tile_idx, true );
+        uint32_t tile_wrap  = ram_wrap_tile( ssd1306, columns, bytes ); // runs end in front of it
+        
+        while( idx < bytes ){
+                uint32_t idx_end = framebuffer_ssd1306_dirty_find( tiles_dirty_map, bytes, idx, false ); // behind the consecutive dirty tiles
+                
+                if(( idx < tile_wrap ) && ( idx_end > tile_wrap )){
+                        idx_end = tile_wrap;
+                }
+                
+                // extend the current run or start a new one
+                if( runs_count > 0 ){
+                        struct SSD1306_Tile_Run *run = &runs[ runs_count - 1 ];
+                        uint32_t                 gap = idx - ( run->tile_idx + run->length );
+                        
+                        uint32_t cost_gap = gap * cost.byte;
+                        
+                        if(( !tile_run_wraps( columns, run->tile_idx, run->length            ) )
+                        && (  tile_run_wraps( columns, run->tile_idx, idx_end - run->tile_idx ) )
+                        ){
+                                cost_gap += get_cost_tile_wrap( cost, control )  // extending the run makes it wrap: a column range reset
+                                          +  cost.transaction + ( control ? cost.byte : 0 ); // and the data of the next page in a new transaction
+                        }
+                        if(( cost_gap < cost_run_new )
+                        && (( run->tile_idx < tile_wrap ) == ( idx < tile_wrap ))
+                        ){
+                                run->length = idx_end - run->tile_idx;
+                                idx         = framebuffer_ssd1306_dirty_find( tiles_dirty_map, bytes, idx_end, true );
+                                continue;
+                        }
+                }
+                if( runs_count >= runs_max ){
+                        break;                                  // no space left for a new run, continue from here next time
+                }
+                runs[ runs_count ].tile_idx = idx;
+                runs[ runs_count ].length   = idx_end - idx;
+                runs_count++;
+                idx = framebuffer_ssd1306_dirty_find( tiles_dirty_map, bytes, idx_end, true );
+        }
+        
+        *tile_idx = idx;
+        
+        return runs_count;
+};
+
+/**
+ * \asserts ssd1306                              != NULL
+ * \asserts framebuffer                          != NULL
+ * \asserts framebuffer->user_data               != NULL
+ * \asserts tile_idx                             != NULL
+ * \asserts runs                                 != NULL
+ */
+uint16_t ssd1306_update_plan (
+  struct SSD1306          const *const ssd1306          //< data structure of the SSD1306 controller to plan the update for
+, struct Framebuffer            *const framebuffer      //< framebuffer holding the dirty tiles
+,                uint32_t       *const tile_idx         //< [in/out] tile to start the scan at, tile to continue the scan at
+, struct SSD1306_Tile_Run       *const runs             //< [out] runs planned
+,                uint16_t        const runs_max         //< max. number of runs to plan
+){
+        Assert( ssd1306                != NULL );
+        Assert( framebuffer            != NULL );
+        Assert( framebuffer->user_data != NULL );
+        Assert( tile_idx               != NULL );
+        Assert( runs                   != NULL );
+        
+        struct Framebuffer_SSD1306 *fb_ssd1306 = (struct Framebuffer_SSD1306 *)framebuffer->user_data;
+        
+        return update_plan_map( ssd1306, fb_ssd1306->columns, fb_ssd1306->bytes, fb_ssd1306->tiles_dirty, tile_idx, runs, runs_max );
+};
+
+/**
+ * \asserts ssd1306                != NULL
+ * \asserts framebuffer            != NULL
+ * \asserts framebuffer->user_data != NULL
+ * \asserts runs                   != NULL
+ */
+uint32_t ssd1306_update_plan_cost (
+  struct SSD1306          const *const ssd1306          //< data structure of the SSD1306 controller the runs are planned for
+, struct Framebuffer      const *const framebuffer      //< framebuffer the runs are planned for
+, struct SSD1306_Tile_Run const *const runs             //< runs planned
+,                uint16_t        const runs_count       //< number of runs planned
+){
+        Assert( ssd1306                != NULL );
+        Assert( framebuffer            != NULL );
+        Assert( framebuffer->user_data != NULL );
+        Assert( runs                   != NULL );
+        
+        struct Framebuffer_SSD1306 const *fb_ssd1306 = (struct Framebuffer_SSD1306 const *)framebuffer->user_data;
+        
+        struct SSD1306_Bus_Cost cost         = get_bus_cost( ssd1306 );
+        bool                    control      = has_control_byte( ssd1306 );
+        uint16_t                burst_length = get_data_burst_length( ssd1306 );
+        uint32_t                result       = 0;
+        
+        for( uint_fast16_t idx = 0; idx < runs_count; idx++ ){
+                result += get_cost_tile_run( cost, control, burst_length, fb_ssd1306->columns, runs[idx].tile_idx, runs[idx].length );
+        }
+        
+        return result;
+};
+
 /**
  * \asserts ssd1306                              != NULL
  *
@@ -445,25 +954,557 @@ enum status_code ssd1306_display_update (
         Assert( fb_ssd1306->tiles       != NULL );
         Assert( fb_ssd1306->tiles_dirty != NULL );
         
-        enum status_code status;
+        framebuffer_ssd1306_shadow_filter( fb_ssd1306 );        // don't send tiles the display already shows
         
         if ( fb_ssd1306->tiles_dirty_count < 1 ){               // nothing to do
-                status = STATUS_OK; 
-                goto done;              
+                return STATUS_OK; 
         }
         
-        uint32_t tiles_dirty_threshold = get_tiles_dirty_threshold( ssd1306->geometry );
+        struct SSD1306_Stream    stream;
+        enum status_code         status        = STATUS_OK;
+        struct SSD1306_Tile_Run  runs[SSD1306_UPDATE_PLAN_RUNS_MAX];
+        uint16_t                 runs_count;
+        uint32_t                 tile_idx      = 0;
         
-        if( fb_ssd1306->tiles_dirty_count > tiles_dirty_threshold ) {                   
-                status = ssd1306_display_update_all         ( ssd1306, framebuffer );
-        } else {                                                                        // if the number of tiles dirty is greater than the threshold
-                status = ssd1306_display_update_differential( ssd1306, framebuffer );   // it is faster to send the whole buffer
-        }
+        ssd1306_stream_begin( &stream, ssd1306 );       // do not release the i2c bus until finished sending all the tiles
+        
+        // plan and send the runs, a plan at a time
+        do {
+                runs_count = ssd1306_update_plan( ssd1306, framebuffer, &tile_idx, runs, SSD1306_UPDATE_PLAN_RUNS_MAX );
+                
+                for( uint_fast16_t idx = 0; idx < runs_count; idx++ ){
+                        status = tile_run_write( &stream, fb_ssd1306, runs[idx].tile_idx, runs[idx].length );
+                        if( status != STATUS_OK ){
+                                // don't know what made it to the display, make sure the next update resends everything
+                                framebuffer_ssd1306_mark_dirty_range( fb_ssd1306, 0, fb_ssd1306->bytes );
+                                goto done;
+                        }
+                        framebuffer_ssd1306_mark_clean_range( fb_ssd1306, runs[idx].tile_idx, runs[idx].length );
+                }
+        } while( runs_count == SSD1306_UPDATE_PLAN_RUNS_MAX );
+        
+        fb_ssd1306->tiles_dirty_count = 0; // all tiles have been scanned and sent
 
 done:
+        ssd1306_stream_end( &stream );                  // release i2c bus
+        
+        return status;
+};
+
+/**
+ * \brief Start the next write of an asynchronous update
+ *
+ * Sends the addressing commands of the current run, then its data in bursts,
+ * then plans the next run from the snapshot of the dirty tiles.
+ *
+ * \return Status of operation.
+ * \retval STATUS_OK            If the next write was started
+ * \retval STATUS_NO_CHANGE     If all runs have been sent
+ * \retval any                  Status of the com driver
+ */
+static enum status_code update_async_next (
+  struct SSD1306_Update_Async *const update     //< state of the update
+);
+
+/**
+ * \brief Finish an asynchronous update: release the bus and tell the user
+ */
+static void update_async_done (
+  struct SSD1306_Update_Async *const update     //< state of the update
+,            enum status_code  const status     //< status of the update
+){
+        struct Com_Driver com_driver = update->ssd1306->com_driver;
+        
+        com_driver.send_stop    ( com_driver.com_module );                         // release i2c bus
+        com_driver.set_send_stop( com_driver.com_module, update->send_stop_org );  // restore original setting
+        
+        update->status = status;
+        update->busy   = false;
+        
+        if( update->on_done != NULL ){
+                update->on_done( update->user_data, status );
+        }
+};
+
+/**
+ * \brief Completion handler of the writes of an asynchronous update
+ */
+static void update_async_on_write_done (
+  void             *const user_data             //< state of the update
+, enum status_code  const status                //< status of the write
+){
+        struct SSD1306_Update_Async *update = (struct SSD1306_Update_Async *)user_data;
+        enum status_code             result = status;
+        
+        if( result == STATUS_OK ){
+                if( update->burst_length > 0 ){         // a data burst made it to the display
+                        framebuffer_ssd1306_shadow_update( (struct Framebuffer_SSD1306 *)update->framebuffer->user_data, update->burst_tile_idx, &update->buffer[ update->burst_offset ], update->burst_length );
+                }
+                result = update_async_next( update );
+                if( result == STATUS_OK ){
+                        return;                         // next write is in flight
+                }
+                if( result == STATUS_NO_CHANGE ){
+                        result = STATUS_OK;             // all runs sent
+                }
+        }
+        
+        update_async_done( update, result );
+};
+
+static enum status_code update_async_next (
+  struct SSD1306_Update_Async *const update     //< state of the update
+){
+        struct SSD1306             *ssd1306    = update->ssd1306;
+        struct Framebuffer_SSD1306 *fb_ssd1306 = (struct Framebuffer_SSD1306 *)update->framebuffer->user_data;
+        struct Com_Driver           com_driver = ssd1306->com_driver;
+        
+        for( ;; ){
+                // addressing commands in a write of their own, or along with the next data burst, 
+                // as ssd1306_stream_data() does
+                uint8_t commands_length = update->commands_count - update->commands_sent;
+                
+                if(( commands_length > 0 )
+                && (( !has_control_byte( ssd1306 ) ) || ( !stream_mix_commands( get_bus_cost( ssd1306 ), commands_length ) ))
+                ){
+                        update->burst_length  = 0;
+                        update->commands_sent = update->commands_count;
+                        
+                        if( !has_control_byte( ssd1306 ) ){
+                                memcpy( &update->buffer[1], &update->commands[ update->commands_count - commands_length ], commands_length );
+                                com_driver.set_data_command( com_driver.com_module, false );
+                                
+                                return bus_write_async( ssd1306, &update->buffer[1], commands_length, update_async_on_write_done, update );
+                        }
+                        
+                        uint16_t length = stream_encode_commands( update->buffer, &update->commands[ update->commands_count - commands_length ], commands_length, false );
+                        
+                        return bus_write_async( ssd1306, update->buffer, length, update_async_on_write_done, update );
+                }
+                
+                // tile data, a burst per write
+                uint16_t run_end = ( update->run_wrap > 0 ) ? update->run_wrap : update->run.length;
+                
+                if( update->run_sent < run_end ){
+                        uint16_t burst_length = run_end - update->run_sent;
+                        uint16_t head_length  = 0;              // addressing commands going along
+                        
+                        if( burst_length > get_data_burst_length( ssd1306 ) ){
+                                burst_length = get_data_burst_length( ssd1306 );
+                        }
+                        if( commands_length > 0 ){
+                                head_length           = stream_encode_commands( update->buffer, &update->commands[ update->commands_sent ], commands_length, true );
+                                update->commands_sent = update->commands_count;
+                        }
+                        update->burst_tile_idx = update->run.tile_idx + update->run_sent;
+                        update->burst_length   = burst_length;
+                        update->burst_offset   = head_length + 1;
+                        update->buffer[head_length] = SSD1306_DATA;
+                        memcpy( &update->buffer[ update->burst_offset ], &fb_ssd1306->tiles[ update->burst_tile_idx ], burst_length );
+                        update->run_sent      += burst_length;
+                        
+                        if( !has_control_byte( ssd1306 ) ){
+                                com_driver.set_data_command( com_driver.com_module, true );
+                                
+                                return bus_write_async( ssd1306, &update->buffer[1], burst_length, update_async_on_write_done, update );
+                        }
+                        
+                        return bus_write_async( ssd1306, update->buffer, head_length + 1 + burst_length, update_async_on_write_done, update );
+                }
+                
+                // the run continues on the next page, reset the column range (see tile_run_write())
+                if( update->run_wrap > 0 ){
+                        update->commands[0]    = SSD1306_SET_COLUMN_ADRESSES;
+                        update->commands[1]    = 0;
+                        update->commands[2]    = SSD1306_COLUMNS - 1;
+                        update->commands_count = 3;
+                        update->commands_sent  = 0;
+                        update->run_wrap       = 0;
+                        continue;
+                }
+                
+                // run done, plan the next one
+                if( update_plan_map( ssd1306, fb_ssd1306->columns, fb_ssd1306->bytes, update->tiles_dirty, &update->tile_idx, &update->run, 1 ) < 1 ){
+                        return STATUS_NO_CHANGE;
+                }
+                
+                uint8_t column_start = update->run.tile_idx % fb_ssd1306->columns;
+                
+                update->commands[0]    = SSD1306_SET_PAGE_ADRESSES;
+                update->commands[1]    = ram_page    ( ssd1306, update->run.tile_idx / fb_ssd1306->columns );
+                update->commands[2]    = ram_page_end( ssd1306, update->run.tile_idx / fb_ssd1306->columns );
+                update->commands[3]    = SSD1306_SET_COLUMN_ADRESSES;
+                update->commands[4]    = column_start;
+                update->commands[5]    = SSD1306_COLUMNS - 1;
+                update->commands_count = 6;
+                update->commands_sent  = 0;
+                update->run_sent       = 0;
+                update->run_wrap       = tile_run_wraps( fb_ssd1306->columns, update->run.tile_idx, update->run.length ) ? fb_ssd1306->columns - column_start : 0;
+        }
+};
+
+/**
+ * \asserts ssd1306                              != NULL
+ * \asserts update                               != NULL
+ *
+ * \asserts framebuffer                          != NULL
+ * \asserts framebuffer->user_data               != NULL
+ * \asserts framebuffer->user_data->bytes        >  0
+ * \asserts framebuffer->user_data->tiles        != NULL
+ * \asserts framebuffer->user_data->tiles _dirty != NULL
+ */
+enum status_code ssd1306_display_update_async (
+  struct SSD1306              *const ssd1306     //< data structure of the SSD1306 controller to write the update to
+, struct Framebuffer          *const framebuffer //< framebuffer holding the data to display on the OLED
+, struct SSD1306_Update_Async *const update      //< state of the update
+,        SSD1306_Update_Done  *const on_done     //< called with the status of the update, when it is done (may be NULL)
+,                       void  *const user_data   //< user data to pass to on_done
+){
+        Assert( ssd1306                  != NULL );
+        Assert( update                   != NULL );
+        
+        Assert( framebuffer              != NULL );
+        Assert( framebuffer->user_data   != NULL );
+        
+        struct Framebuffer_SSD1306 *fb_ssd1306 = (struct Framebuffer_SSD1306 *)framebuffer->user_data;
+        
+        Assert( fb_ssd1306->bytes       >  0    );
+        Assert( fb_ssd1306->tiles       != NULL );
+        Assert( fb_ssd1306->tiles_dirty != NULL );
+        
+        struct Com_Driver  com_driver        = ssd1306->com_driver;
+        void              *com_module        = com_driver.com_module;
+        uint32_t           tiles_dirty_words = fb_ssd1306->tiles_dirty_words;
+        enum status_code   status;
+        
+        if( update->busy ){
+                return STATUS_BUSY;
+        }
+        if( com_driver.write_async == NULL ){
+                return STATUS_ERR_UNSUPPORTED_DEV;
+        }
+        if( tiles_dirty_words > SSD1306_TILES_DIRTY_WORDS_MAX ){
+                return STATUS_ERR_INVALID_ARG;
+        }
+        
+        // the last update failed, its tiles have to be sent again
+        if(( update->status      != STATUS_OK  )
+        && ( update->framebuffer == framebuffer )
+        ){
+                for( uint32_t idx = 0; idx < tiles_dirty_words; idx++ ){
+                        framebuffer_ssd1306_dirty_t tiles_dirty_new = update->tiles_dirty[idx] & ~fb_ssd1306->tiles_dirty[idx];
+                        
+                        fb_ssd1306->tiles_dirty[idx]  |= tiles_dirty_new;
+                        fb_ssd1306->tiles_dirty_count += __builtin_popcount( tiles_dirty_new );
+                }
+                update->status = STATUS_OK;
+        }
+        
+        framebuffer_ssd1306_shadow_filter( fb_ssd1306 );        // don't send tiles the display already shows
+        
+        if( fb_ssd1306->tiles_dirty_count < 1 ){
+                return STATUS_NO_CHANGE;
+        }
+        
+        // move the dirty state into the snapshot, tiles drawn to from now on are sent with the next update
+        memcpy( (void *)update->tiles_dirty,     (void *)fb_ssd1306->tiles_dirty, tiles_dirty_words * sizeof( framebuffer_ssd1306_dirty_t ) );
+        memset( (void *)fb_ssd1306->tiles_dirty, 0x00,                            tiles_dirty_words * sizeof( framebuffer_ssd1306_dirty_t ) );
+        fb_ssd1306->tiles_dirty_count = 0;
+        
+        update->ssd1306        = ssd1306;
+        update->framebuffer    = framebuffer;
+        update->on_done        = on_done;
+        update->user_data      = user_data;
+        update->send_stop_org  = com_driver.get_send_stop( com_module );
+        update->tile_idx       = 0;
+        update->run.tile_idx   = 0;
+        update->run.length     = 0;
+        update->run_sent       = 0;
+        update->run_wrap       = 0;
+        update->commands_count = 0;
+        update->commands_sent  = 0;
+        update->burst_length   = 0;
+        update->status         = STATUS_BUSY;
+        update->busy           = true;
+        
+        com_driver.set_send_stop( com_module, false ); // do not release the i2c bus until finished sending all the tiles
+        
+        status = update_async_next( update );
+        if( status == STATUS_OK ){
+                return STATUS_OK;                       // on_done will be called
+        }
+        
+        // nothing is in flight, finish right here without calling on_done
+        com_driver.send_stop    ( com_module );
+        com_driver.set_send_stop( com_module, update->send_stop_org );
+        update->status = ( status == STATUS_NO_CHANGE ) ? STATUS_OK : status;
+        update->busy   = false;
+        
         return status;
 };
 
+/**
+ * \asserts update != NULL
+ */
+bool ssd1306_display_update_async_busy (
+  struct SSD1306_Update_Async const *const update //< state of the update
+){
+        Assert( update != NULL );
+        
+        return update->busy;
+};
+
+/**
+ * \asserts update                 != NULL
+ * \asserts ssd1306                != NULL
+ * \asserts framebuffer            != NULL
+ * \asserts framebuffer->user_data != NULL
+ */
+void ssd1306_update_begin (
+  struct SSD1306_Update_Step *const update      //< state of the update to start
+, struct SSD1306             *const ssd1306     //< data structure of the SSD1306 controller to write the update to
+, struct Framebuffer         *const framebuffer //< framebuffer holding the data to display on the OLED
+){
+        Assert( update                 != NULL );
+        Assert( ssd1306                != NULL );
+        Assert( framebuffer            != NULL );
+        Assert( framebuffer->user_data != NULL );
+        
+        update->ssd1306     = ssd1306;
+        update->framebuffer = framebuffer;
+        update->tile_idx    = 0;
+        update->status      = STATUS_BUSY;
+        
+        framebuffer_ssd1306_shadow_filter( (struct Framebuffer_SSD1306 *)framebuffer->user_data ); // don't send tiles the display already shows
+};
+
+/**
+ * \brief Get the number of bytes written to the com driver for commands in front of data, as done by \ref ssd1306_stream_data()
+ */
+static inline uint32_t get_bytes_commands (
+  struct SSD1306 const *const ssd1306           //< data structure of the SSD1306 controller the commands are sent to
+,              uint16_t const length            //< number of command bytes
+){
+        if( !has_control_byte( ssd1306 ) ){
+                return length;
+        }
+        if( stream_mix_commands( get_bus_cost( ssd1306 ), length ) ){
+                return 2 * length;
+        }
+        
+        return 1 + length;
+}
+
+/**
+ * \brief Get the number of bytes written to the com driver for tile data, as done by \ref ssd1306_stream_data()
+ */
+static inline uint32_t get_bytes_tile_data (
+  struct SSD1306 const *const ssd1306           //< data structure of the SSD1306 controller the data is sent to
+,              uint32_t const length            //< number of tiles
+){
+        if( !has_control_byte( ssd1306 ) ){
+                return length;
+        }
+        
+        uint16_t burst_length = get_data_burst_length( ssd1306 );
+        
+        return length + (( length + burst_length - 1 ) / burst_length );   // a control byte per burst
+}
+
+/**
+ * \asserts update != NULL
+ */
+enum status_code ssd1306_update_step (
+  struct SSD1306_Update_Step *const update      //< state of the update
+,                  uint32_t   const max_bytes   //< max. number of bytes to write to the com driver
+){
+        Assert( update != NULL );
+        
+        if( update->status != STATUS_BUSY ){
+                return update->status;
+        }
+        
+        struct SSD1306             *ssd1306       = update->ssd1306;
+        struct Framebuffer_SSD1306 *fb_ssd1306    = (struct Framebuffer_SSD1306 *)update->framebuffer->user_data;
+        uint32_t                    columns       = fb_ssd1306->columns;
+        uint32_t                    address_bytes = get_bytes_commands( ssd1306, SSD1306_SET_TILE_NEXT_SEQUENCE_LENGTH );
+        uint32_t                    bytes         = 0;  // bytes written by this step
+        struct SSD1306_Stream       stream;
+        struct SSD1306_Tile_Run     run;
+        
+        ssd1306_stream_begin( &stream, ssd1306 );
+        
+        for( ;; ){
+                uint32_t scan_idx = update->tile_idx;   // the dirty tiles map is scanned again every time, it may have changed since the last step
+                
+                if( update_plan_map( ssd1306, columns, fb_ssd1306->bytes, fb_ssd1306->tiles_dirty, &scan_idx, &run, 1 ) < 1 ){
+                        update->status = STATUS_OK;     // all dirty tiles sent
+                        break;
+                }
+                
+                // cut the run to a part, that doesn't need its column range reset (see tile_run_write()) ...
+                uint32_t column_start = run.tile_idx % columns;
+                uint32_t length       = run.length;
+                
+                if(( column_start != 0                      )
+                && ( length       >  columns - column_start )
+                ){
+                        length = columns - column_start;
+                }
+                
+                // ... and fits into the bytes left
+                uint32_t data_bytes = ( max_bytes > bytes + address_bytes ) ? max_bytes - bytes - address_bytes : 0;
+                uint32_t data_tiles = data_bytes;
+                
+                if( has_control_byte( ssd1306 ) ){
+                        data_tiles -= ( data_bytes + get_data_burst_length( ssd1306 ) ) / ( get_data_burst_length( ssd1306 ) + 1 ); // control bytes of the bursts
+                }
+                if( length > data_tiles ){
+                        length = data_tiles;
+                }
+                if( length < 1 ){
+                        if( bytes > 0 ){
+                                break;                  // budget used up, continue with the next step
+                        }
+                        length = 1;                     // make progress, whatever the budget is
+                }
+                
+                enum status_code status = tile_run_write( &stream, fb_ssd1306, run.tile_idx, length );
+                if( status != STATUS_OK ){
+                        // don't know what made it to the display, make sure the next update resends everything
+                        framebuffer_ssd1306_mark_dirty_range( fb_ssd1306, 0, fb_ssd1306->bytes );
+                        update->status = status;
+                        break;
+                }
+                framebuffer_ssd1306_mark_clean_range( fb_ssd1306, run.tile_idx, length );
+                
+                bytes           += address_bytes + get_bytes_tile_data( ssd1306, length );
+                update->tile_idx = run.tile_idx + length;
+        }
+        
+        ssd1306_stream_end( &stream );                  // release i2c bus
+        
+        return update->status;
+};
+
+/**
+ * \asserts update != NULL
+ */
+bool ssd1306_update_done (
+  struct SSD1306_Update_Step const *const update //< state of the update
+){
+        Assert( update != NULL );
+        
+        return update->status != STATUS_BUSY;
+};
+
+/**
+ * \asserts ssd1306                != NULL
+ * \asserts framebuffer            != NULL
+ * \asserts framebuffer->user_data != NULL
+ */
+enum status_code ssd1306_scroll_pages (
+  struct SSD1306     *const ssd1306             //< data structure of the SSD1306 controller to scroll
+, struct Framebuffer *const framebuffer         //< framebuffer of the display
+,            int8_t   const pages               //< pages to move the content up (< 0: down)
+){
+        Assert( ssd1306                != NULL );
+        Assert( framebuffer            != NULL );
+        Assert( framebuffer->user_data != NULL );
+        
+        struct Framebuffer_SSD1306 *fb_ssd1306 = (struct Framebuffer_SSD1306 *)framebuffer->user_data;
+        
+        if( fb_ssd1306->columns % FRAMEBUFFER_SSD1306_DIRTY_BITS != 0 ){
+                return STATUS_ERR_INVALID_ARG;          // check before the display moves, see framebuffer_ssd1306_scroll_pages()
+        }
+        if( pages == 0 ){
+                return STATUS_OK;
+        }
+        
+        uint8_t page_origin = (( ssd1306->page_origin + pages ) % SSD1306_RAM_PAGES + SSD1306_RAM_PAGES ) % SSD1306_RAM_PAGES;
+        
+        #define SSD1306_SCROLL_PAGES_SEQUENCE_LENGTH 1
+        
+        uint8_t sequence[SSD1306_SCROLL_PAGES_SEQUENCE_LENGTH] = {
+                SSD1306_SET_DISPLAY_START_LINE | ( page_origin << 3 )
+        };
+        
+        enum status_code status = ssd1306_command_sequence_write( ssd1306, sequence, SSD1306_SCROLL_PAGES_SEQUENCE_LENGTH );
+        if( status != STATUS_OK ){
+                return status;
+        }
+        ssd1306->page_origin = page_origin;
+        
+        return framebuffer_ssd1306_scroll_pages( framebuffer, pages );
+};
+
+/**
+ * \asserts ssd1306 != NULL
+ */
+enum status_code ssd1306_scroll_continuous_start (
+  struct SSD1306               *const ssd1306           //< data structure of the SSD1306 controller to scroll
+,                   bool        const right             //< true: scroll to the right; false: scroll to the left
+,                uint8_t        const page_start        //< first page of the display to scroll
+,                uint8_t        const page_end          //< last  page of the display to scroll
+, enum SSD1306_Scroll_Interval  const interval          //< time between two scroll steps
+){
+        Assert( ssd1306 != NULL );
+        
+        if(( page_start >  page_end                  )
+        || ( page_end   >= ( ssd1306->geometry >> 3 ))
+        || ( ram_page( ssd1306, page_start ) > ram_page( ssd1306, page_end ))
+        ){
+                return STATUS_ERR_INVALID_ARG;          // the controller scrolls a range of display data RAM pages
+        }
+        
+        #define SSD1306_SCROLL_SETUP_SEQUENCE_LENGTH 9
+        
+        uint8_t sequence[SSD1306_SCROLL_SETUP_SEQUENCE_LENGTH] = {
+                SSD1306_SCROLL_DEACTIVATE                                                       , // the setup must not change a running scroll
+                right ? SSD1306_SET_CONTINUOUS_HSCROLL_RIGHT : SSD1306_SET_CONTINUOUS_HSCROLL_LEFT,
+                0x00                                                                            , // dummy byte
+                ram_page( ssd1306, page_start )                                                 ,
+                interval                                                                        ,
+                ram_page( ssd1306, page_end   )                                                 ,
+                0x00, 0xFF                                                                      , // dummy bytes
+                SSD1306_SCROLL_ACTIVATE
+        };
+        
+        return ssd1306_command_sequence_write( ssd1306, sequence, SSD1306_SCROLL_SETUP_SEQUENCE_LENGTH );
+};
+
+/**
+ * \asserts ssd1306                != NULL
+ * \asserts framebuffer            != NULL
+ * \asserts framebuffer->user_data != NULL
+ */
+enum status_code ssd1306_scroll_continuous_stop (
+  struct SSD1306     *const ssd1306             //< data structure of the SSD1306 controller to stop scrolling
+, struct Framebuffer *const framebuffer         //< framebuffer of the display
+){
+        Assert( ssd1306                != NULL );
+        Assert( framebuffer            != NULL );
+        Assert( framebuffer->user_data != NULL );
+        
+        struct Framebuffer_SSD1306 *fb_ssd1306 = (struct Framebuffer_SSD1306 *)framebuffer->user_data;
+        
+        #define SSD1306_SCROLL_STOP_SEQUENCE_LENGTH 1
+        
+        uint8_t sequence[SSD1306_SCROLL_STOP_SEQUENCE_LENGTH] = {
+                SSD1306_SCROLL_DEACTIVATE
+        };
+        
+        enum status_code status = ssd1306_command_sequence_write( ssd1306, sequence, SSD1306_SCROLL_STOP_SEQUENCE_LENGTH );
+        if( status != STATUS_OK ){
+                return status;
+        }
+        
+        // what the scrolled pages show is unknown now
+        framebuffer_ssd1306_resend_range( fb_ssd1306, 0, fb_ssd1306->bytes );
+        
+        return STATUS_OK;
+};
+
 /**
  * \asserts (ssd1306 != NULL)
  */
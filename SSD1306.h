@@ -35,6 +35,7 @@
 #include <asf.h>
 #include "Com_Driver.h"         // Generic Communication Driver
 #include "Framebuffer.h"        // Generic Framebuffer
+#include "Framebuffer_SSD1306.h" // SSD1306 Framebuffer
 
 /**
  * \brief  SSD1306 type of data enumeration                              
@@ -46,6 +47,8 @@ enum SSD1306_Datatype {
         SSD1306_DATA    = 0x40  //< following byte are data
 };
 
+#define SSD1306_CONTINUATION                            0x80    //< control byte bit (Co): only the next byte is of the datatype given, another control byte follows
+
 
 
 // =========================================================
@@ -93,6 +96,22 @@ enum SSD1306_Datatype {
 #define SSD1306_SCROLL_DEACTIVATE                       0x2E    //< 1 byte command: stop scrolling
 #define SSD1306_SCROLL_ACTIVATE                         0x2F    //< 1 byte command: start scrolling
 
+/**
+ * \brief SSD1306 continuous scroll step interval enumeration
+ *
+ * Enumeration of the frame frequency codes of the continuous scroll setup commands, the time between two scroll steps in frames.
+ */
+enum SSD1306_Scroll_Interval {
+        SSD1306_SCROLL_INTERVAL_2_FRAMES   = 0x07,
+        SSD1306_SCROLL_INTERVAL_3_FRAMES   = 0x04,
+        SSD1306_SCROLL_INTERVAL_4_FRAMES   = 0x05,
+        SSD1306_SCROLL_INTERVAL_5_FRAMES   = 0x00,
+        SSD1306_SCROLL_INTERVAL_25_FRAMES  = 0x06,
+        SSD1306_SCROLL_INTERVAL_64_FRAMES  = 0x01,
+        SSD1306_SCROLL_INTERVAL_128_FRAMES = 0x02,
+        SSD1306_SCROLL_INTERVAL_256_FRAMES = 0x03
+};
+
 
 
 // =========================================================
@@ -222,16 +241,151 @@ enum SSD1306_Geometry {
         SSD1306_GEOMETRY_128x64 = 64
 };
 
+#define SSD1306_COLUMNS                                 128     //< number of columns of all supported geometries
+#define SSD1306_RAM_PAGES                                 8     //< number of pages of the display data RAM, independent of the geometry
+
+/**
+ * \brief Maximum number of data bytes sent in one bus transaction.
+ *
+ * Data is streamed to the controller in bursts: one SSD1306_DATA control byte followed by up to this many data bytes.
+ * The burst buffer lives on the stack of \ref ssd1306_stream_data(), so this also is its stack usage.
+ * Define it in your project's configuration to change the maximum for all controllers.
+ */
+#ifndef SSD1306_DATA_BURST_LENGTH_MAX
+#define SSD1306_DATA_BURST_LENGTH_MAX                   128
+#endif
+
+/**
+ * \brief Maximum number of command bytes a stream collects, before it sends them (see \ref SSD1306_Stream).
+ *
+ * Define it in your project's configuration to change the maximum for all controllers.
+ */
+#ifndef SSD1306_STREAM_COMMANDS_MAX
+#define SSD1306_STREAM_COMMANDS_MAX                     32
+#endif
+
+/**
+ * \brief Bus cost model used to plan display updates
+ *
+ * Costs are in an arbitrary unit, usually bus clocks. 
+ * The cost of a bus transaction is the overhead of starting it (e.g. I2C START condition and address byte),
+ * the cost of a byte is the cost of sending one payload byte (e.g. I2C 8 data bits + ACK).
+ * If both values are 0, the I2C model is used, or the SPI model, if the bus has a data/command line.
+ */
+struct SSD1306_Bus_Cost {
+        uint16_t transaction; //< cost of starting a bus transaction
+        uint16_t byte       ; //< cost of sending one payload byte
+};
+
+#define SSD1306_BUS_COST_I2C_TRANSACTION                10      //< I2C: START + address byte + ACK
+#define SSD1306_BUS_COST_I2C_BYTE                        9      //< I2C: data byte + ACK
+
+#define SSD1306_BUS_COST_SPI_TRANSACTION                32      //< SPI: chip select, data/command line and driver call, in bus clocks
+#define SSD1306_BUS_COST_SPI_BYTE                        8      //< SPI: data byte
+
+/**
+ * \brief A run of consecutive tiles to send to the controller in one go
+ */
+struct SSD1306_Tile_Run {
+        uint16_t tile_idx; //< index of the first tile of the run
+        uint16_t length  ; //< number of tiles in the run
+};
+
+/**
+ * \brief Number of tile runs \ref ssd1306_display_update() plans at once (on the stack).
+ */
+#ifndef SSD1306_UPDATE_PLAN_RUNS_MAX
+#define SSD1306_UPDATE_PLAN_RUNS_MAX                    16
+#endif
+
 /**
  * \brief Configuration data structure for a single SSD1306 controller IC 
  */
 struct SSD1306 {
         struct Com_Driver                com_driver        ; //< a driver that knows how to talk to this SSD1306
-        uint16_t                         address           ; //< bus address of this SSD1306
+        uint16_t                         address           ; //< bus address of this SSD1306 (ignored on SPI)
         enum SSD1306_Geometry            geometry          ; //< geometry of AMOLED screen attached to this SSD1306
         enum SSD1306_Charge_Pump_Source  charge_pump_source; //< charge pump power source configuration of this SSD1306
         bool                             flip_horizontal   ; //< flip the rows
         bool                             flip_vertical     ; //< flip the columns
+        uint16_t                         data_burst_length ; //< max. data bytes per bus transaction (0: SSD1306_DATA_BURST_LENGTH_MAX)
+        struct SSD1306_Bus_Cost          bus_cost          ; //< cost model of the bus used to plan updates (0,0: I2C or SPI)
+        uint8_t                          page_origin       ; //< display data RAM page shown at the top of the display (see \ref ssd1306_scroll_pages())
+        uint32_t                         transactions_written; //< bus transactions written to the com driver so far (statistics, free running)
+        uint32_t                         bytes_written     ; //< bytes written to the com driver so far, control bytes included (statistics, free running)
+};
+
+/**
+ * \brief Command stream to the controller
+ *
+ * A stream holds the bus for a session of commands and data (see \ref ssd1306_stream_begin())
+ * and packs them into as few transactions as the control byte protocol of the SSD1306 allows:
+ * Commands in a row share one transaction behind a single SSD1306_COMMAND control byte.
+ * Commands right in front of data go into the data transaction, with a SSD1306_CONTINUATION control byte each,
+ * if the bus cost model says that's cheaper than a transaction of their own.
+ * On a bus with a data/command line commands in a row share one write.
+ */
+struct SSD1306_Stream {
+        struct SSD1306                  *ssd1306           ; //< controller the stream is sent to
+        bool                             send_stop_org     ; //< send_stop setting of the com driver before the stream
+        enum status_code                 status            ; //< status of the first write failed (STATUS_OK: none)
+        uint8_t                          commands_length   ; //< number of commands collected, not sent yet
+        uint8_t                          commands[SSD1306_STREAM_COMMANDS_MAX]; //< commands collected
+};
+
+/**
+ * \brief Handler called, when an asynchronous display update is done
+ *
+ * Usually called from interrupt context.
+ */
+typedef void SSD1306_Update_Done( void *const user_data, enum status_code const status );
+
+#define SSD1306_TILES_DIRTY_WORDS_MAX                   FRAMEBUFFER_SSD1306_DIRTY_WORDS( SSD1306_COLUMNS * ( SSD1306_GEOMETRY_128x64 >> 3 ) ) //< size of the dirty tiles map of the largest geometry in words
+
+/**
+ * \brief State of an asynchronous display update
+ *
+ * The update sends a snapshot of the dirty tiles of the framebuffer.
+ * Drawing to the framebuffer may go on while the update is in flight,
+ * tiles changed meanwhile are marked dirty again and sent with the next update.
+ * The structure has to stay valid until the update is done, so don't put it on the stack.
+ * Start with an idle one: \ref busy false and \ref status STATUS_OK.
+ */
+struct SSD1306_Update_Async {
+        struct SSD1306                  *ssd1306           ; //< controller the update is sent to
+        struct Framebuffer              *framebuffer       ; //< framebuffer the update is sent from
+        SSD1306_Update_Done             *on_done           ; //< called when the update is done (may be NULL)
+        void                            *user_data         ; //< user data to pass to on_done
+        volatile bool                    busy              ; //< an update is in flight
+        volatile enum status_code        status            ; //< status of the last update (STATUS_BUSY while in flight)
+        bool                             send_stop_org     ; //< send_stop setting of the com driver before the update
+        uint32_t                         tile_idx          ; //< tile to continue planning the update at
+        struct SSD1306_Tile_Run          run               ; //< tile run being sent
+        uint16_t                         run_sent          ; //< number of tiles of the run sent
+        uint16_t                         run_wrap          ; //< number of tiles of the run before its column range has to be reset (0: none)
+        uint8_t                          commands[6]       ; //< addressing commands of the run
+        uint8_t                          commands_count    ; //< number of addressing commands of the run
+        uint8_t                          commands_sent     ; //< number of addressing commands sent
+        uint16_t                         burst_tile_idx    ; //< first tile of the data burst in flight
+        uint16_t                         burst_length      ; //< number of tiles of the data burst in flight (0: command in flight)
+        uint8_t                          burst_offset      ; //< position of the data burst in flight in the buffer
+        uint8_t                          buffer[2 * 6 + 1 + SSD1306_DATA_BURST_LENGTH_MAX]; //< addressing commands going along, control byte and payload of the write in flight
+        framebuffer_ssd1306_dirty_t      tiles_dirty[SSD1306_TILES_DIRTY_WORDS_MAX]; //< snapshot of the dirty tiles being sent
+};
+
+/**
+ * \brief State of an incremental display update
+ *
+ * The update sends the dirty tiles of the framebuffer in steps of bounded bus time (see \ref ssd1306_update_step()),
+ * so the superloop can service other devices between the steps, without an asynchronous com driver.
+ * It scans the dirty tiles map of the framebuffer as it goes: tiles drawn to between steps are sent by this update,
+ * if the scan hasn't passed them yet, otherwise by the next one.
+ */
+struct SSD1306_Update_Step {
+        struct SSD1306                  *ssd1306           ; //< controller the update is sent to
+        struct Framebuffer              *framebuffer       ; //< framebuffer the update is sent from
+        uint32_t                         tile_idx          ; //< tile to continue the scan at
+        enum status_code                 status            ; //< STATUS_BUSY while the scan goes on, then the status of the update
 };
         
         
@@ -253,6 +407,8 @@ enum status_code ssd1306_init(
 
 /** 
  * \brief Write a raw command sequence to the controller.
+ *
+ * The sequence is sent in one transaction, behind a single SSD1306_COMMAND control byte (see \ref SSD1306_Stream).
  */
 enum status_code ssd1306_command_sequence_write (
   struct SSD1306 *const ssd1306                 //< configuration data structure for the controller to write the sequence to
@@ -260,8 +416,67 @@ enum status_code ssd1306_command_sequence_write (
 ,       uint16_t  const sequence_length         //< length of command sequence
 );
 
+/**
+ * \brief Start a command stream to the controller.
+ *
+ * The bus is held until \ref ssd1306_stream_end().
+ *
+ * \asserts stream  != NULL
+ * \asserts ssd1306 != NULL
+ */
+void ssd1306_stream_begin (
+  struct SSD1306_Stream *const stream           //< stream to start
+, struct SSD1306        *const ssd1306          //< configuration data structure for the controller to send the stream to
+);
+
+/**
+ * \brief Add commands to a command stream.
+ *
+ * The commands are collected and sent along with the next data or commands, that don't fit anymore, or at the end of the stream.
+ *
+ * \return Status of operation.
+ * \retval STATUS_OK                    If the commands were added
+ * \retval any                          Status of the first write of the stream failed, nothing is sent anymore
+ */
+enum status_code ssd1306_stream_command (
+  struct SSD1306_Stream *const stream           //< stream to add the commands to
+,               uint8_t *const commands         //< commands to add
+,              uint16_t  const length           //< number of command bytes
+);
+
+/**
+ * \brief Send data in a command stream.
+ *
+ * The commands collected are sent first, the data is sent in bursts of up to \ref data_burst_length bytes.
+ * When the function returns, the data has been written.
+ *
+ * \return Status of operation.
+ * \retval STATUS_OK                    If the data was written
+ * \retval any                          Status of the first write of the stream failed, nothing is sent anymore
+ */
+enum status_code ssd1306_stream_data (
+  struct SSD1306_Stream *const stream           //< stream to send the data in
+,               uint8_t *const data             //< data to send
+,              uint16_t  const length           //< number of data bytes
+);
+
+/**
+ * \brief End a command stream: send the commands collected and release the bus.
+ *
+ * \return Status of the stream.
+ * \retval STATUS_OK                    If everything was written
+ * \retval any                          Status of the first write of the stream failed
+ */
+enum status_code ssd1306_stream_end (
+  struct SSD1306_Stream *const stream           //< stream to end
+);
+
 /** 
  * \brief Write a raw data sequence to the controller.
+ *
+ * The sequence is sent in bursts of up to \ref data_burst_length bytes,
+ * each burst preceded by a single SSD1306_DATA control byte.
+ * On a bus with a data/command line (see \ref Com_Driver) it is sent in one write, without control byte.
  */
 enum status_code ssd1306_data_sequence_write (
   struct SSD1306 *const ssd1306                 //< configuration data structure for the controller to write the sequence to
@@ -280,8 +495,9 @@ enum status_code ssd1306_display_on (
 /**
  * \brief Update the display connected to this SSD1306 with the content of the framebuffer.
  *
- * This function uses differential update, unless the number of pixels changed is so large, 
- * that a complete update is more efficient.
+ * This function plans the update with \ref ssd1306_update_plan() and sends the planned tile runs.
+ * Runs of dirty tiles are merged, whenever resending the clean tiles between them is cheaper 
+ * than addressing the next run, so a completely dirty framebuffer is sent as a single run.
  */
 enum status_code ssd1306_display_update (
   struct SSD1306     *const ssd1306             //< data structure of the SSD1306 controller to write the update to
@@ -308,6 +524,173 @@ enum status_code ssd1306_display_update_differential (
 , struct Framebuffer *const framebuffer         //< framebuffer holding the data to display on the OLED
 );
 
+/**
+ * \brief Start updating the display connected to this SSD1306 with the content of the framebuffer and return at once.
+ *
+ * The dirty tiles are planned and sent like \ref ssd1306_display_update() does,
+ * but every bus transaction is started from the completion of the previous one
+ * using the asynchronous write of the com driver.
+ * The dirty state of the framebuffer is moved into a snapshot in \ref update,
+ * so the framebuffer can be drawn to while the update is in flight.
+ * Don't use the bus in any other way, before \ref on_done is called.
+ * If an update fails, the tiles it should have sent are marked dirty again by the next update.
+ *
+ * \return Status of operation.
+ * \retval STATUS_OK                    If the update was started, \ref on_done will be called when it is done
+ * \retval STATUS_NO_CHANGE             If there are no dirty tiles, \ref on_done won't be called
+ * \retval STATUS_BUSY                  If an update is still in flight
+ * \retval STATUS_ERR_UNSUPPORTED_DEV   If the com driver can't write asynchronously
+ * \retval STATUS_ERR_INVALID_ARG       If the framebuffer is larger than the largest geometry
+ * \retval any                          Status of the com driver, if the first write could not be started
+ */
+enum status_code ssd1306_display_update_async (
+  struct SSD1306              *const ssd1306     //< data structure of the SSD1306 controller to write the update to
+, struct Framebuffer          *const framebuffer //< framebuffer holding the data to display on the OLED
+, struct SSD1306_Update_Async *const update      //< state of the update
+,        SSD1306_Update_Done  *const on_done     //< called with the status of the update, when it is done (may be NULL)
+,                       void  *const user_data   //< user data to pass to on_done
+);
+
+/**
+ * \brief Check if an asynchronous display update is still in flight.
+ */
+bool ssd1306_display_update_async_busy (
+  struct SSD1306_Update_Async const *const update //< state of the update
+);
+
+/**
+ * \brief Start an incremental update of the display connected to this SSD1306 with the content of the framebuffer.
+ *
+ * Nothing is sent yet, call \ref ssd1306_update_step() until \ref ssd1306_update_done().
+ * Don't draw to the framebuffer from an interrupt, while a step is sending.
+ *
+ * \asserts update                 != NULL
+ * \asserts ssd1306                != NULL
+ * \asserts framebuffer            != NULL
+ * \asserts framebuffer->user_data != NULL
+ */
+void ssd1306_update_begin (
+  struct SSD1306_Update_Step *const update      //< state of the update to start
+, struct SSD1306             *const ssd1306     //< data structure of the SSD1306 controller to write the update to
+, struct Framebuffer         *const framebuffer //< framebuffer holding the data to display on the OLED
+);
+
+/**
+ * \brief Send the next dirty tiles of an incremental update, up to \ref max_bytes bytes on the bus.
+ *
+ * The bytes counted are all the bytes written to the com driver: control bytes, commands and tile data.
+ * Runs of dirty tiles are cut to fit, the rest is sent by the next step.
+ * A step sends at least one tile, so a budget too small for addressing a tile is exceeded by that.
+ *
+ * \return Status of operation.
+ * \retval STATUS_BUSY                  If there are tiles left to send, call again
+ * \retval STATUS_OK                    If the update is done
+ * \retval any                          Status of the com driver, the update is done and the next update resends everything
+ */
+enum status_code ssd1306_update_step (
+  struct SSD1306_Update_Step *const update      //< state of the update
+,                  uint32_t   const max_bytes   //< max. number of bytes to write to the com driver
+);
+
+/**
+ * \brief Check if an incremental update is done.
+ */
+bool ssd1306_update_done (
+  struct SSD1306_Update_Step const *const update //< state of the update
+);
+
+/**
+ * \brief Plan the tile runs to send to update the display with the dirty tiles of the framebuffer.
+ *
+ * Scans the dirty tiles starting at \ref tile_idx and collects them into runs of consecutive tiles.
+ * Two runs are merged into one, if sending the clean tiles between them costs less (see \ref bus_cost)
+ * than addressing the second run with a new page and column range command.
+ * A run starting in the middle of a page and wrapping to the next page costs an extra column range command.
+ * Scanning stops at the end of the framebuffer or as soon as \ref runs_max runs are planned and 
+ * the next dirty tile would start a new run. In this case \ref tile_idx points to that tile, 
+ * so the plan can be continued with the next call.
+ * The dirty state of the tiles is not changed.
+ *
+ * \return Number of runs planned.
+ */
+uint16_t ssd1306_update_plan (
+  struct SSD1306          const *const ssd1306          //< data structure of the SSD1306 controller to plan the update for
+, struct Framebuffer            *const framebuffer      //< framebuffer holding the dirty tiles
+,                uint32_t       *const tile_idx         //< [in/out] tile to start the scan at, tile to continue the scan at
+, struct SSD1306_Tile_Run       *const runs             //< [out] runs planned
+,                uint16_t        const runs_max         //< max. number of runs to plan
+);
+
+/**
+ * \brief Get the modeled bus cost of sending the tile runs planned by \ref ssd1306_update_plan().
+ *
+ * \return Cost of the runs in the unit of \ref bus_cost, including the addressing of every run
+ *         and the column range reset of runs wrapping to the next page.
+ */
+uint32_t ssd1306_update_plan_cost (
+  struct SSD1306          const *const ssd1306          //< data structure of the SSD1306 controller the runs are planned for
+, struct Framebuffer      const *const framebuffer      //< framebuffer the runs are planned for
+, struct SSD1306_Tile_Run const *const runs             //< runs planned
+,                uint16_t        const runs_count       //< number of runs planned
+);
+
+/**
+ * \brief Scroll the display up or down by whole pages, moving its start line.
+ *
+ * The display data RAM is a ring of \ref SSD1306_RAM_PAGES pages, the start line selects the one shown at the top.
+ * Moving it by a page scrolls the whole display for a single command, no tile has to be sent again.
+ * The framebuffer content is moved along (see \ref framebuffer_ssd1306_scroll_pages()), so its coordinates stay 
+ * the ones of the display. The pages uncovered are cleared and sent with the next update, which is all the 
+ * bus traffic a log view or ticker scrolling by a line of 8 pixels costs.
+ * The updates address the tiles at their place in the ring from now on.
+ *
+ * Don't call this while an asynchronous update is in flight.
+ *
+ * \return Status of operation.
+ * \retval STATUS_OK                    If the display was scrolled
+ * \retval STATUS_ERR_INVALID_ARG       If the framebuffer can't be scrolled by pages (see \ref framebuffer_ssd1306_scroll_pages())
+ * \retval any                          Status of the com driver, the display and framebuffer are not scrolled
+ */
+enum status_code ssd1306_scroll_pages (
+  struct SSD1306     *const ssd1306             //< data structure of the SSD1306 controller to scroll
+, struct Framebuffer *const framebuffer         //< framebuffer of the display
+,            int8_t   const pages               //< pages to move the content up (< 0: down)
+);
+
+/**
+ * \brief Start the continuous horizontal scrolling of the pages [\ref page_start, \ref page_end] of the display by the controller.
+ *
+ * The controller moves the content a column every \ref interval frames, wrapping around at the side, with no bus traffic at all.
+ * The framebuffer can't follow, so don't update the display until \ref ssd1306_scroll_continuous_stop().
+ *
+ * \return Status of operation.
+ * \retval STATUS_OK                    If scrolling was started
+ * \retval STATUS_ERR_INVALID_ARG       If the pages are not on the display or wrap around in the display data RAM
+ * \retval any                          Status of the com driver
+ */
+enum status_code ssd1306_scroll_continuous_start (
+  struct SSD1306               *const ssd1306           //< data structure of the SSD1306 controller to scroll
+,                   bool        const right             //< true: scroll to the right; false: scroll to the left
+,                uint8_t        const page_start        //< first page of the display to scroll
+,                uint8_t        const page_end          //< last  page of the display to scroll
+, enum SSD1306_Scroll_Interval  const interval          //< time between two scroll steps
+);
+
+/**
+ * \brief Stop the continuous scrolling of the display.
+ *
+ * The controller leaves the display data RAM as scrolled, so all tiles of the framebuffer are sent with the next update
+ * to show its content again.
+ *
+ * \return Status of operation.
+ * \retval STATUS_OK                    If scrolling was stopped
+ * \retval any                          Status of the com driver
+ */
+enum status_code ssd1306_scroll_continuous_stop (
+  struct SSD1306     *const ssd1306             //< data structure of the SSD1306 controller to stop scrolling
+, struct Framebuffer *const framebuffer         //< framebuffer of the display
+);
+
 /**
  * \brief Specify the column start and end address of the display data RAM. 
  */
@@ -0,0 +1,192 @@
+/**     \file   SSD1306_Test_Data_Burst.c
+
+        \brief  Host test of the data bursts sent by the SSD1306 display updates.
+ 
+        \license 
+                MIT: The MIT License (https://opensource.org/licenses/MIT)
+                .
+                Permission is hereby granted, free of charge, to any person obtaining a copy of this software 
+                and associated documentation files (the "Software"), to deal in the Software without restriction, 
+                including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+                and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, 
+                subject to the following conditions:
+                .
+                The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+                .
+                THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+                INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. 
+                IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+                WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR 
+                THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ 
+        \copyright
+                DIT: 2026; Drechsler Information Technologies; www.drechsler-it.de
+ 
+        \authors
+                jrgdre: Joerg Drechsler; DIT
+ 
+        \versions
+                1.0.0: 2026-10-17 jrgdre initial release
+
+ */
+#include <string.h>                     // memcmp
+#include "Com_Driver_Recorder.h"        // bus traffic recorder
+#include "Com_Driver_SSD1306_Emulator.h"// display data RAM of the controller
+#include "Framebuffer_SSD1306.h"        // SSD1306 framebuffer
+#include "SSD1306.h"                    // controller tested
+#include "Test.h"                       // checks
+
+static struct SSD1306                     ssd1306         ; //< controller tested
+static struct Com_Driver_Recorder         recorder        ; //< counts the traffic and captures it
+static struct Com_Driver                  emulator_driver ; //< driver of the emulator, downstream of the recorder
+static struct Com_Driver_SSD1306_Emulator emulator        ; //< executes the traffic
+static uint8_t                            capture[2048]   ; //< traffic captured
+
+/**
+ * \brief Set up an initialized controller with \ref data_burst_length behind the recorder and the emulator
+ */
+static void setup (
+  enum SSD1306_Geometry const geometry          //< geometry of the display
+,              uint16_t const data_burst_length //< max. data bytes per transaction (0: default)
+){
+        memset( &ssd1306, 0x00, sizeof( ssd1306 ) );
+        ssd1306.address            = 0x3C;
+        ssd1306.geometry           = geometry;
+        ssd1306.charge_pump_source = SSD1306_CHARGE_PUMP_SOURCE_INTERNAL_VCC;
+        ssd1306.data_burst_length  = data_burst_length;
+        
+        com_driver_ssd1306_emulator_init( &emulator_driver, &emulator );
+        recorder.downstream   = &emulator_driver;
+        com_driver_recorder_init( &ssd1306.com_driver, &recorder );
+        recorder.capture      = capture;
+        recorder.capture_size = sizeof( capture );
+        
+        TEST_CHECK( ssd1306_init( &ssd1306 ) == STATUS_OK );
+        
+        com_driver_recorder_reset( &recorder );
+        emulator.write_length_max = 0;
+}
+
+/**
+ * \brief Check whether the display data RAM shows the framebuffer
+ */
+static bool ram_matches (
+  struct Framebuffer *const fb                  //< framebuffer to compare with
+){
+        struct Framebuffer_SSD1306 *fb_ssd1306 = (struct Framebuffer_SSD1306 *)fb->user_data;
+        
+        for( uint_fast16_t page = 0; page < fb_ssd1306->pages; page++ ){
+                uint8_t const *ram = &emulator.ram[ ( ( page + ssd1306.page_origin ) % SSD1306_RAM_PAGES ) * SSD1306_COLUMNS ];
+                
+                if( memcmp( ram, &fb_ssd1306->tiles[ page * fb_ssd1306->columns ], fb_ssd1306->columns ) != 0 ){
+                        return false;
+                }
+        }
+        return true;
+}
+
+/**
+ * \brief Draw a pseudo random pattern
+ */
+static void draw_noise (
+  struct Framebuffer *const fb                  //< framebuffer to draw to
+,            uint32_t       seed                //< start of the random sequence
+){
+        for( uint32_t y = 0; y < fb->height; y++ ){
+                for( uint32_t x = 0; x < fb->width; x++ ){
+                        seed = ( seed * 1103515245 ) + 12345;
+                        fb->set_pixel( fb, x, y, ( seed >> 16 ) & 1 );
+                }
+        }
+}
+
+/**
+ * \brief A data sequence goes out in bursts of one control byte and up to data_burst_length bytes
+ */
+static void test_data_sequence (
+  void
+){
+        uint8_t data[300];
+        
+        for( uint_fast16_t idx = 0; idx < sizeof( data ); idx++ ){
+                data[idx] = (uint8_t)( idx * 7 );
+        }
+        
+        setup( SSD1306_GEOMETRY_128x64, 128 );
+        
+        TEST_CHECK( ssd1306_data_sequence_write( &ssd1306, data, sizeof( data ) ) == STATUS_OK );
+        TEST_CHECK( recorder.transactions     == 3 );
+        TEST_CHECK( recorder.bytes            == sizeof( data ) + 3 );
+        TEST_CHECK( emulator.write_length_max == 1 + 128 );
+        TEST_CHECK( emulator.errors           == 0 );
+        TEST_CHECK( capture[  0] == SSD1306_DATA );
+        TEST_CHECK( capture[129] == SSD1306_DATA );
+        TEST_CHECK( capture[258] == SSD1306_DATA );
+        TEST_CHECK( memcmp( &capture[259], &data[256], 44 ) == 0 );
+        TEST_CHECK( memcmp( emulator.ram, data, sizeof( data ) ) == 0 );
+}
+
+/**
+ * \brief A full update sends the frame in a few bursts, instead of a transaction per byte
+ */
+static void test_update_all (
+  enum SSD1306_Geometry const geometry          //< geometry of the display
+){
+        struct Framebuffer *fb = framebuffer_SSD1306_create( SSD1306_COLUMNS, geometry );
+        uint32_t      const bytes = SSD1306_COLUMNS * ( geometry >> 3 );
+        
+        fb->clear( fb );                                // the tiles of a new framebuffer are undefined
+        
+        setup( geometry, 0 );
+        draw_noise( fb, geometry );
+        
+        TEST_CHECK( ssd1306_display_update_all( &ssd1306, fb ) == STATUS_OK );
+        TEST_CHECK( ram_matches( fb ) );
+        TEST_CHECK( emulator.errors           == 0 );
+        TEST_CHECK( emulator.write_length_max <= 2 * 6 + 1 + SSD1306_DATA_BURST_LENGTH_MAX );
+        TEST_CHECK( recorder.transactions     <= 2 + ( bytes / SSD1306_DATA_BURST_LENGTH_MAX ) );
+        TEST_CHECK( recorder.bytes            <  bytes + 32 );
+        
+        fb->destroy( fb );
+}
+
+/**
+ * \brief Differential updates with short bursts send every change and keep the bursts short
+ */
+static void test_update_bursts (
+  void
+){
+        struct Framebuffer *fb = framebuffer_SSD1306_create( SSD1306_COLUMNS, SSD1306_GEOMETRY_128x64 );
+        
+        fb->clear( fb );                                // the tiles of a new framebuffer are undefined
+        
+        setup( SSD1306_GEOMETRY_128x64, 16 );
+        draw_noise( fb, 1 );
+        TEST_CHECK( ssd1306_display_update( &ssd1306, fb ) == STATUS_OK );
+        TEST_CHECK( ram_matches( fb ) );
+        
+        for( uint32_t x = 3; x < 90; x++ ){     // a row across several bursts
+                fb->set_pixel( fb, x, 21, 1 );
+        }
+        fb->set_pixel( fb, 127, 63, 0 );        // and a lone tile
+        fb->set_pixel( fb, 126, 63, 1 );
+        
+        emulator.write_length_max = 0;
+        TEST_CHECK( ssd1306_display_update_differential( &ssd1306, fb ) == STATUS_OK );
+        TEST_CHECK( ram_matches( fb ) );
+        TEST_CHECK( emulator.errors           == 0 );
+        TEST_CHECK( emulator.write_length_max <= 2 * 6 + 1 + 16 );
+        
+        fb->destroy( fb );
+}
+
+int main (
+  void
+){
+        test_data_sequence();
+        test_update_all( SSD1306_GEOMETRY_128x32 );
+        test_update_all( SSD1306_GEOMETRY_128x64 );
+        test_update_bursts();
+        
+        return TEST_RESULT();
+}
@@ -0,0 +1,259 @@
+/**     \file   SSD1306_Test_Spi.c
+
+        \brief  Host test of the SSD1306 on 4-wire SPI: D/C line instead of control bytes.
+ 
+        \license 
+                MIT: The MIT License (https://opensource.org/licenses/MIT)
+                .
+                Permission is hereby granted, free of charge, to any person obtaining a copy of this software 
+                and associated documentation files (the "Software"), to deal in the Software without restriction, 
+                including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+                and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, 
+                subject to the following conditions:
+                .
+                The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+                .
+                THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+                INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. 
+                IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+                WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR 
+                THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ 
+        \copyright
+                DIT: 2026; Drechsler Information Technologies; www.drechsler-it.de
+ 
+        \authors
+                jrgdre: Joerg Drechsler; DIT
+ 
+        \versions
+                1.0.0: 2026-10-17 jrgdre initial release
+
+ */
+#include <string.h>                     // memcmp
+#include "Com_Driver_Recorder.h"        // bus traffic recorder
+#include "Com_Driver_SSD1306_Emulator.h"// display data RAM of the controller
+#include "Framebuffer_SSD1306.h"        // SSD1306 framebuffer
+#include "SSD1306.h"                    // controller tested
+#include "Test.h"                       // checks
+
+static struct SSD1306                     ssd1306         ; //< controller tested
+static struct Com_Driver_Recorder         recorder        ; //< counts the traffic and captures it
+static struct Com_Driver                  emulator_driver ; //< driver of the emulator, downstream of the recorder
+static struct Com_Driver_SSD1306_Emulator emulator        ; //< executes the traffic by the D/C line
+static uint8_t                            capture[64]     ; //< traffic captured
+static struct SSD1306_Update_Async        update          ; //< state of the asynchronous updates
+static uint32_t                           done_calls      ; //< number of calls of on_done
+
+/**
+ * \brief Set up an initialized controller on SPI behind the recorder and the emulator and a framebuffer in sync with it
+ */
+static struct Framebuffer *setup (
+  void
+){
+        struct Framebuffer *fb = framebuffer_SSD1306_create( SSD1306_COLUMNS, SSD1306_GEOMETRY_128x64 );
+        
+        memset( &ssd1306, 0x00, sizeof( ssd1306 ) );
+        ssd1306.geometry           = SSD1306_GEOMETRY_128x64;
+        ssd1306.charge_pump_source = SSD1306_CHARGE_PUMP_SOURCE_INTERNAL_VCC;
+        
+        com_driver_ssd1306_emulator_init_spi( &emulator_driver, &emulator );
+        recorder.downstream = &emulator_driver;
+        com_driver_recorder_init( &ssd1306.com_driver, &recorder );
+        
+        TEST_CHECK( ssd1306.com_driver.set_data_command != NULL );      // the recorder has the D/C line, too
+        TEST_CHECK( ssd1306_init( &ssd1306 ) == STATUS_OK );
+        
+        fb->clear( fb );                                // the tiles of a new framebuffer are undefined
+        TEST_CHECK( ssd1306_display_update_all( &ssd1306, fb ) == STATUS_OK );
+        
+        memset( &update, 0x00, sizeof( update ) );
+        done_calls = 0;
+        
+        return fb;
+}
+
+/**
+ * \brief Check whether the display data RAM shows the framebuffer
+ */
+static bool ram_matches (
+  struct Framebuffer *const fb                  //< framebuffer to compare with
+){
+        struct Framebuffer_SSD1306 *fb_ssd1306 = (struct Framebuffer_SSD1306 *)fb->user_data;
+        
+        return memcmp( emulator.ram, fb_ssd1306->tiles, fb_ssd1306->bytes ) == 0;
+}
+
+/**
+ * \brief Draw random rectangles of random pixels, a frame of changes
+ */
+static uint32_t draw_changes (
+  struct Framebuffer *const fb                  //< framebuffer to draw to
+,            uint32_t       seed                //< start of the random sequence
+){
+        for( uint_fast8_t rect = 0; rect < 4; rect++ ){
+                seed = ( seed * 1103515245 ) + 12345;
+                
+                uint32_t x0 = ( seed >> 16 ) % fb->width , w = 1 + ( seed >> 4 ) % 40;
+                uint32_t y0 = ( seed >> 24 ) % fb->height, h = 1 + ( seed >> 10 ) % 20;
+                
+                for( uint32_t y = y0; ( y < y0 + h ) && ( y < fb->height ); y++ ){
+                        for( uint32_t x = x0; ( x < x0 + w ) && ( x < fb->width ); x++ ){
+                                seed = ( seed * 1103515245 ) + 12345;
+                                fb->set_pixel( fb, x, y, ( seed >> 16 ) & 1 );
+                        }
+                }
+        }
+        return seed;
+}
+
+/**
+ * \brief Check the writes since the setup: commands with D/C low, data with D/C high, nothing else
+ */
+static void check_writes (
+  void
+){
+        TEST_CHECK( emulator.errors         == 0 );
+        TEST_CHECK( emulator.command_length == 0 );     // no command left incomplete
+        TEST_CHECK( emulator.writes_command + emulator.writes_data == emulator.transactions );
+        TEST_CHECK( emulator.writes_data    >  0 );
+}
+
+/**
+ * \brief Completion handler of the asynchronous updates: counts its calls
+ */
+static void on_done (
+  void             *const user_data             //< &done_calls
+, enum status_code  const status                //< status of the update
+){
+        TEST_CHECK( status == STATUS_OK );
+        
+        (*(uint32_t *)user_data)++;
+}
+
+/**
+ * \brief The configuration goes out as commands with D/C low, without a control byte
+ */
+static void test_init (
+  void
+){
+        memset( &ssd1306, 0x00, sizeof( ssd1306 ) );
+        ssd1306.geometry           = SSD1306_GEOMETRY_128x32;
+        ssd1306.charge_pump_source = SSD1306_CHARGE_PUMP_SOURCE_INTERNAL_VCC;
+        
+        com_driver_ssd1306_emulator_init_spi( &emulator_driver, &emulator );
+        recorder.downstream = &emulator_driver;
+        com_driver_recorder_init( &ssd1306.com_driver, &recorder );
+        recorder.capture      = capture;
+        recorder.capture_size = sizeof( capture );
+        
+        TEST_CHECK( ssd1306_init( &ssd1306 ) == STATUS_OK );
+        TEST_CHECK( recorder.bytes          == 26 );            // no control byte
+        TEST_CHECK( capture[0]              == SSD1306_DISPLAY_OFF );
+        TEST_CHECK( emulator.commands       == 14 );            // a control byte would be taken for a command
+        TEST_CHECK( emulator.writes_command == emulator.transactions );
+        TEST_CHECK( emulator.writes_data    == 0 );
+        TEST_CHECK( emulator.errors         == 0 );
+        TEST_CHECK( emulator.command_length == 0 );
+        TEST_CHECK( emulator.addressing_mode == 0 );
+        TEST_CHECK( emulator.page_end       == 3 );
+        
+        recorder.capture = NULL;
+}
+
+/**
+ * \brief A whole frame is 1 KiB of data with D/C high, the addressing around it commands with D/C low
+ */
+static void test_update_all (
+  void
+){
+        struct Framebuffer *fb = setup();
+        
+        TEST_CHECK( emulator.data_bytes == SSD1306_COLUMNS * SSD1306_RAM_PAGES );
+        check_writes();
+        TEST_CHECK( ram_matches( fb ) );
+        
+        fb->destroy( fb );
+}
+
+/**
+ * \brief Differential updates of random changes keep the display data RAM equal to the framebuffer
+ */
+static void test_update_differential (
+  void
+){
+        struct Framebuffer *fb   = setup();
+        uint32_t            seed = 7;
+        
+        for( uint32_t frame = 0; frame < 200; frame++ ){
+                seed = draw_changes( fb, seed );
+                TEST_CHECK( ssd1306_display_update( &ssd1306, fb ) != STATUS_ERR_IO );
+                TEST_CHECK( ram_matches( fb ) );
+        }
+        check_writes();
+        
+        fb->destroy( fb );
+}
+
+/**
+ * \brief Asynchronous updates set the D/C line before every write and hold it, while the write is in flight
+ */
+static void test_update_async (
+  void
+){
+        struct Framebuffer *fb   = setup();
+        uint32_t            seed = 11;
+        
+        for( uint32_t frame = 0; frame < 200; frame++ ){
+                seed = draw_changes( fb, seed );
+                if( ssd1306_display_update_async( &ssd1306, fb, &update, on_done, &done_calls ) == STATUS_OK ){
+                        while( com_driver_ssd1306_emulator_complete( &emulator, STATUS_OK ) ){
+                        }
+                }
+                TEST_CHECK( !ssd1306_display_update_async_busy( &update ) );
+                TEST_CHECK( ram_matches( fb ) );
+        }
+        TEST_CHECK( done_calls > 0 );
+        check_writes();                                 // D/C changes while a write is pending count as errors
+        
+        fb->destroy( fb );
+}
+
+/**
+ * \brief Incremental updates in steps of bounded bytes, the bytes counted are the bytes on the bus
+ */
+static void test_update_step (
+  void
+){
+        struct Framebuffer        *fb   = setup();
+        struct SSD1306_Update_Step step;
+        uint32_t                   seed = 13;
+        
+        for( uint32_t frame = 0; frame < 200; frame++ ){
+                uint32_t const max_bytes = 16 + ( frame % 5 ) * 50;
+                
+                seed = draw_changes( fb, seed );
+                
+                ssd1306_update_begin( &step, &ssd1306, fb );
+                while( !ssd1306_update_done( &step ) ){
+                        com_driver_recorder_reset( &recorder );
+                        TEST_CHECK( ssd1306_update_step( &step, max_bytes ) != STATUS_ERR_IO );
+                        TEST_CHECK( recorder.bytes <= max_bytes );
+                }
+                TEST_CHECK( ram_matches( fb ) );
+        }
+        check_writes();
+        
+        fb->destroy( fb );
+}
+
+int main (
+  void
+){
+        test_init();
+        test_update_all();
+        test_update_differential();
+        test_update_async();
+        test_update_step();
+        
+        return TEST_RESULT();
+}
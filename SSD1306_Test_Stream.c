@@ -0,0 +1,243 @@
+/**     \file   SSD1306_Test_Stream.c
+
+        \brief  Host test of the command streams to the SSD1306.
+ 
+        \license 
+                MIT: The MIT License (https://opensource.org/licenses/MIT)
+                .
+                Permission is hereby granted, free of charge, to any person obtaining a copy of this software 
+                and associated documentation files (the "Software"), to deal in the Software without restriction, 
+                including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+                and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, 
+                subject to the following conditions:
+                .
+                The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+                .
+                THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+                INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. 
+                IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+                WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR 
+                THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ 
+        \copyright
+                DIT: 2026; Drechsler Information Technologies; www.drechsler-it.de
+ 
+        \authors
+                jrgdre: Joerg Drechsler; DIT
+ 
+        \versions
+                1.0.0: 2026-10-17 jrgdre initial release
+
+ */
+#include <string.h>                     // memcmp
+#include "Com_Driver_Recorder.h"        // bus traffic recorder
+#include "Com_Driver_SSD1306_Emulator.h"// display data RAM of the controller
+#include "Framebuffer_SSD1306.h"        // SSD1306 framebuffer
+#include "SSD1306.h"                    // controller tested
+#include "Test.h"                       // checks
+
+static struct SSD1306                     ssd1306         ; //< controller tested
+static struct Com_Driver_Recorder         recorder        ; //< counts the traffic and captures it
+static struct Com_Driver                  emulator_driver ; //< driver of the emulator, downstream of the recorder
+static struct Com_Driver_SSD1306_Emulator emulator        ; //< executes the traffic
+static uint8_t                            capture[256]    ; //< traffic captured
+static uint32_t                           writes_ok       ; //< writes to pass, before failing_write_wait() fails
+
+/**
+ * \brief Set up a controller behind the recorder and the emulator, not initialized
+ */
+static void setup (
+  bool const flip                               //< flip the display
+){
+        memset( &ssd1306, 0x00, sizeof( ssd1306 ) );
+        ssd1306.address            = 0x3C;
+        ssd1306.geometry           = SSD1306_GEOMETRY_128x32;
+        ssd1306.charge_pump_source = SSD1306_CHARGE_PUMP_SOURCE_INTERNAL_VCC;
+        ssd1306.flip_horizontal    = flip;
+        ssd1306.flip_vertical      = flip;
+        
+        com_driver_ssd1306_emulator_init( &emulator_driver, &emulator );
+        recorder.downstream   = &emulator_driver;
+        com_driver_recorder_init( &ssd1306.com_driver, &recorder );
+        recorder.capture      = capture;
+        recorder.capture_size = sizeof( capture );
+}
+
+/**
+ * \brief Pass \ref writes_ok writes on to the emulator, bypassing the recorder, fail the ones after
+ */
+static enum status_code failing_write_wait (
+  void *const com_module, uint16_t const address, uint8_t *const byte_array, uint16_t const cnt_bytes
+){
+        UNUSED( com_module );
+        
+        if( writes_ok == 0 ){
+                return STATUS_ERR_IO;
+        }
+        writes_ok--;
+        
+        return emulator_driver.write_wait( emulator_driver.com_module, address, byte_array, cnt_bytes );
+}
+
+/**
+ * \brief The configuration goes out in one transaction, behind a single control byte
+ */
+static void test_init (
+  void
+){
+        setup( true );
+        
+        TEST_CHECK( ssd1306_init( &ssd1306 ) == STATUS_OK );
+        TEST_CHECK( recorder.transactions  == 1 );
+        TEST_CHECK( recorder.stops         == 1 );
+        TEST_CHECK( recorder.bytes         == 1 + 26 + 2 );
+        TEST_CHECK( capture[0]             == SSD1306_COMMAND );
+        TEST_CHECK( emulator.errors        == 0 );
+        TEST_CHECK( emulator.commands      == 14 + 2 );
+        TEST_CHECK( emulator.command_length == 0 );     // no command left incomplete
+        TEST_CHECK( emulator.addressing_mode == 0 );
+        TEST_CHECK( emulator.page_end      == 3 );
+        TEST_CHECK( emulator.column_end    == SSD1306_COLUMNS - 1 );
+        TEST_CHECK( emulator.send_stop );               // send_stop restored
+}
+
+/**
+ * \brief Commands in a row share a transaction, even more than a stream collects
+ */
+static void test_commands (
+  void
+){
+        uint8_t commands[40];
+        
+        for( uint_fast8_t idx = 0; idx < sizeof( commands ); idx++ ){
+                commands[idx] = SSD1306_SET_DISPLAY_START_LINE | idx;
+        }
+        
+        setup( false );
+        
+        TEST_CHECK( ssd1306_command_sequence_write( &ssd1306, commands, 7 ) == STATUS_OK );
+        TEST_CHECK( recorder.transactions == 1 );
+        TEST_CHECK( recorder.bytes        == 1 + 7 );
+        TEST_CHECK( emulator.start_line   == 6 );
+        
+        com_driver_recorder_reset( &recorder );
+        
+        struct SSD1306_Stream stream;
+        
+        ssd1306_stream_begin( &stream, &ssd1306 );
+        TEST_CHECK( ssd1306_stream_command( &stream, commands, sizeof( commands ) ) == STATUS_OK );
+        TEST_CHECK( recorder.transactions == 1 );       // the first SSD1306_STREAM_COMMANDS_MAX
+        TEST_CHECK( ssd1306_stream_end( &stream ) == STATUS_OK );
+        TEST_CHECK( recorder.transactions == 2 );
+        TEST_CHECK( recorder.bytes        == 2 + sizeof( commands ) );
+        TEST_CHECK( recorder.stops        == 1 );
+        TEST_CHECK( emulator.start_line   == sizeof( commands ) - 1 );
+        TEST_CHECK( emulator.errors       == 0 );
+}
+
+/**
+ * \brief A short command goes into the data transaction, addressing commands go in front of it
+ */
+static void test_commands_data (
+  void
+){
+        uint8_t data[16];
+        uint8_t start_line[] = { SSD1306_SET_DISPLAY_START_LINE | 3 };
+        
+        for( uint_fast8_t idx = 0; idx < sizeof( data ); idx++ ){
+                data[idx] = 0xA0 + idx;
+        }
+        
+        setup( false );
+        TEST_CHECK( ssd1306_init( &ssd1306 ) == STATUS_OK );
+        com_driver_recorder_reset( &recorder );
+        
+        struct SSD1306_Stream stream;
+        
+        ssd1306_stream_begin( &stream, &ssd1306 );
+        ssd1306_stream_command( &stream, start_line, sizeof( start_line ) );
+        TEST_CHECK( ssd1306_stream_data( &stream, data, sizeof( data ) ) == STATUS_OK );
+        TEST_CHECK( ssd1306_stream_end ( &stream ) == STATUS_OK );
+        
+        TEST_CHECK( recorder.transactions == 1 );
+        TEST_CHECK( capture[0] == ( SSD1306_CONTINUATION | SSD1306_COMMAND ) );
+        TEST_CHECK( capture[1] == start_line[0] );
+        TEST_CHECK( capture[2] == SSD1306_DATA );
+        TEST_CHECK( memcmp( &capture[3], data, sizeof( data ) ) == 0 );
+        TEST_CHECK( emulator.start_line == 3 );
+        TEST_CHECK( memcmp( emulator.ram, data, sizeof( data ) ) == 0 );
+        
+        com_driver_recorder_reset( &recorder );
+        
+        TEST_CHECK( ssd1306_set_page_range  ( &ssd1306, 2, 3 )    == STATUS_OK );
+        TEST_CHECK( ssd1306_set_column_range( &ssd1306, 8, 127 )  == STATUS_OK );
+        TEST_CHECK( ssd1306_data_sequence_write( &ssd1306, data, sizeof( data ) ) == STATUS_OK );
+        TEST_CHECK( recorder.transactions == 3 );
+        TEST_CHECK( memcmp( &emulator.ram[ ( 2 * SSD1306_COLUMNS ) + 8 ], data, sizeof( data ) ) == 0 );
+        TEST_CHECK( emulator.errors == 0 );
+}
+
+/**
+ * \brief A differential update holds the bus for all its runs, with two transactions per run
+ */
+static void test_update_gaps (
+  void
+){
+        struct Framebuffer *fb = framebuffer_SSD1306_create( SSD1306_COLUMNS, SSD1306_GEOMETRY_128x32 );
+        
+        setup( false );
+        TEST_CHECK( ssd1306_init( &ssd1306 ) == STATUS_OK );
+        fb->clear( fb );
+        TEST_CHECK( ssd1306_display_update_all( &ssd1306, fb ) == STATUS_OK );
+        
+        fb->set_pixel( fb,  10,  3, 1 );
+        fb->set_pixel( fb, 100,  3, 1 );
+        fb->set_pixel( fb,  50, 20, 1 );
+        
+        com_driver_recorder_reset( &recorder );
+        TEST_CHECK( ssd1306_display_update_differential( &ssd1306, fb ) == STATUS_OK );
+        TEST_CHECK( recorder.transactions == 3 * 2 );
+        TEST_CHECK( recorder.bytes        == 3 * ( ( 1 + 6 ) + ( 1 + 1 ) ) );
+        TEST_CHECK( recorder.stops        == 1 );
+        TEST_CHECK( emulator.errors       == 0 );
+        TEST_CHECK( memcmp( emulator.ram, ( (struct Framebuffer_SSD1306 *)fb->user_data )->tiles, SSD1306_COLUMNS * 4 ) == 0 );
+        
+        fb->destroy( fb );
+}
+
+/**
+ * \brief The first failed write ends the traffic of a stream, its status is kept to the end
+ */
+static void test_failed (
+  void
+){
+        uint8_t data[8]     = { 0 };
+        uint8_t commands[6] = { SSD1306_SET_PAGE_ADRESSES, 0, 3, SSD1306_SET_COLUMN_ADRESSES, 0, 127 };
+        
+        setup( false );
+        ssd1306.com_driver.write_wait = failing_write_wait;
+        writes_ok = 1;
+        
+        struct SSD1306_Stream stream;
+        
+        ssd1306_stream_begin( &stream, &ssd1306 );
+        TEST_CHECK( ssd1306_stream_command( &stream, commands, sizeof( commands ) ) == STATUS_OK );
+        TEST_CHECK( ssd1306_stream_data   ( &stream, data, sizeof( data ) ) == STATUS_ERR_IO );     // commands pass, data fails
+        TEST_CHECK( ssd1306_stream_command( &stream, commands, sizeof( commands ) ) == STATUS_ERR_IO );
+        TEST_CHECK( ssd1306_stream_data   ( &stream, data, sizeof( data ) ) == STATUS_ERR_IO );
+        TEST_CHECK( ssd1306_stream_end    ( &stream ) == STATUS_ERR_IO );
+        TEST_CHECK( emulator.transactions == 1 );
+        TEST_CHECK( emulator.send_stop );
+}
+
+int main (
+  void
+){
+        test_init();
+        test_commands();
+        test_commands_data();
+        test_update_gaps();
+        test_failed();
+        
+        return TEST_RESULT();
+}
@@ -0,0 +1,211 @@
+/**     \file   SSD1306_Test_Update_Async.c
+
+        \brief  Host test of the asynchronous SSD1306 display update.
+ 
+        \license 
+                MIT: The MIT License (https://opensource.org/licenses/MIT)
+                .
+                Permission is hereby granted, free of charge, to any person obtaining a copy of this software 
+                and associated documentation files (the "Software"), to deal in the Software without restriction, 
+                including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+                and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, 
+                subject to the following conditions:
+                .
+                The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+                .
+                THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+                INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. 
+                IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+                WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR 
+                THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ 
+        \copyright
+                DIT: 2026; Drechsler Information Technologies; www.drechsler-it.de
+ 
+        \authors
+                jrgdre: Joerg Drechsler; DIT
+ 
+        \versions
+                1.0.0: 2026-10-17 jrgdre initial release
+
+ */
+#include <string.h>                     // memcmp
+#include "Com_Driver_SSD1306_Emulator.h"// display data RAM of the controller
+#include "Framebuffer_SSD1306.h"        // SSD1306 framebuffer
+#include "SSD1306.h"                    // controller tested
+#include "Test.h"                       // checks
+
+static struct SSD1306                     ssd1306         ; //< controller tested
+static struct Com_Driver_SSD1306_Emulator emulator        ; //< executes the traffic, completes the writes
+static struct SSD1306_Update_Async        update          ; //< state of the update tested
+static uint32_t                           done_calls      ; //< number of calls of on_done
+static enum status_code                   done_status     ; //< status on_done was called with last
+
+/**
+ * \brief Completion handler of the updates: counts its calls
+ */
+static void on_done (
+  void             *const user_data             //< &done_calls
+, enum status_code  const status                //< status of the update
+){
+        TEST_CHECK( user_data == &done_calls );
+        TEST_CHECK( !ssd1306_display_update_async_busy( &update ) );   // on_done may start the next update
+        
+        done_calls++;
+        done_status = status;
+}
+
+/**
+ * \brief Set up an initialized controller behind the emulator, with an idle update
+ */
+static void setup (
+  void
+){
+        memset( &ssd1306, 0x00, sizeof( ssd1306 ) );
+        ssd1306.address            = 0x3C;
+        ssd1306.geometry           = SSD1306_GEOMETRY_128x64;
+        ssd1306.charge_pump_source = SSD1306_CHARGE_PUMP_SOURCE_INTERNAL_VCC;
+        
+        com_driver_ssd1306_emulator_init( &ssd1306.com_driver, &emulator );
+        memset( emulator.ram, 0x00, sizeof( emulator.ram ) );  // like the framebuffers created
+        
+        TEST_CHECK( ssd1306_init( &ssd1306 ) == STATUS_OK );
+        
+        memset( &update, 0x00, sizeof( update ) );
+        done_calls  = 0;
+        done_status = STATUS_OK;
+}
+
+/**
+ * \brief Complete the writes of the update in flight, like the bus interrupt would
+ *
+ * \return Number of writes completed.
+ */
+static uint32_t complete_all (
+  void
+){
+        uint32_t writes = 0;
+        
+        while( com_driver_ssd1306_emulator_complete( &emulator, STATUS_OK ) ){
+                writes++;
+        }
+        return writes;
+}
+
+/**
+ * \brief Check whether the display data RAM shows the framebuffer
+ */
+static bool ram_matches (
+  struct Framebuffer *const fb                  //< framebuffer to compare with
+){
+        struct Framebuffer_SSD1306 *fb_ssd1306 = (struct Framebuffer_SSD1306 *)fb->user_data;
+        
+        return memcmp( emulator.ram, fb_ssd1306->tiles, fb_ssd1306->bytes ) == 0;
+}
+
+/**
+ * \brief An update returns at once, holds the bus, sends every tile from the completions and calls on_done once
+ */
+static void test_update (
+  void
+){
+        struct Framebuffer *fb = framebuffer_SSD1306_create( SSD1306_COLUMNS, SSD1306_GEOMETRY_128x64 );
+        
+        fb->clear( fb );                                // the tiles of a new framebuffer are undefined
+        
+        setup();
+        fb->fill_rect( fb, 0, 0, 128, 64, 1 );
+        
+        TEST_CHECK( ssd1306_display_update_async( &ssd1306, fb, &update, on_done, &done_calls ) == STATUS_OK );
+        TEST_CHECK( ssd1306_display_update_async_busy( &update ) );
+        TEST_CHECK( update.status    == STATUS_BUSY );
+        TEST_CHECK( emulator.pending != NULL );
+        TEST_CHECK( !emulator.send_stop );              // the bus is held
+        TEST_CHECK( done_calls       == 0 );
+        TEST_CHECK( ssd1306_display_update_async( &ssd1306, fb, &update, on_done, &done_calls ) == STATUS_BUSY );
+        
+        fb->set_pixel( fb, 5, 5, 0 );                   // drawn while in flight: goes out with the next update
+        
+        TEST_CHECK( complete_all() > 1 );
+        TEST_CHECK( !ssd1306_display_update_async_busy( &update ) );
+        TEST_CHECK( done_calls  == 1 );
+        TEST_CHECK( done_status == STATUS_OK );
+        TEST_CHECK( update.status == STATUS_OK );
+        TEST_CHECK( emulator.send_stop );               // the bus is released with its setting restored
+        TEST_CHECK( emulator.errors == 0 );
+        TEST_CHECK( ( (struct Framebuffer_SSD1306 *)fb->user_data )->tiles_dirty_count == 1 );
+        
+        TEST_CHECK( ssd1306_display_update_async( &ssd1306, fb, &update, on_done, &done_calls ) == STATUS_OK );
+        TEST_CHECK( complete_all() > 0 );
+        TEST_CHECK( done_calls == 2 );
+        TEST_CHECK( ram_matches( fb ) );
+        
+        TEST_CHECK( ssd1306_display_update_async( &ssd1306, fb, &update, on_done, &done_calls ) == STATUS_NO_CHANGE );
+        TEST_CHECK( emulator.pending == NULL );
+        TEST_CHECK( done_calls       == 2 );
+        
+        fb->destroy( fb );
+}
+
+/**
+ * \brief A failed write ends the update with its status, the next update sends the lost tiles again
+ */
+static void test_update_failed (
+  void
+){
+        struct Framebuffer *fb = framebuffer_SSD1306_create( SSD1306_COLUMNS, SSD1306_GEOMETRY_128x64 );
+        
+        fb->clear( fb );                                // the tiles of a new framebuffer are undefined
+        
+        setup();
+        fb->fill_rect( fb, 10, 10, 100, 40, 1 );
+        
+        TEST_CHECK( ssd1306_display_update_async( &ssd1306, fb, &update, on_done, &done_calls ) == STATUS_OK );
+        TEST_CHECK( com_driver_ssd1306_emulator_complete( &emulator, STATUS_OK ) );
+        TEST_CHECK( com_driver_ssd1306_emulator_complete( &emulator, STATUS_ERR_IO ) );
+        TEST_CHECK( emulator.pending == NULL );
+        TEST_CHECK( !ssd1306_display_update_async_busy( &update ) );
+        TEST_CHECK( done_calls    == 1 );
+        TEST_CHECK( done_status   == STATUS_ERR_IO );
+        TEST_CHECK( update.status == STATUS_ERR_IO );
+        TEST_CHECK( emulator.send_stop );
+        
+        TEST_CHECK( ssd1306_display_update_async( &ssd1306, fb, &update, on_done, &done_calls ) == STATUS_OK );
+        complete_all();
+        TEST_CHECK( done_calls  == 2 );
+        TEST_CHECK( done_status == STATUS_OK );
+        TEST_CHECK( ram_matches( fb ) );
+        
+        fb->destroy( fb );
+}
+
+/**
+ * \brief A com driver without asynchronous writes is refused
+ */
+static void test_unsupported (
+  void
+){
+        struct Framebuffer *fb = framebuffer_SSD1306_create( SSD1306_COLUMNS, SSD1306_GEOMETRY_128x64 );
+        
+        fb->clear( fb );                                // the tiles of a new framebuffer are undefined
+        
+        setup();
+        ssd1306.com_driver.write_async = NULL;
+        fb->set_pixel( fb, 0, 0, 1 );
+        
+        TEST_CHECK( ssd1306_display_update_async( &ssd1306, fb, &update, on_done, &done_calls ) == STATUS_ERR_UNSUPPORTED_DEV );
+        TEST_CHECK( !ssd1306_display_update_async_busy( &update ) );
+        TEST_CHECK( done_calls == 0 );
+        
+        fb->destroy( fb );
+}
+
+int main (
+  void
+){
+        test_update();
+        test_update_failed();
+        test_unsupported();
+        
+        return TEST_RESULT();
+}
@@ -0,0 +1,249 @@
+/**     \file   SSD1306_Test_Update_Plan.c
+
+        \brief  Host test and benchmark of the SSD1306 update planner.
+ 
+        \license 
+                MIT: The MIT License (https://opensource.org/licenses/MIT)
+                .
+                Permission is hereby granted, free of charge, to any person obtaining a copy of this software 
+                and associated documentation files (the "Software"), to deal in the Software without restriction, 
+                including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+                and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, 
+                subject to the following conditions:
+                .
+                The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+                .
+                THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+                INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. 
+                IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+                WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR 
+                THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ 
+        \copyright
+                DIT: 2026; Drechsler Information Technologies; www.drechsler-it.de
+ 
+        \authors
+                jrgdre: Joerg Drechsler; DIT
+ 
+        \versions
+                1.0.0: 2026-10-17 jrgdre initial release
+
+ */
+#include <string.h>                     // memcmp
+#include "Com_Driver_Recorder.h"        // bus traffic recorder
+#include "Com_Driver_SSD1306_Emulator.h"// display data RAM of the controller
+#include "Framebuffer_SSD1306.h"        // SSD1306 framebuffer
+#include "SSD1306.h"                    // controller tested
+#include "Test.h"                       // checks
+
+#define PLAN_RUNS_MAX                   ( SSD1306_COLUMNS * SSD1306_RAM_PAGES ) //< enough runs for any dirty map
+
+static struct SSD1306                     ssd1306         ; //< controller tested
+static struct Com_Driver_Recorder         recorder        ; //< counts the traffic
+static struct Com_Driver                  emulator_driver ; //< driver of the emulator, downstream of the recorder
+static struct Com_Driver_SSD1306_Emulator emulator        ; //< executes the traffic
+static struct SSD1306_Tile_Run            runs[PLAN_RUNS_MAX]; //< runs planned or found
+
+/**
+ * \brief A dirty pattern of a workload
+ */
+typedef void Workload_Draw( struct Framebuffer *const fb );
+
+static void draw_single_tile( struct Framebuffer *const fb ){
+        fb->set_pixel( fb, 64, 10, 1 );
+}
+
+static void draw_text_line( struct Framebuffer *const fb ){       // characters with a clean column in between
+        for( uint32_t x = 0; x < 100; x++ ){
+                if(( x % 6 ) != 5 ){
+                        fb->fill_vspan( fb, x, 16, 8, 1 );
+                }
+        }
+}
+
+static void draw_two_blocks( struct Framebuffer *const fb ){      // a gap too large to send along
+        fb->fill_rect( fb, 10, 16, 11, 8, 1 );
+        fb->fill_rect( fb, 60, 16, 11, 8, 1 );
+}
+
+static void draw_scattered( struct Framebuffer *const fb ){       // a tile every 16 columns on every page
+        for( uint32_t y = 0; y < fb->height; y += 8 ){
+                for( uint32_t x = 0; x < fb->width; x += 16 ){
+                        fb->set_pixel( fb, x, y, 1 );
+                }
+        }
+}
+
+static void draw_page_wrap( struct Framebuffer *const fb ){       // a run from the end of a page to the start of the next one
+        fb->fill_rect( fb, 100, 8, 28, 8, 1 );
+        fb->fill_rect( fb,   0, 16, 20, 8, 1 );
+}
+
+static void draw_full( struct Framebuffer *const fb ){
+        fb->fill_rect( fb, 0, 0, fb->width, fb->height, 1 );
+}
+
+static struct {
+        char    const *name;
+        Workload_Draw *draw;
+} const workloads[] = {
+        { "single tile", draw_single_tile },
+        { "text line"  , draw_text_line   },
+        { "two blocks" , draw_two_blocks  },
+        { "scattered"  , draw_scattered   },
+        { "page wrap"  , draw_page_wrap   },
+        { "full frame" , draw_full        },
+};
+
+/**
+ * \brief Set up an initialized controller behind the recorder and the emulator
+ */
+static void setup (
+  enum SSD1306_Geometry const geometry          //< geometry of the display
+){
+        memset( &ssd1306, 0x00, sizeof( ssd1306 ) );
+        ssd1306.address            = 0x3C;
+        ssd1306.geometry           = geometry;
+        ssd1306.charge_pump_source = SSD1306_CHARGE_PUMP_SOURCE_INTERNAL_VCC;
+        
+        com_driver_ssd1306_emulator_init( &emulator_driver, &emulator );
+        recorder.downstream = &emulator_driver;
+        com_driver_recorder_init( &ssd1306.com_driver, &recorder );
+        
+        TEST_CHECK( ssd1306_init( &ssd1306 ) == STATUS_OK );
+}
+
+/**
+ * \brief Check whether the display data RAM shows the framebuffer
+ */
+static bool ram_matches (
+  struct Framebuffer *const fb                  //< framebuffer to compare with
+){
+        struct Framebuffer_SSD1306 *fb_ssd1306 = (struct Framebuffer_SSD1306 *)fb->user_data;
+        
+        for( uint_fast16_t page = 0; page < fb_ssd1306->pages; page++ ){
+                uint8_t const *ram = &emulator.ram[ ( ( page + ssd1306.page_origin ) % SSD1306_RAM_PAGES ) * SSD1306_COLUMNS ];
+                
+                if( memcmp( ram, &fb_ssd1306->tiles[ page * fb_ssd1306->columns ], fb_ssd1306->columns ) != 0 ){
+                        return false;
+                }
+        }
+        return true;
+}
+
+/**
+ * \brief Plan all dirty tiles of the framebuffer
+ *
+ * \return Number of runs planned.
+ */
+static uint16_t plan (
+  struct Framebuffer *const fb                  //< framebuffer to plan the update for
+){
+        uint32_t tile_idx = 0;
+        
+        return ssd1306_update_plan( &ssd1306, fb, &tile_idx, runs, PLAN_RUNS_MAX );
+}
+
+/**
+ * \brief Collect the runs of consecutive dirty tiles, without merging any
+ *
+ * \return Number of runs found.
+ */
+static uint16_t runs_unmerged (
+  struct Framebuffer *const fb                  //< framebuffer to find the runs in
+){
+        struct Framebuffer_SSD1306 *fb_ssd1306 = (struct Framebuffer_SSD1306 *)fb->user_data;
+        uint16_t                    runs_count = 0;
+        
+        for( uint32_t idx = framebuffer_ssd1306_dirty_find( fb_ssd1306->tiles_dirty, fb_ssd1306->bytes, 0, true );
+             idx < fb_ssd1306->bytes;
+             idx = framebuffer_ssd1306_dirty_find( fb_ssd1306->tiles_dirty, fb_ssd1306->bytes, idx, true )
+        ){
+                uint32_t idx_end = framebuffer_ssd1306_dirty_find( fb_ssd1306->tiles_dirty, fb_ssd1306->bytes, idx, false );
+                
+                runs[ runs_count ].tile_idx = idx;
+                runs[ runs_count ].length   = idx_end - idx;
+                runs_count++;
+                idx = idx_end;
+        }
+        
+        return runs_count;
+}
+
+/**
+ * \brief Plan and send every workload, the plan costs no more than the runs unmerged or the whole frame,
+ *         and the cost modeled is the traffic sent.
+ */
+static void test_workloads (
+  enum SSD1306_Geometry const geometry          //< geometry of the display
+){
+        struct Framebuffer *fb = framebuffer_SSD1306_create( SSD1306_COLUMNS, geometry );
+        
+        setup( geometry );
+        printf( "128x%u\r\n", (unsigned)geometry );
+        
+        for( uint_fast8_t w = 0; w < sizeof( workloads ) / sizeof( workloads[0] ); w++ ){
+                fb->clear( fb );
+                TEST_CHECK( ssd1306_display_update_all( &ssd1306, fb ) == STATUS_OK );
+                
+                workloads[w].draw( fb );
+                
+                uint32_t const cost_unmerged = ssd1306_update_plan_cost( &ssd1306, fb, runs, runs_unmerged( fb ) );
+                uint16_t const runs_count    = plan( fb );
+                uint32_t const cost_plan     = ssd1306_update_plan_cost( &ssd1306, fb, runs, runs_count );
+                struct SSD1306_Tile_Run const all = { 0, ( (struct Framebuffer_SSD1306 *)fb->user_data )->bytes };
+                uint32_t const cost_all      = ssd1306_update_plan_cost( &ssd1306, fb, &all, 1 );
+                
+                TEST_CHECK( cost_plan <= cost_unmerged );
+                TEST_CHECK( cost_plan <= cost_all      );
+                
+                com_driver_recorder_reset( &recorder );
+                TEST_CHECK( ssd1306_display_update( &ssd1306, fb ) == STATUS_OK );
+                TEST_CHECK( ram_matches( fb ) );
+                TEST_CHECK( emulator.errors == 0 );
+                
+                uint32_t const cost_sent = ( recorder.transactions * SSD1306_BUS_COST_I2C_TRANSACTION )
+                                         + ( recorder.bytes        * SSD1306_BUS_COST_I2C_BYTE        );
+                
+                TEST_CHECK( cost_sent == cost_plan );
+                
+                printf( "%-12s runs %3u  cost plan %6lu  unmerged %6lu  whole frame %6lu  sent %6lu\r\n"
+                      , workloads[w].name
+                      , (unsigned)runs_count
+                      , (unsigned long)cost_plan
+                      , (unsigned long)cost_unmerged
+                      , (unsigned long)cost_all
+                      , (unsigned long)cost_sent
+                );
+        }
+        
+        fb->destroy( fb );
+}
+
+/**
+ * \brief The cost of a run follows the columns of the framebuffer, not the ones of the controller
+ */
+static void test_cost_columns (
+  void
+){
+        struct Framebuffer *fb = framebuffer_SSD1306_create( 64, 32 );
+        
+        struct SSD1306_Tile_Run const in_page = {  0, 40 };
+        struct SSD1306_Tile_Run const wraps   = { 40, 40 }; // runs from page 0 into page 1
+        
+        setup( SSD1306_GEOMETRY_128x32 );
+        
+        TEST_CHECK( ssd1306_update_plan_cost( &ssd1306, fb, &wraps, 1 ) > ssd1306_update_plan_cost( &ssd1306, fb, &in_page, 1 ) );
+        
+        fb->destroy( fb );
+}
+
+int main (
+  void
+){
+        test_workloads( SSD1306_GEOMETRY_128x32 );
+        test_workloads( SSD1306_GEOMETRY_128x64 );
+        test_cost_columns();
+        
+        return TEST_RESULT();
+}
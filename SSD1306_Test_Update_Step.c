@@ -0,0 +1,254 @@
+/**     \file   SSD1306_Test_Update_Step.c
+
+        \brief  Host test of the incremental SSD1306 display update.
+ 
+        \license 
+                MIT: The MIT License (https://opensource.org/licenses/MIT)
+                .
+                Permission is hereby granted, free of charge, to any person obtaining a copy of this software 
+                and associated documentation files (the "Software"), to deal in the Software without restriction, 
+                including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+                and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, 
+                subject to the following conditions:
+                .
+                The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+                .
+                THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+                INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. 
+                IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+                WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR 
+                THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ 
+        \copyright
+                DIT: 2026; Drechsler Information Technologies; www.drechsler-it.de
+ 
+        \authors
+                jrgdre: Joerg Drechsler; DIT
+ 
+        \versions
+                1.0.0: 2026-10-17 jrgdre initial release
+
+ */
+#include <string.h>                     // memcmp
+#include "Com_Driver_Recorder.h"        // bus traffic recorder
+#include "Com_Driver_SSD1306_Emulator.h"// display data RAM of the controller
+#include "Framebuffer_SSD1306.h"        // SSD1306 framebuffer
+#include "SSD1306.h"                    // controller tested
+#include "Test.h"                       // checks
+
+static struct SSD1306                     ssd1306         ; //< controller tested
+static struct Com_Driver_Recorder         recorder        ; //< counts the traffic
+static struct Com_Driver                  emulator_driver ; //< driver of the emulator, downstream of the recorder
+static struct Com_Driver_SSD1306_Emulator emulator        ; //< executes the traffic
+static uint32_t                           writes_ok       ; //< writes to pass, before failing_write_wait() fails
+
+/**
+ * \brief Set up an initialized controller behind the recorder and the emulator and a framebuffer in sync with it
+ */
+static struct Framebuffer *setup (
+  uint16_t const data_burst_length              //< max. data bytes per transaction (0: default)
+){
+        struct Framebuffer *fb = framebuffer_SSD1306_create( SSD1306_COLUMNS, SSD1306_GEOMETRY_128x64 );
+        
+        memset( &ssd1306, 0x00, sizeof( ssd1306 ) );
+        ssd1306.address            = 0x3C;
+        ssd1306.geometry           = SSD1306_GEOMETRY_128x64;
+        ssd1306.charge_pump_source = SSD1306_CHARGE_PUMP_SOURCE_INTERNAL_VCC;
+        ssd1306.data_burst_length  = data_burst_length;
+        
+        com_driver_ssd1306_emulator_init( &emulator_driver, &emulator );
+        recorder.downstream = &emulator_driver;
+        com_driver_recorder_init( &ssd1306.com_driver, &recorder );
+        
+        TEST_CHECK( ssd1306_init( &ssd1306 ) == STATUS_OK );
+        
+        fb->clear( fb );
+        TEST_CHECK( ssd1306_display_update_all( &ssd1306, fb ) == STATUS_OK );
+        
+        return fb;
+}
+
+/**
+ * \brief Check whether the display data RAM shows the framebuffer
+ */
+static bool ram_matches (
+  struct Framebuffer *const fb                  //< framebuffer to compare with
+){
+        struct Framebuffer_SSD1306 *fb_ssd1306 = (struct Framebuffer_SSD1306 *)fb->user_data;
+        
+        return memcmp( emulator.ram, fb_ssd1306->tiles, fb_ssd1306->bytes ) == 0;
+}
+
+/**
+ * \brief Draw a pseudo random pattern
+ */
+static void draw_noise (
+  struct Framebuffer *const fb                  //< framebuffer to draw to
+,            uint32_t       seed                //< start of the random sequence
+){
+        for( uint32_t y = 0; y < fb->height; y++ ){
+                for( uint32_t x = 0; x < fb->width; x++ ){
+                        seed = ( seed * 1103515245 ) + 12345;
+                        fb->set_pixel( fb, x, y, ( seed >> 16 ) & 1 );
+                }
+        }
+}
+
+/**
+ * \brief Pass \ref writes_ok writes on to the emulator, bypassing the recorder, fail the ones after
+ */
+static enum status_code failing_write_wait (
+  void *const com_module, uint16_t const address, uint8_t *const byte_array, uint16_t const cnt_bytes
+){
+        UNUSED( com_module );
+        
+        if( writes_ok == 0 ){
+                return STATUS_ERR_IO;
+        }
+        writes_ok--;
+        
+        return emulator_driver.write_wait( emulator_driver.com_module, address, byte_array, cnt_bytes );
+}
+
+/**
+ * \brief Run an incremental update to its end, no step writes more than \ref max_bytes bytes
+ *
+ * \return Number of steps taken.
+ */
+static uint32_t update_steps (
+  struct Framebuffer *const fb                  //< framebuffer to update the display with
+,            uint32_t const max_bytes           //< max. number of bytes per step
+){
+        struct SSD1306_Update_Step update;
+        uint32_t                   steps = 0;
+        
+        ssd1306_update_begin( &update, &ssd1306, fb );
+        
+        while( !ssd1306_update_done( &update ) ){
+                com_driver_recorder_reset( &recorder );
+                TEST_CHECK( ssd1306_update_step( &update, max_bytes ) != STATUS_ERR_IO );
+                TEST_CHECK( recorder.bytes <= max_bytes );
+                TEST_CHECK( recorder.stops == 1 );      // the bus is released after every step
+                steps++;
+        }
+        TEST_CHECK( ssd1306_update_step( &update, max_bytes ) == STATUS_OK );
+        
+        return steps;
+}
+
+/**
+ * \brief A whole frame goes out in steps of bounded bytes, for several budgets and burst lengths
+ */
+static void test_budgets (
+  void
+){
+        static uint32_t const budgets[] = { 16, 64, 200, 1100, 5000 };
+        static uint16_t const bursts [] = { 0, 16 };
+        
+        for( uint_fast8_t b = 0; b < sizeof( bursts ) / sizeof( bursts[0] ); b++ ){
+                for( uint_fast8_t m = 0; m < sizeof( budgets ) / sizeof( budgets[0] ); m++ ){
+                        struct Framebuffer *fb = setup( bursts[b] );
+                        
+                        draw_noise( fb, budgets[m] );
+                        
+                        uint32_t steps = update_steps( fb, budgets[m] );
+                        
+                        TEST_CHECK( steps >= ( SSD1306_COLUMNS * SSD1306_RAM_PAGES ) / budgets[m] );
+                        TEST_CHECK( ram_matches( fb ) );
+                        TEST_CHECK( emulator.errors == 0 );
+                        TEST_CHECK( ( (struct Framebuffer_SSD1306 *)fb->user_data )->tiles_dirty_count == 0 );
+                        
+                        fb->destroy( fb );
+                }
+        }
+}
+
+/**
+ * \brief A budget too small for a tile still sends a tile per step
+ */
+static void test_budget_too_small (
+  void
+){
+        struct Framebuffer *fb = setup( 0 );
+        struct SSD1306_Update_Step update;
+        
+        fb->fill_rect( fb, 0, 0, 5, 8, 1 );
+        
+        ssd1306_update_begin( &update, &ssd1306, fb );
+        for( uint_fast8_t tile = 0; tile < 5; tile++ ){
+                TEST_CHECK( ssd1306_update_step( &update, 1 ) == ( tile < 4 ? STATUS_BUSY : STATUS_OK ) );
+        }
+        TEST_CHECK( ssd1306_update_done( &update ) );
+        TEST_CHECK( ram_matches( fb ) );
+        
+        fb->destroy( fb );
+}
+
+/**
+ * \brief Tiles drawn between steps are sent by this update, if the scan hasn't passed them, else by the next one
+ */
+static void test_draw_between_steps (
+  void
+){
+        struct Framebuffer *fb = setup( 0 );
+        struct SSD1306_Update_Step update;
+        
+        fb->fill_rect( fb, 0, 0, 128, 16, 1 );         // pages 0 and 1
+        
+        ssd1306_update_begin( &update, &ssd1306, fb );
+        TEST_CHECK( ssd1306_update_step( &update, 100 ) == STATUS_BUSY );
+        
+        fb->set_pixel( fb,   0,  0, 0 );                // passed already
+        fb->set_pixel( fb, 127, 63, 1 );                // ahead of the scan
+        
+        while( ssd1306_update_step( &update, 100 ) == STATUS_BUSY ){
+        }
+        TEST_CHECK( update.status == STATUS_OK );
+        TEST_CHECK( emulator.ram[ ( 7 * SSD1306_COLUMNS ) + 127 ] == 0x80 );
+        TEST_CHECK( emulator.ram[ 0 ] == 0xFF );
+        TEST_CHECK( ( (struct Framebuffer_SSD1306 *)fb->user_data )->tiles_dirty_count == 1 );
+        
+        update_steps( fb, 100 );
+        TEST_CHECK( ram_matches( fb ) );
+        
+        fb->destroy( fb );
+}
+
+/**
+ * \brief A failed write ends the update with its status, the next update sends everything again
+ */
+static void test_failed (
+  void
+){
+        struct Framebuffer *fb = setup( 0 );
+        struct SSD1306_Update_Step update;
+        
+        draw_noise( fb, 7 );
+        
+        ssd1306.com_driver.write_wait = failing_write_wait;
+        writes_ok = 3;
+        
+        ssd1306_update_begin( &update, &ssd1306, fb );
+        while( ssd1306_update_step( &update, 64 ) == STATUS_BUSY ){
+        }
+        TEST_CHECK( update.status == STATUS_ERR_IO );
+        TEST_CHECK( ssd1306_update_done( &update ) );
+        TEST_CHECK( ( (struct Framebuffer_SSD1306 *)fb->user_data )->tiles_dirty_count == SSD1306_COLUMNS * SSD1306_RAM_PAGES );
+        
+        com_driver_recorder_init( &ssd1306.com_driver, &recorder );
+        update_steps( fb, 64 );
+        TEST_CHECK( ram_matches( fb ) );
+        
+        fb->destroy( fb );
+}
+
+int main (
+  void
+){
+        test_budgets();
+        test_budget_too_small();
+        test_draw_between_steps();
+        test_failed();
+        
+        return TEST_RESULT();
+}
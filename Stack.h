@@ -1,6 +1,6 @@
 /** \file  Stack.h
 
-    \brief Declaration of a simple stack.
+    \brief Declaration of typed, bounded stacks on caller provided storage.
 
     \license 
            MIT:        The MIT License (https://opensource.org/licenses/MIT)
@@ -35,86 +35,122 @@
 #include <asf.h>
 
 /**
- * Type of the entries on the stack.
- */
-#define Entry uint16_t        
-
-/**
- * Forward declaration of the stack struct.
- */
-typedef struct Stack Stack;
-
-/**
- * Allocate memory for a stack with an \ref initial_capacity.
- * and initialize stack status variables.
+ * Declare a stack type \ref type_name for entries of \ref entry_type and the functions to use it:
  *
- * \note The stack is self growing (see \ref stack_push()).
- *       Start with a reasonable low estimate for the initial capacity.
+ *      prefix_init  ()  use an array as the storage of the stack
+ *      prefix_clear ()  remove all entries, keep the statistics
+ *      prefix_push  ()  put one entry on top of the stack
+ *      prefix_push_n()  put n entries on top of the stack, all or none
+ *      prefix_pop   ()  remove the top entry from the stack
+ *      prefix_pop_n ()  remove the top n entries from the stack, all or none, in the order they were pushed
  *
- * \return Status of operation.
- * \retval STATUS_OK                    If operation was successfully
- * \retval STATUS_ERR_INVALID_ARG       If \ref stack is not assigned or initial_capacity < 1
- * \retval STATUS_ERR_NO_MEMORY         If \ref stack had to be reallocated, but there was no memory
- */
-uint8_t stack_allocate(
-  Stack   **stack                       //< [out] pointer to a stack structure
-, uint8_t   const initial_capacity      //< [in]  initial capacity of the stack (> 0)
-);
-
-/**
- * Deallocate the memory the stack uses 
- * and reset the stack status variables.
+ * The stack never allocates memory. Its storage is an array the user provides, static or on the call stack,
+ * so the worst case RAM is known at compile time. \ref count_max records the most entries the stack ever held
+ * and \ref overflows the number of pushes rejected, to size the array from real world use.
  *
- * \return Status of operation.
- * \retval STATUS_OK                    If operation was successfully
- * \retval STATUS_ERR_INVALID_ARG       If \ref stack is not assigned 
- */
-uint8_t stack_deallocate(
-  Stack **stack                         //< [in/out] pointer to the stack structure to deallocate
-);
-
-/**
- * Return and remove the top entry from the stack
+ * \code
+ *      STACK_DECLARE( Point_Stack, point_stack, uint16_t )
  *
- * \return Status of operation.
- * \retval STATUS_OK                    If operation was successfully
- * \retval STATUS_ERR_INVALID_ARG       If \ref stack or entry is not assigned
- * \retval STATUS_ERR_NOT_FOUND         If \ref stack has no more entries
- */
-uint8_t stack_pop(
-  Stack *const stack                    //< [in]  stack to pop entry from
-, Entry *const entry                    //< [out] value retrieved from stack
-);
-
-/**
- * Put an \ref entry on top of the stack.
+ *      static uint16_t           point_entries[64];
+ *      static struct Point_Stack points = STACK_INITIALIZER( point_entries );
  *
- * If the stack is not large enough for another entry
- * this function tries to allocate more memory.
+ *      uint16_t xy[2] = { x, y };
+ *      point_stack_push_n( &points, xy, 2 );  // a (x,y) pair is pushed and popped as one record
+ * \endcode
  *
- * \return Status of operation.
- * \retval STATUS_OK                    If operation was successfully
- * \retval STATUS_ERR_INVALID_ARG       If \ref stack is not assigned
- * \retval STATUS_ERR_NO_MEMORY         If \ref stack had to be reallocated, but there was no memory
+ * \note The functions are not interrupt safe. If a stack is shared with an interrupt handler, the user has to
+ *       lock out the interrupt around the calls.
  */
-uint8_t stack_push(
-  Stack *const stack                    //< [in] stack to push entry to
-, Entry  const entry                    //< [in] value to push to stack
-);
+#define STACK_DECLARE( type_name, prefix, entry_type )                                                          \
+                                                                                                                \
+struct type_name {                                                                                              \
+        entry_type *entries;            /*< storage of the stack */                                             \
+          uint32_t  capacity;           /*< number of entries that fit into entries */                          \
+          uint32_t  count;              /*< number of entries on the stack */                                   \
+          uint32_t  count_max;          /*< most entries ever on the stack (high-water mark) */                 \
+          uint32_t  overflows;          /*< number of pushes rejected, because the stack was full */            \
+};                                                                                                              \
+                                                                                                                \
+static inline enum status_code prefix##_init (                                                                  \
+  struct type_name *const stack                                                                                 \
+,       entry_type *const entries                                                                               \
+,         uint32_t  const capacity                                                                              \
+){                                                                                                              \
+        if(( stack == NULL ) || ( entries == NULL ) || ( capacity < 1 )){                                       \
+                return STATUS_ERR_INVALID_ARG;                                                                  \
+        }                                                                                                       \
+        stack->entries   = entries;                                                                             \
+        stack->capacity  = capacity;                                                                            \
+        stack->count     = 0;                                                                                   \
+        stack->count_max = 0;                                                                                   \
+        stack->overflows = 0;                                                                                   \
+        return STATUS_OK;                                                                                       \
+}                                                                                                               \
+                                                                                                                \
+static inline void prefix##_clear (                                                                             \
+  struct type_name *const stack                                                                                 \
+){                                                                                                              \
+        stack->count = 0;                                                                                       \
+}                                                                                                               \
+                                                                                                                \
+static inline enum status_code prefix##_push_n (                                                                \
+  struct type_name *const stack                                                                                 \
+, entry_type const *const entries                                                                               \
+,         uint32_t  const n                                                                                     \
+){                                                                                                              \
+        if(( stack == NULL ) || ( entries == NULL )){                                                           \
+                return STATUS_ERR_INVALID_ARG;                                                                  \
+        }                                                                                                       \
+        if( n > stack->capacity - stack->count ){                                                               \
+                stack->overflows++;                                                                             \
+                return STATUS_ERR_NO_MEMORY;                                                                    \
+        }                                                                                                       \
+        for( uint32_t i = 0; i < n; i++ ){                                                                      \
+                stack->entries[stack->count++] = entries[i];                                                    \
+        }                                                                                                       \
+        if( stack->count > stack->count_max ){                                                                  \
+                stack->count_max = stack->count;                                                                \
+        }                                                                                                       \
+        return STATUS_OK;                                                                                       \
+}                                                                                                               \
+                                                                                                                \
+static inline enum status_code prefix##_push (                                                                  \
+  struct type_name *const stack                                                                                 \
+,       entry_type  const entry                                                                                 \
+){                                                                                                              \
+        return prefix##_push_n( stack, &entry, 1 );                                                             \
+}                                                                                                               \
+                                                                                                                \
+static inline enum status_code prefix##_pop_n (                                                                 \
+  struct type_name *const stack                                                                                 \
+,       entry_type *const entries                                                                               \
+,         uint32_t  const n                                                                                     \
+){                                                                                                              \
+        if(( stack == NULL ) || ( entries == NULL )){                                                           \
+                return STATUS_ERR_INVALID_ARG;                                                                  \
+        }                                                                                                       \
+        if( n > stack->count ){                                                                                 \
+                return STATUS_ERR_NOT_FOUND;                                                                    \
+        }                                                                                                       \
+        stack->count -= n;                                                                                      \
+        for( uint32_t i = 0; i < n; i++ ){                                                                      \
+                entries[i] = stack->entries[stack->count + i];                                                  \
+        }                                                                                                       \
+        return STATUS_OK;                                                                                       \
+}                                                                                                               \
+                                                                                                                \
+static inline enum status_code prefix##_pop (                                                                   \
+  struct type_name *const stack                                                                                 \
+,       entry_type *const entry                                                                                 \
+){                                                                                                              \
+        return prefix##_pop_n( stack, entry, 1 );                                                               \
+}
 
 /**
- * Change the capacity of the stack.
- *
- * \note If \ref new_capacity < 1 this function calls \ref stack_deallocate().
+ * Initializer for a stack declared with \ref STACK_DECLARE(), that uses the array \ref entries as its storage.
  *
- * \return Status of operation.
- * \retval STATUS_OK                    If operation was successfully
- * \retval STATUS_ERR_INVALID_ARG       If \ref stack is not assigned
- * \retval STATUS_ERR_NO_MEMORY         If \ref stack had to be reallocated, but there was no memory
+ * \ref entries has to be an array (not a pointer), its size is the capacity of the stack.
  */
-uint8_t stack_realloc(
-  Stack   *stack                        //< [in] stack structure to allocate
-, uint8_t  const new_capacity           //< [in] new capacity of the stack
-);
+#define STACK_INITIALIZER( entries ) { (entries), sizeof( entries ) / sizeof( (entries)[0] ), 0, 0, 0 }
 
-#endif
\ No newline at end of file
+#endif